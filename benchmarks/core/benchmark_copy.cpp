@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,9 @@
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
 #include <vecmem/utils/copy.hpp>
+#include <vecmem/utils/host/async_copy.hpp>
+#include <vecmem/utils/host/parallel_copy.hpp>
+#include <vecmem/utils/streaming_copy.hpp>
 
 // Common benchmark include(s).
 #include "../common/make_jagged_sizes.hpp"
@@ -18,6 +21,10 @@
 #include <benchmark/benchmark.h>
 
 // System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <vector>
 
@@ -28,6 +35,22 @@ static host_memory_resource host_mr;
 /// The copy object to use in the benchmark(s).
 static copy host_copy;
 
+/// Get a multi-threaded copy object, using a given number of threads
+static host::parallel_copy& parallel_host_copy(std::size_t n_threads) {
+
+    static std::map<std::size_t, std::unique_ptr<host::parallel_copy>> copies;
+    auto& result = copies[n_threads];
+    if (!result) {
+        host::parallel_copy::options opts;
+        opts.n_threads = n_threads;
+        result = std::make_unique<host::parallel_copy>(opts);
+    }
+    return *result;
+}
+
+/// The thread counts to run the multi-threaded benchmarks with
+static const std::vector<int64_t> parallel_copy_threads = {1, 2, 4, 8};
+
 /// Function benchmarking "unknown" host-to-device jagged vector copies
 void jaggedVectorUnknownHtoDCopy(::benchmark::State& state) {
 
@@ -156,4 +179,141 @@ void jaggedVectorKnownDtoHCopy(::benchmark::State& state) {
 // Set up the benchmark.
 BENCHMARK(jaggedVectorKnownDtoHCopy)->Ranges({{10, 100000}, {50, 5000}});
 
+/// Function benchmarking multi-threaded host-to-host vector copies
+void vectorParallelHtoHCopy(::benchmark::State& state) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t bytes = static_cast<std::size_t>(state.range(0));
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the "source" and "destination" buffers.
+    const copy& pcopy =
+        parallel_host_copy(static_cast<std::size_t>(state.range(1)));
+    data::vector_buffer<char> source(
+        static_cast<data::vector_buffer<char>::size_type>(bytes), host_mr);
+    pcopy.memset(source, 1)->wait();
+    data::vector_buffer<char> dest(
+        static_cast<data::vector_buffer<char>::size_type>(bytes), host_mr);
+    pcopy.memset(dest, 0)->wait();
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        pcopy(source, dest, copy::type::host_to_host)->wait();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(vectorParallelHtoHCopy)
+    ->ArgsProduct({::benchmark::CreateRange(1 << 20, 1 << 28, 16),
+                   parallel_copy_threads})
+    ->UseRealTime();
+
+/// Function benchmarking multi-threaded vector memory filling
+void vectorParallelMemset(::benchmark::State& state) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t bytes = static_cast<std::size_t>(state.range(0));
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Threads"] = static_cast<double>(state.range(1));
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the buffer to fill.
+    const copy& pcopy =
+        parallel_host_copy(static_cast<std::size_t>(state.range(1)));
+    data::vector_buffer<char> buffer(
+        static_cast<data::vector_buffer<char>::size_type>(bytes), host_mr);
+
+    // Perform the memset benchmark.
+    for (auto _ : state) {
+        pcopy.memset(buffer, 0)->wait();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(vectorParallelMemset)
+    ->ArgsProduct({::benchmark::CreateRange(1 << 20, 1 << 28, 16),
+                   parallel_copy_threads})
+    ->UseRealTime();
+
+/// Function benchmarking multi-threaded host-to-host jagged buffer copies
+void jaggedVectorParallelHtoHCopy(::benchmark::State& state) {
+
+    // Generate the sizes of the jagged buffers for the test.
+    const std::vector<std::size_t> sizes =
+        make_jagged_sizes(state.range(0), state.range(1));
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t bytes = std::accumulate(sizes.begin(), sizes.end(),
+                                              static_cast<std::size_t>(0u)) *
+                              sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Threads"] = static_cast<double>(state.range(2));
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the "source" and "destination" buffers.
+    const copy& pcopy =
+        parallel_host_copy(static_cast<std::size_t>(state.range(2)));
+    data::jagged_vector_buffer<int> source(sizes, host_mr);
+    pcopy.setup(source)->wait();
+    pcopy.memset(source, 1)->wait();
+    data::jagged_vector_buffer<int> dest(sizes, host_mr);
+    pcopy.setup(dest)->wait();
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        pcopy(source, dest, copy::type::host_to_host)->wait();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(jaggedVectorParallelHtoHCopy)
+    ->ArgsProduct({{10000, 100000}, {5000}, parallel_copy_threads})
+    ->UseRealTime();
+
+/// Function benchmarking streaming host-to-host vector copies
+void vectorStreamingHtoHCopy(::benchmark::State& state) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t bytes = static_cast<std::size_t>(state.range(0));
+    streaming_copy::options opts;
+    opts.chunk_size = static_cast<std::size_t>(state.range(1));
+    opts.n_buffers = static_cast<std::size_t>(state.range(2));
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["StagingBytes"] =
+        static_cast<double>(opts.chunk_size * opts.n_buffers);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the "source" buffer, and the streaming copy object.
+    static host::async_copy async_host_copy;
+    data::vector_buffer<char> source(
+        static_cast<data::vector_buffer<char>::size_type>(bytes), host_mr);
+    host_copy.memset(source, 1)->wait();
+    streaming_copy streamer(async_host_copy, host_mr, opts);
+
+    // Perform the streaming benchmark, with a simple processing step.
+    for (auto _ : state) {
+        std::size_t sum = 0u;
+        streamer(source, [&sum](data::vector_view<char> chunk, std::size_t) {
+            sum = std::accumulate(chunk.ptr(), chunk.ptr() + chunk.size(), sum);
+        });
+        ::benchmark::DoNotOptimize(sum);
+    }
+}
+// Set up the benchmark.
+BENCHMARK(vectorStreamingHtoHCopy)
+    ->ArgsProduct({{1 << 28}, ::benchmark::CreateRange(1 << 16, 1 << 22, 4),
+                   {1, 2, 4}})
+    ->UseRealTime();
+
 }  // namespace vecmem::benchmark
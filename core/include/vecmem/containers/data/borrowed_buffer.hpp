@@ -0,0 +1,69 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <memory>
+
+namespace vecmem {
+namespace data {
+
+/// Read-only buffer that may alias the memory of the data it was made from
+///
+/// Objects of this type are produced by @c vecmem::copy::to_borrowed. They
+/// either point at the memory of the container that they were "copied"
+/// from, or at a buffer holding a real copy of it. In both cases the memory
+/// is kept alive by a shared handle held by the object, so (copies of) the
+/// object can be used until the last one of them is destroyed.
+///
+/// @tparam VIEW The (constant) view type describing the data
+///
+template <typename VIEW>
+class borrowed_buffer : public VIEW {
+
+public:
+    /// The base type used by this class
+    using base_type = VIEW;
+
+    /// Default constructor
+    borrowed_buffer() = default;
+    /// Constructor from a view, and the owner of its memory
+    ///
+    /// @param parent The view of the data
+    /// @param owner Handle keeping the memory of the view alive
+    /// @param borrowed Whether @c parent refers to the original memory
+    ///
+    borrowed_buffer(const base_type& parent, std::shared_ptr<const void> owner,
+                    bool borrowed);
+
+    /// Check whether the buffer refers to the memory of its source
+    bool is_borrowed() const;
+    /// Get the handle keeping the memory of the buffer alive
+    ///
+    /// May be a null pointer if the memory's lifetime is managed by the
+    /// user.
+    ///
+    const std::shared_ptr<const void>& owner() const;
+
+private:
+    /// Handle keeping the memory of the buffer alive
+    std::shared_ptr<const void> m_owner;
+    /// Flag showing whether the original memory is referenced
+    bool m_borrowed = false;
+
+};  // class borrowed_buffer
+
+}  // namespace data
+
+/// Helper function for getting the view of a borrowed buffer
+template <typename VIEW>
+const VIEW& get_data(const data::borrowed_buffer<VIEW>& data);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/borrowed_buffer.ipp"
@@ -0,0 +1,100 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <type_traits>
+#include <vector>
+
+namespace vecmem {
+namespace data {
+
+/// Buffer holding the elements of a jagged vector back to back
+///
+/// The inner vectors are stored in a compressed sparse row (CSR) layout. All
+/// of their elements are held by a single 1-dimensional buffer, with an
+/// additional buffer holding the offset of every inner vector in it. The
+/// offsets array has one more element than the number of inner vectors, its
+/// last element being the total number of elements.
+///
+/// The offsets are kept both in the memory resource of the buffer, and on
+/// the host. Objects of this type are produced by
+/// @c vecmem::copy::flatten.
+///
+/// @tparam TYPE The type of the elements of the inner vectors
+///
+template <typename TYPE>
+class flat_jagged_buffer {
+
+public:
+    /// Size type of the (inner) vectors
+    using size_type = typename vector_view<TYPE>::size_type;
+
+    /// Make sure that the template type does not have a custom destructor
+    static_assert(std::is_trivially_destructible_v<TYPE>,
+                  "vecmem::data::flat_jagged_buffer can not handle types with "
+                  "custom destructors");
+
+    /// Default constructor
+    flat_jagged_buffer() = default;
+    /// Constructor with the offsets of the inner vectors
+    ///
+    /// Memory is allocated for the elements and the offsets, but neither of
+    /// them is set up in @c resource by the constructor.
+    ///
+    /// @param offsets The offsets of the inner vectors, on the host
+    /// @param resource The memory resource to allocate the buffers with
+    ///
+    flat_jagged_buffer(std::vector<size_type> offsets,
+                       memory_resource& resource);
+    /// Move constructor
+    flat_jagged_buffer(flat_jagged_buffer&&) noexcept = default;
+
+    /// Move assignment
+    flat_jagged_buffer& operator=(flat_jagged_buffer&&) noexcept = default;
+
+    /// Get the number of inner vectors
+    size_type size() const;
+    /// Get the total number of elements
+    size_type n_elements() const;
+
+    /// Get a view of all elements of the buffer
+    vector_view<TYPE> values();
+    /// Get a view of all elements of the buffer (const)
+    vector_view<const TYPE> values() const;
+    /// Get a view of the offsets, in the memory resource of the buffer
+    vector_view<size_type> offsets();
+    /// Get a view of the offsets, in the memory resource of the buffer (const)
+    vector_view<const size_type> offsets() const;
+    /// Get the offsets on the host
+    const std::vector<size_type>& host_offsets() const;
+
+    /// Get a view of one of the inner vectors
+    vector_view<TYPE> inner(size_type i);
+    /// Get a view of one of the inner vectors (const)
+    vector_view<const TYPE> inner(size_type i) const;
+
+private:
+    /// The offsets of the inner vectors on the host
+    std::vector<size_type> m_host_offsets;
+    /// The elements of all inner vectors
+    vector_buffer<TYPE> m_values;
+    /// The offsets of the inner vectors in the memory resource
+    vector_buffer<size_type> m_offsets;
+
+};  // class flat_jagged_buffer
+
+}  // namespace data
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/flat_jagged_buffer.ipp"
@@ -10,6 +10,7 @@
 
 // Local include(s).
 #include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_space.hpp"
 #include "vecmem/utils/type_traits.hpp"
 #include "vecmem/utils/types.hpp"
 
@@ -64,7 +65,8 @@ public:
      * Constructor with all the information held by the object.
      */
     VECMEM_HOST_AND_DEVICE
-    jagged_vector_view(size_type size, pointer ptr, pointer host_ptr = nullptr);
+    jagged_vector_view(size_type size, pointer ptr, pointer host_ptr = nullptr,
+                       memory_space space = memory_space::unknown);
 
     /**
      * Constructor from a "slightly different" @c
@@ -133,12 +135,19 @@ public:
     VECMEM_HOST_AND_DEVICE
     pointer host_ptr() const;
 
+    /// Get the kind of memory that the inner vectors live in
+    VECMEM_HOST_AND_DEVICE
+    memory_space space() const;
+
 private:
     /**
      * The number of rows in this jagged vector.
      */
     size_type m_size;
 
+    /// The kind of memory that the inner vectors live in
+    memory_space m_space;
+
     /**
      * The internal state of this jagged vector, which is heap-allocated by
      * the given memory manager.
@@ -7,6 +7,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/memory_space.hpp"
 #include "vecmem/utils/type_traits.hpp"
 #include "vecmem/utils/types.hpp"
 
@@ -57,10 +58,12 @@ public:
     vector_view() = default;
     /// Constant size data constructor
     VECMEM_HOST_AND_DEVICE
-    vector_view(size_type size, pointer ptr);
+    vector_view(size_type size, pointer ptr,
+                memory_space space = memory_space::unknown);
     /// Resizable data constructor
     VECMEM_HOST_AND_DEVICE
-    vector_view(size_type capacity, size_pointer size, pointer ptr);
+    vector_view(size_type capacity, size_pointer size, pointer ptr,
+                memory_space space = memory_space::unknown);
 
     /// Constructor from a "slightly different" @c vecmem::details::vector_view
     /// object
@@ -116,10 +119,15 @@ public:
     /// Get a pointer to the vector elements
     VECMEM_HOST_AND_DEVICE
     pointer ptr() const;
+    /// Get the kind of memory that the vector lives in
+    VECMEM_HOST_AND_DEVICE
+    memory_space space() const;
 
 private:
     /// Maximum capacity of the array
     size_type m_capacity;
+    /// The kind of memory that the array lives in
+    memory_space m_space;
     /// Pointer to the size of the array in memory
     size_pointer m_size;
     /// Pointer to the start of the memory block/array
@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,11 @@
 // Local include(s).
 #include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/bulk_allocation.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
 
 namespace vecmem::details {
 
@@ -38,4 +43,52 @@ void resize_jagged_vector(jagged_vector<T>& vec, std::size_t size) {
     vec.resize(size, vecmem::vector<T>(vec.get_allocator().resource()));
 }
 
+/// Resize a generic jagged vector, including all of its "internal" vectors
+///
+/// @param vec The vector to resize
+/// @param sizes The sizes to resize the "internal" vectors to
+///
+template <typename T, typename ALLOC1, typename ALLOC2, typename SIZE_TYPE>
+void resize_jagged_vector(std::vector<std::vector<T, ALLOC1>, ALLOC2>& vec,
+                          const std::vector<SIZE_TYPE>& sizes) {
+    vec.resize(sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        vec[i].resize(sizes[i]);
+    }
+}
+
+/// Resize a vecmem jagged vector, including all of its "internal" vectors
+///
+/// Before resizing the "internal" vectors one by one, it lets the memory
+/// resource of the jagged vector know about all of the upcoming allocations
+/// in a single call. So that caching memory resources could set up the
+/// memory for all of them in one go.
+///
+/// @param vec The vector to resize
+/// @param sizes The sizes to resize the "internal" vectors to
+///
+template <typename T, typename SIZE_TYPE>
+void resize_jagged_vector(jagged_vector<T>& vec,
+                          const std::vector<SIZE_TYPE>& sizes) {
+
+    // Collect the sizes of all the upcoming allocations.
+    std::vector<std::size_t> bytes;
+    bytes.reserve(sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        if ((i >= vec.size()) || (vec[i].capacity() < sizes[i])) {
+            bytes.push_back(sizes[i] * sizeof(T));
+        }
+    }
+    if (bytes.size() > 1u) {
+        vecmem::reserve_bulk(*(vec.get_allocator().resource()), bytes.size(),
+                             bytes.data(), alignof(T));
+    }
+
+    // Now resize all of the vectors.
+    resize_jagged_vector(vec, sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        vec[i].resize(sizes[i]);
+    }
+}
+
 }  // namespace vecmem::details
@@ -0,0 +1,41 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <utility>
+
+namespace vecmem {
+namespace data {
+
+template <typename VIEW>
+borrowed_buffer<VIEW>::borrowed_buffer(const base_type& parent,
+                                       std::shared_ptr<const void> owner,
+                                       bool borrowed)
+    : base_type(parent), m_owner(std::move(owner)), m_borrowed(borrowed) {}
+
+template <typename VIEW>
+bool borrowed_buffer<VIEW>::is_borrowed() const {
+
+    return m_borrowed;
+}
+
+template <typename VIEW>
+const std::shared_ptr<const void>& borrowed_buffer<VIEW>::owner() const {
+
+    return m_owner;
+}
+
+}  // namespace data
+
+template <typename VIEW>
+const VIEW& get_data(const data::borrowed_buffer<VIEW>& data) {
+
+    return data;
+}
+
+}  // namespace vecmem
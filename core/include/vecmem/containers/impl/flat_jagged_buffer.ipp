@@ -0,0 +1,87 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <utility>
+
+namespace vecmem {
+namespace data {
+
+template <typename TYPE>
+flat_jagged_buffer<TYPE>::flat_jagged_buffer(std::vector<size_type> offsets,
+                                             memory_resource& resource)
+    : m_host_offsets(std::move(offsets)),
+      m_values((m_host_offsets.empty() ? 0u : m_host_offsets.back()),
+               resource),
+      m_offsets(static_cast<size_type>(m_host_offsets.size()), resource) {}
+
+template <typename TYPE>
+auto flat_jagged_buffer<TYPE>::size() const -> size_type {
+
+    return (m_host_offsets.empty()
+                ? 0u
+                : static_cast<size_type>(m_host_offsets.size() - 1u));
+}
+
+template <typename TYPE>
+auto flat_jagged_buffer<TYPE>::n_elements() const -> size_type {
+
+    return m_values.capacity();
+}
+
+template <typename TYPE>
+vector_view<TYPE> flat_jagged_buffer<TYPE>::values() {
+
+    return m_values;
+}
+
+template <typename TYPE>
+vector_view<const TYPE> flat_jagged_buffer<TYPE>::values() const {
+
+    return m_values;
+}
+
+template <typename TYPE>
+auto flat_jagged_buffer<TYPE>::offsets() -> vector_view<size_type> {
+
+    return m_offsets;
+}
+
+template <typename TYPE>
+auto flat_jagged_buffer<TYPE>::offsets() const
+    -> vector_view<const size_type> {
+
+    return m_offsets;
+}
+
+template <typename TYPE>
+auto flat_jagged_buffer<TYPE>::host_offsets() const
+    -> const std::vector<size_type>& {
+
+    return m_host_offsets;
+}
+
+template <typename TYPE>
+vector_view<TYPE> flat_jagged_buffer<TYPE>::inner(size_type i) {
+
+    assert(i < size());
+    return {m_host_offsets[i + 1u] - m_host_offsets[i],
+            m_values.ptr() + m_host_offsets[i], m_values.space()};
+}
+
+template <typename TYPE>
+vector_view<const TYPE> flat_jagged_buffer<TYPE>::inner(size_type i) const {
+
+    assert(i < size());
+    return {m_host_offsets[i + 1u] - m_host_offsets[i],
+            m_values.ptr() + m_host_offsets[i], m_values.space()};
+}
+
+}  // namespace data
+}  // namespace vecmem
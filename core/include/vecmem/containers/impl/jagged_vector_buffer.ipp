@@ -9,6 +9,7 @@
 
 // vecmem include(s).
 #include "vecmem/containers/details/aligned_multiple_placement.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 #include "vecmem/utils/details/narrow_size.hpp"
 
 // System include(s).
@@ -86,6 +87,9 @@ jagged_vector_buffer<TYPE>::jagged_vector_buffer(
     const std::size_t total_elements = std::accumulate(
         capacities.begin(), capacities.end(), static_cast<std::size_t>(0));
 
+    // The kind of memory that the inner vectors will live in.
+    const memory_space space = get_memory_space(resource);
+
     // Helper pointers to the "inner data".
     header_t* header_ptr = nullptr;
     TYPE* data_ptr = nullptr;
@@ -108,7 +112,7 @@ jagged_vector_buffer<TYPE>::jagged_vector_buffer(
         vecmem::details::narrow_size<size_type>(capacities.size()),
         ((host_access_resource != nullptr) ? m_outer_memory.get()
                                            : m_outer_host_memory.get()),
-        m_outer_host_memory.get()});
+        m_outer_host_memory.get(), space});
 
     // Set up the vecmem::vector_view objects in the host accessible memory.
     std::ptrdiff_t ptrdiff = 0;
@@ -116,11 +120,11 @@ jagged_vector_buffer<TYPE>::jagged_vector_buffer(
         if (header_ptr != nullptr) {
             new (base_type::host_ptr() + i) value_type(
                 static_cast<typename value_type::size_type>(capacities[i]),
-                &(header_ptr[i]), data_ptr + ptrdiff);
+                &(header_ptr[i]), data_ptr + ptrdiff, space);
         } else {
             new (base_type::host_ptr() + i) value_type(
                 static_cast<typename value_type::size_type>(capacities[i]),
-                data_ptr + ptrdiff);
+                data_ptr + ptrdiff, space);
         }
         ptrdiff += capacities[i];
     }
@@ -16,8 +16,9 @@ namespace data {
 
 template <typename T>
 VECMEM_HOST_AND_DEVICE jagged_vector_view<T>::jagged_vector_view(
-    size_type size, pointer ptr, pointer host_ptr)
+    size_type size, pointer ptr, pointer host_ptr, memory_space space)
     : m_size(size),
+      m_space(space),
       m_ptr(ptr),
       m_host_ptr(host_ptr != nullptr ? host_ptr : ptr) {}
 
@@ -27,6 +28,7 @@ template <typename OTHERTYPE,
 VECMEM_HOST_AND_DEVICE jagged_vector_view<T>::jagged_vector_view(
     const jagged_vector_view<OTHERTYPE>& parent)
     : m_size(parent.size()),
+      m_space(parent.space()),
       // This looks scarier than it really is. We "just" reinterpret a
       // vecmem::data::vector_view<T> pointer to be seen as
       // vecmem::data::vector_view<const T> instead.
@@ -46,6 +48,7 @@ VECMEM_HOST_AND_DEVICE jagged_vector_view<T>& jagged_vector_view<T>::operator=(
     // Self-assignment is not dangerous for this type. But putting in
     // extra checks into the code would not be great.
     m_size = rhs.size();
+    m_space = rhs.space();
     m_ptr = reinterpret_cast<pointer>(
         const_cast<typename jagged_vector_view<OTHERTYPE>::pointer>(rhs.ptr()));
     m_host_ptr = reinterpret_cast<pointer>(
@@ -107,6 +110,12 @@ VECMEM_HOST_AND_DEVICE auto jagged_vector_view<T>::host_ptr() const -> pointer {
     return m_host_ptr;
 }
 
+template <typename T>
+VECMEM_HOST_AND_DEVICE memory_space jagged_vector_view<T>::space() const {
+
+    return m_space;
+}
+
 template <typename T>
 VECMEM_HOST std::vector<typename vector_view<T>::size_type> get_capacities(
     const jagged_vector_view<T>& data) {
@@ -8,6 +8,7 @@
 
 // vecmem include(s).
 #include "vecmem/containers/details/aligned_multiple_placement.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 // System include(s).
 #include <cassert>
@@ -27,7 +28,7 @@ vector_buffer<TYPE>::vector_buffer()
 template <typename TYPE>
 vector_buffer<TYPE>::vector_buffer(size_type capacity,
                                    memory_resource& resource, buffer_type type)
-    : base_type(capacity, nullptr, nullptr) {
+    : base_type(capacity, nullptr, nullptr, get_memory_space(resource)) {
 
     // Exit early for null-capacity buffers.
     if (capacity == 0) {
@@ -43,7 +44,7 @@ vector_buffer<TYPE>::vector_buffer(size_type capacity,
             resource, type == buffer_type::fixed_size ? 0 : 1, capacity);
 
     // Set up the base object.
-    base_type::operator=(base_type{capacity, size, ptr});
+    base_type::operator=(base_type{capacity, size, ptr, base_type::space()});
 }
 
 template <typename TYPE>
@@ -11,14 +11,16 @@ namespace data {
 
 template <typename TYPE>
 VECMEM_HOST_AND_DEVICE vector_view<TYPE>::vector_view(size_type size,
-                                                      pointer ptr)
-    : m_capacity(size), m_size(nullptr), m_ptr(ptr) {}
+                                                      pointer ptr,
+                                                      memory_space space)
+    : m_capacity(size), m_space(space), m_size(nullptr), m_ptr(ptr) {}
 
 template <typename TYPE>
 VECMEM_HOST_AND_DEVICE vector_view<TYPE>::vector_view(size_type capacity,
                                                       size_pointer size,
-                                                      pointer ptr)
-    : m_capacity(capacity), m_size(size), m_ptr(ptr) {}
+                                                      pointer ptr,
+                                                      memory_space space)
+    : m_capacity(capacity), m_space(space), m_size(size), m_ptr(ptr) {}
 
 template <typename TYPE>
 template <typename OTHERTYPE,
@@ -26,6 +28,7 @@ template <typename OTHERTYPE,
 VECMEM_HOST_AND_DEVICE vector_view<TYPE>::vector_view(
     const vector_view<OTHERTYPE>& parent)
     : m_capacity(parent.capacity()),
+      m_space(parent.space()),
       m_size(parent.size_ptr()),
       m_ptr(parent.ptr()) {}
 
@@ -38,6 +41,7 @@ VECMEM_HOST_AND_DEVICE vector_view<TYPE>& vector_view<TYPE>::operator=(
     // Self-assignment is not dangerous for this type. But putting in
     // extra checks into the code would not be great.
     m_capacity = rhs.capacity();
+    m_space = rhs.space();
     m_size = rhs.size_ptr();
     m_ptr = rhs.ptr();
 
@@ -93,5 +97,11 @@ VECMEM_HOST_AND_DEVICE auto vector_view<TYPE>::ptr() const -> pointer {
     return m_ptr;
 }
 
+template <typename TYPE>
+VECMEM_HOST_AND_DEVICE memory_space vector_view<TYPE>::space() const {
+
+    return m_space;
+}
+
 }  // namespace data
 }  // namespace vecmem
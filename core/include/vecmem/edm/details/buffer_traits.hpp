@@ -11,6 +11,7 @@
 #include "vecmem/edm/details/view_traits.hpp"
 #include "vecmem/edm/schema.hpp"
 #include "vecmem/edm/view.hpp"
+#include "vecmem/memory/memory_space.hpp"
 #include "vecmem/memory/unique_ptr.hpp"
 #include "vecmem/utils/tuple.hpp"
 #include "vecmem/utils/types.hpp"
@@ -251,7 +252,8 @@ template <typename... TYPES>
 VECMEM_HOST constexpr typename view<schema<TYPES...>>::memory_view_type
 find_payload_view(
     const std::tuple<typename view_type<TYPES>::payload_ptr...>& payloads,
-    const std::array<std::size_t, sizeof...(TYPES)>& sizes) {
+    const std::array<std::size_t, sizeof...(TYPES)>& sizes,
+    memory_space space) {
 
     // The result type.
     using result_type = typename view<schema<TYPES...>>::memory_view_type;
@@ -264,7 +266,8 @@ find_payload_view(
         payloads, sizes, std::index_sequence_for<TYPES...>()));
 
     // Construct the result.
-    return {static_cast<typename result_type::size_type>(end_ptr - ptr), ptr};
+    return {static_cast<typename result_type::size_type>(end_ptr - ptr), ptr,
+            space};
 }
 
 }  // namespace vecmem::edm::details
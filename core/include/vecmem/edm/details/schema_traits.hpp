@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,8 @@
 #include "vecmem/utils/type_traits.hpp"
 
 // System include(s).
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 
 namespace vecmem {
@@ -254,6 +256,33 @@ constexpr bool has_jagged_vector_v =
 
 /// @}
 
+/// @name Trait(s) selecting variables from a full schema
+/// @{
+
+/// Technical base type for @c select<schema<VARTYPES...>,INDICES...>
+template <typename T, std::size_t... INDICES>
+struct select;
+
+/// Schema made out of some of the variables of another schema
+///
+/// @tparam ...VARTYPES The variable types in the original schema
+/// @tparam ...INDICES The indices of the variables to select
+///
+template <typename... VARTYPES, std::size_t... INDICES>
+struct select<schema<VARTYPES...>, INDICES...> {
+    static_assert(sizeof...(INDICES) > 0, "No variables selected");
+    static_assert(((INDICES < sizeof...(VARTYPES)) && ...),
+                  "Variable index out of range");
+    using type =
+        schema<std::tuple_element_t<INDICES, std::tuple<VARTYPES...>>...>;
+};  // struct select
+
+/// Convenience alias for @c select<schema<VARTYPES...>,INDICES...>::type
+template <typename T, std::size_t... INDICES>
+using select_t = typename select<T, INDICES...>::type;
+
+/// @}
+
 }  // namespace details
 }  // namespace edm
 }  // namespace vecmem
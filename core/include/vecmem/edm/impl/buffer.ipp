@@ -11,6 +11,7 @@
 #include "vecmem/edm/details/buffer_traits.hpp"
 #include "vecmem/edm/details/schema_traits.hpp"
 #include "vecmem/edm/details/view_traits.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 // System include(s).
 #include <stdexcept>
@@ -126,7 +127,8 @@ VECMEM_HOST void buffer<schema<VARTYPES...>>::setup_fixed(
         {details::buffer_alloc<VARTYPES>::layout_size(capacities)...});
     view_type::m_payload = details::find_payload_view<VARTYPES...>(
         payload_ptrs,
-        {details::buffer_alloc<VARTYPES>::payload_size(capacities)...});
+        {details::buffer_alloc<VARTYPES>::payload_size(capacities)...},
+        get_memory_space(mr));
 
     // If requested, allocate host memory for the layouts.
     if (host_mr != nullptr) {
@@ -234,7 +236,8 @@ VECMEM_HOST void buffer<schema<VARTYPES...>>::setup_resizable(
         {details::buffer_alloc<VARTYPES>::layout_size(capacities)...});
     view_type::m_payload = details::find_payload_view<VARTYPES...>(
         payload_ptrs,
-        {details::buffer_alloc<VARTYPES>::payload_size(capacities)...});
+        {details::buffer_alloc<VARTYPES>::payload_size(capacities)...},
+        get_memory_space(mr));
 
     // If requested, allocate host memory for the layouts.
     if (host_mr != nullptr) {
@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 
 // System include(s).
 #include <cassert>
+#include <utility>
 
 namespace vecmem {
 namespace edm {
@@ -208,6 +209,16 @@ private:
     }
 };  // struct get_capacities_impl
 
+/// Helper function assigning the selected variables of a view
+template <typename RESULT, typename SOURCE, std::size_t... POSITIONS,
+          std::size_t... INDICES>
+VECMEM_HOST_AND_DEVICE void select_impl(RESULT& result, const SOURCE& soa,
+                                        std::index_sequence<POSITIONS...>,
+                                        std::index_sequence<INDICES...>) {
+
+    ((result.template get<POSITIONS>() = soa.template get<INDICES>()), ...);
+}
+
 }  // namespace details
 
 template <typename... VARTYPES>
@@ -223,5 +234,32 @@ get_capacities(const view<schema<VARTYPES...>>& soa) {
                                         VARTYPES...>::get(soa);
 }
 
+template <std::size_t... INDICES, typename... VARTYPES>
+VECMEM_HOST_AND_DEVICE
+    view<details::select_t<schema<VARTYPES...>, INDICES...>>
+    select(const view<schema<VARTYPES...>>& soa) {
+
+    // The type of the result.
+    using result_type =
+        view<details::select_t<schema<VARTYPES...>, INDICES...>>;
+
+    // The size variable(s) of a container with jagged vectors don't describe
+    // the size of a container without them. The vectors of such containers
+    // are not resizable anyway.
+    typename result_type::memory_view_type size = soa.size();
+    if constexpr (details::has_jagged_vector_v<VARTYPES...> &&
+                  (!details::has_jagged_vector<
+                      typename result_type::schema_type>::value)) {
+        size = {0u, nullptr};
+    }
+
+    // Create the result view, with only the selected variables set.
+    result_type result{soa.capacity(), size};
+    details::select_impl(result, soa,
+                         std::make_index_sequence<sizeof...(INDICES)>{},
+                         std::index_sequence<INDICES...>{});
+    return result;
+}
+
 }  // namespace edm
 }  // namespace vecmem
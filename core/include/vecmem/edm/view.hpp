@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 
 // Local include(s).
 #include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/edm/details/schema_traits.hpp"
 #include "vecmem/edm/details/types.hpp"
 #include "vecmem/edm/details/view_traits.hpp"
 #include "vecmem/edm/schema.hpp"
@@ -16,6 +17,7 @@
 #include "vecmem/utils/types.hpp"
 
 // System include(s).
+#include <cstddef>
 #include <type_traits>
 #include <vector>
 
@@ -203,6 +205,21 @@ template <typename... VARTYPES>
 VECMEM_HOST std::vector<vecmem::data::vector_view<int>::size_type>
 get_capacities(const view<schema<VARTYPES...>>& soa);
 
+/// Helper function creating a view of some of the variables of a view
+///
+/// The resulting view does not describe a single memory block anymore, so
+/// all copies involving it are performed variable by variable.
+///
+/// @tparam INDICES The indices of the variables to select
+/// @tparam VARTYPES The variable types described by the view
+/// @param soa The view to select the variables from
+/// @return A view of the selected variables
+///
+template <std::size_t... INDICES, typename... VARTYPES>
+VECMEM_HOST_AND_DEVICE
+    view<details::select_t<schema<VARTYPES...>, INDICES...>>
+    select(const view<schema<VARTYPES...>>& soa);
+
 }  // namespace edm
 }  // namespace vecmem
 
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,12 +9,16 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/bulk_memory_resource.hpp"
+#include "vecmem/memory/details/memory_range_provider.hpp"
 #include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
 // System include(s).
 #include <memory>
+#include <vector>
 
 namespace vecmem {
 
@@ -24,7 +28,11 @@ class arena_memory_resource_impl;
 }
 
 /// Memory resource implementing an arena allocation scheme
-class arena_memory_resource final : public details::memory_resource_base {
+class arena_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_range_provider,
+      public details::bulk_memory_resource,
+      public details::memory_space_provider {
 
 public:
     /// Construct the memory resource on top of an upstream memory resource
@@ -67,8 +75,52 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_range_provider
+    /// @{
+
+    /// Get the current revision of the owned address ranges
+    VECMEM_CORE_EXPORT
+    std::size_t do_ranges_revision() const noexcept override;
+    /// Get the address ranges owned by the memory resource
+    VECMEM_CORE_EXPORT
+    void do_owned_ranges(std::vector<range>& ranges) const override;
+
+    /// @}
+
+    /// @name Function(s) implementing @c vecmem::details::bulk_memory_resource
+    /// @{
+
+    /// Allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_allocate_bulk(std::size_t n, const std::size_t* sizes,
+                          std::size_t alignment, void** ptrs) override;
+    /// De-allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_deallocate_bulk(std::size_t n, void* const* ptrs,
+                            const std::size_t* sizes,
+                            std::size_t alignment) override;
+    /// Prepare for a number of upcoming allocations
+    VECMEM_CORE_EXPORT
+    void do_reserve_bulk(std::size_t n, const std::size_t* sizes,
+                         std::size_t alignment) override;
+
+    /// @}
+
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// Object performing the heavy lifting for the memory resource
     std::unique_ptr<details::arena_memory_resource_impl> m_impl;
+    /// The kind of memory allocated by the upstream resource
+    memory_space m_space;
 
 };  // class arena_memory_resource
 
@@ -0,0 +1,121 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace vecmem {
+
+// Forward declaration(s).
+namespace details {
+class batched_synchronized_memory_resource_impl;
+}
+
+/// A synchronized memory resource that batches up de-allocations
+///
+/// Just like @c vecmem::synchronized_memory_resource, this resource makes
+/// it possible to use a non-thread-safe upstream resource from multiple
+/// threads. But instead of taking the mutex protecting the upstream resource
+/// for every single de-allocation, de-allocation requests are pushed into a
+/// lock-free (bounded) queue. The queue is then drained in batches, under a
+/// single lock acquisition. Either opportunistically during the next
+/// allocation, or from a background thread, if one was requested.
+///
+/// This is meant for producer/consumer type setups, where memory is freed
+/// on different threads than where it was allocated.
+///
+/// Note that without a background thread, memory released into the queue
+/// only gets returned to the upstream resource on the next allocation, on an
+/// explicit call to @c drain(), or when the queue fills up.
+///
+class batched_synchronized_memory_resource final
+    : public details::memory_resource_base {
+
+public:
+    /// Runtime options for @c vecmem::batched_synchronized_memory_resource
+    struct VECMEM_CORE_EXPORT options {
+
+        /// Default constructor
+        ///
+        /// It is necessary to work around issue:
+        /// https://github.com/llvm/llvm-project/issues/36032
+        ///
+        options();
+
+        /// The number of de-allocations that the queue can hold
+        ///
+        /// Must be a power of 2. When the queue is full, the de-allocating
+        /// thread drains it itself, under the lock.
+        ///
+        std::size_t queue_capacity = 1024;
+
+        /// Whether to drain the queue from a dedicated background thread
+        bool background_drain = false;
+        /// The interval at which the background thread drains the queue
+        std::chrono::microseconds drain_interval{100};
+
+    };  // struct options
+
+    /// Constructor around an upstream memory resource
+    ///
+    /// @param upstream The (non-thread-safe) memory resource to synchronize
+    /// @param opts The options to use for the memory resource
+    ///
+    VECMEM_CORE_EXPORT
+    explicit batched_synchronized_memory_resource(
+        memory_resource& upstream, const options& opts = options{});
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    batched_synchronized_memory_resource(
+        batched_synchronized_memory_resource&& parent) noexcept;
+    /// Disallow copying the memory resource
+    batched_synchronized_memory_resource(
+        const batched_synchronized_memory_resource&) = delete;
+
+    /// Destructor, returning all queued memory to the upstream resource
+    VECMEM_CORE_EXPORT
+    ~batched_synchronized_memory_resource() override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    batched_synchronized_memory_resource& operator=(
+        batched_synchronized_memory_resource&& rhs) noexcept;
+    /// Disallow copying the memory resource
+    batched_synchronized_memory_resource& operator=(
+        const batched_synchronized_memory_resource&) = delete;
+
+    /// Return all queued de-allocations to the upstream resource
+    VECMEM_CORE_EXPORT
+    void drain();
+
+private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory with the upstream resource
+    VECMEM_CORE_EXPORT
+    void* do_allocate(std::size_t, std::size_t) override;
+    /// Queue a previously allocated memory block for de-allocation
+    VECMEM_CORE_EXPORT
+    void do_deallocate(void* p, std::size_t, std::size_t) override;
+
+    /// @}
+
+    /// Object implementing the memory resource's logic
+    std::unique_ptr<details::batched_synchronized_memory_resource_impl> m_impl;
+
+};  // class batched_synchronized_memory_resource
+
+}  // namespace vecmem
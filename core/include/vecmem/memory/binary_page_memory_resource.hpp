@@ -10,6 +10,7 @@
 
 // Local include(s).
 #include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
@@ -34,7 +35,9 @@ struct binary_page_memory_resource_impl;
  * creates a binary tree of pages which can be either vacant, occupied, or
  * split.
  */
-class binary_page_memory_resource final : public details::memory_resource_base {
+class binary_page_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_space_provider {
 
 public:
     /**
@@ -81,8 +84,20 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// Object implementing the memory resource's logic
     std::unique_ptr<details::binary_page_memory_resource_impl> m_impl;
+    /// The kind of memory allocated by the upstream resource
+    memory_space m_space;
 
 };  // class binary_page_memory_resource
 
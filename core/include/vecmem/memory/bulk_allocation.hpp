@@ -0,0 +1,68 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Allocate multiple memory blocks with a memory resource in one go
+///
+/// Memory resources implementing @c vecmem::details::bulk_memory_resource
+/// serve the request in a single call. For all other memory resources the
+/// blocks are allocated one by one.
+///
+/// Either all of the memory blocks are allocated, or an exception is thrown,
+/// with none of them allocated. Zero sized requests receive a null pointer.
+///
+/// @param resource The memory resource to allocate the memory blocks with
+/// @param n The number of memory blocks to allocate
+/// @param sizes The sizes of the memory blocks (in bytes)
+/// @param alignment The alignment of all of the memory blocks
+/// @param[out] ptrs The array to store the allocated pointers in
+///
+VECMEM_CORE_EXPORT
+void allocate_bulk(memory_resource& resource, std::size_t n,
+                   const std::size_t* sizes, std::size_t alignment,
+                   void** ptrs);
+
+/// De-allocate multiple memory blocks with a memory resource in one go
+///
+/// @param resource The memory resource that allocated the memory blocks
+/// @param n The number of memory blocks to de-allocate
+/// @param ptrs The pointers to the memory blocks (null ones are ignored)
+/// @param sizes The sizes of the memory blocks (in bytes)
+/// @param alignment The alignment of all of the memory blocks
+///
+VECMEM_CORE_EXPORT
+void deallocate_bulk(memory_resource& resource, std::size_t n,
+                     void* const* ptrs, const std::size_t* sizes,
+                     std::size_t alignment);
+
+/// Tell a memory resource about a number of upcoming allocations
+///
+/// Caching memory resources implementing
+/// @c vecmem::details::bulk_memory_resource may use this hint to acquire the
+/// memory for all of the upcoming allocations in one go. For all other memory
+/// resources this is a no-op.
+///
+/// @param resource The memory resource that will perform the allocations
+/// @param n The number of upcoming allocations
+/// @param sizes The sizes of the upcoming allocations (in bytes)
+/// @param alignment The alignment of all of the upcoming allocations
+///
+VECMEM_CORE_EXPORT
+void reserve_bulk(memory_resource& resource, std::size_t n,
+                  const std::size_t* sizes, std::size_t alignment);
+
+}  // namespace vecmem
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,13 +9,17 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/bulk_memory_resource.hpp"
+#include "vecmem/memory/details/memory_range_provider.hpp"
 #include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
 // System include(s).
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace vecmem {
 
@@ -39,7 +43,11 @@ class contiguous_memory_resource_impl;
  * amount of memory that can be allocated from the contiguous memory
  * resource.
  */
-class contiguous_memory_resource final : public details::memory_resource_base {
+class contiguous_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_range_provider,
+      public details::bulk_memory_resource,
+      public details::memory_space_provider {
 
 public:
     /**
@@ -84,8 +92,52 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_range_provider
+    /// @{
+
+    /// Get the current revision of the owned address ranges
+    VECMEM_CORE_EXPORT
+    std::size_t do_ranges_revision() const noexcept override;
+    /// Get the address ranges owned by the memory resource
+    VECMEM_CORE_EXPORT
+    void do_owned_ranges(std::vector<range>& ranges) const override;
+
+    /// @}
+
+    /// @name Function(s) implementing @c vecmem::details::bulk_memory_resource
+    /// @{
+
+    /// Allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_allocate_bulk(std::size_t n, const std::size_t* sizes,
+                          std::size_t alignment, void** ptrs) override;
+    /// De-allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_deallocate_bulk(std::size_t n, void* const* ptrs,
+                            const std::size_t* sizes,
+                            std::size_t alignment) override;
+    /// Prepare for a number of upcoming allocations
+    VECMEM_CORE_EXPORT
+    void do_reserve_bulk(std::size_t n, const std::size_t* sizes,
+                         std::size_t alignment) override;
+
+    /// @}
+
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// The implementation of the contiguous memory resource.
     std::unique_ptr<details::contiguous_memory_resource_impl> m_impl;
+    /// The kind of memory allocated by the upstream resource
+    memory_space m_space;
 
 };  // class contiguous_memory_resource
 
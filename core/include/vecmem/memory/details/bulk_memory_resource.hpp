@@ -0,0 +1,95 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::details {
+
+/// Interface for memory resources that can serve many allocations at once
+///
+/// Memory resources implementing this interface can allocate/de-allocate a
+/// whole set of memory blocks in a single call, without going through the
+/// full @c vecmem::memory_resource machinery for every single block. Client
+/// code should use the functions from @c vecmem/memory/bulk_allocation.hpp,
+/// which fall back to one-by-one (de-)allocations for memory resources not
+/// implementing this interface.
+///
+class VECMEM_CORE_EXPORT bulk_memory_resource {
+
+public:
+    /// Virtual destructor
+    virtual ~bulk_memory_resource();
+
+    /// Allocate multiple memory blocks at once
+    ///
+    /// Either all of the memory blocks are allocated, or an exception is
+    /// thrown, with none of them allocated. Zero sized requests receive a
+    /// null pointer.
+    ///
+    /// @param n The number of memory blocks to allocate
+    /// @param sizes The sizes of the memory blocks (in bytes)
+    /// @param alignment The alignment of all of the memory blocks
+    /// @param[out] ptrs The array to store the allocated pointers in
+    ///
+    void allocate_bulk(std::size_t n, const std::size_t* sizes,
+                       std::size_t alignment, void** ptrs) {
+        do_allocate_bulk(n, sizes, alignment, ptrs);
+    }
+
+    /// De-allocate multiple memory blocks at once
+    ///
+    /// @param n The number of memory blocks to de-allocate
+    /// @param ptrs The pointers to the memory blocks (null ones are ignored)
+    /// @param sizes The sizes of the memory blocks (in bytes)
+    /// @param alignment The alignment of all of the memory blocks
+    ///
+    void deallocate_bulk(std::size_t n, void* const* ptrs,
+                         const std::size_t* sizes, std::size_t alignment) {
+        do_deallocate_bulk(n, ptrs, sizes, alignment);
+    }
+
+    /// Prepare for a number of upcoming allocations
+    ///
+    /// Caching memory resources may use this hint to acquire all of the
+    /// memory needed for the upcoming allocations in one go. It is not an
+    /// allocation, and it is fine for a memory resource to ignore it.
+    ///
+    /// @param n The number of upcoming allocations
+    /// @param sizes The sizes of the upcoming allocations (in bytes)
+    /// @param alignment The alignment of all of the upcoming allocations
+    ///
+    void reserve_bulk(std::size_t n, const std::size_t* sizes,
+                      std::size_t alignment) {
+        do_reserve_bulk(n, sizes, alignment);
+    }
+
+private:
+    /// @name Function(s) to be implemented by the derived types
+    /// @{
+
+    /// Allocate multiple memory blocks at once
+    virtual void do_allocate_bulk(std::size_t n, const std::size_t* sizes,
+                                  std::size_t alignment, void** ptrs) = 0;
+    /// De-allocate multiple memory blocks at once
+    virtual void do_deallocate_bulk(std::size_t n, void* const* ptrs,
+                                    const std::size_t* sizes,
+                                    std::size_t alignment) = 0;
+    /// Prepare for a number of upcoming allocations (no-op by default)
+    virtual void do_reserve_bulk(std::size_t n, const std::size_t* sizes,
+                                 std::size_t alignment);
+
+    /// @}
+
+};  // class bulk_memory_resource
+
+}  // namespace vecmem::details
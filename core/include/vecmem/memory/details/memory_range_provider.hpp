@@ -0,0 +1,97 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Interface for memory resources that know which address ranges they own
+///
+/// Memory resources that carve their allocations out of a (small) number of
+/// large upstream blocks can advertise those blocks through this interface.
+/// Resources dispatching between multiple upstream resources (like
+/// @c vecmem::coalescing_memory_resource) can then find the owner of a
+/// pointer with a lookup in a small, sorted range table, instead of having to
+/// remember the owner of every single allocation.
+///
+/// Providers should only advertise a small number of long lived blocks, as
+/// clients need to re-build their tables whenever the ranges change. Pointers
+/// that a provider hands out from outside of its advertised ranges (like
+/// one-off allocations of very large blocks) are allowed. Clients check
+/// every allocation against the table, and keep track of the owners of such
+/// pointers themselves.
+///
+class VECMEM_CORE_EXPORT memory_range_provider {
+
+public:
+    /// Description of one contiguous address range
+    struct range {
+        /// The beginning of the address range
+        const void* begin = nullptr;
+        /// The size of the address range in bytes
+        std::size_t size = 0u;
+    };
+
+    /// Virtual destructor
+    virtual ~memory_range_provider();
+
+    /// Get the current revision of the owned address ranges
+    ///
+    /// The revision must change every time that the set of owned address
+    /// ranges changes. Clients use it for deciding when they need to re-query
+    /// the ranges with @c owned_ranges(...).
+    ///
+    /// @return A number identifying the current set of owned ranges
+    ///
+    std::size_t ranges_revision() const noexcept {
+        return do_ranges_revision();
+    }
+
+    /// Get all address ranges owned by the memory resource
+    ///
+    /// @param[out] ranges The vector to append the owned ranges to
+    ///
+    void owned_ranges(std::vector<range>& ranges) const {
+        do_owned_ranges(ranges);
+    }
+
+    /// Get a counter that changes whenever the ranges of any provider change
+    ///
+    /// Clients can use it to skip querying the revisions of their providers
+    /// one by one, for as long as it does not change.
+    ///
+    /// @return A number identifying the state of all providers
+    ///
+    static std::size_t global_ranges_revision() noexcept;
+    /// Signal that the owned address ranges of a provider changed
+    ///
+    /// Providers (or their implementations) must call it after every change
+    /// of their own revision.
+    ///
+    static void ranges_changed() noexcept;
+
+private:
+    /// @name Function(s) to be implemented by the derived types
+    /// @{
+
+    /// Get the current revision of the owned address ranges
+    virtual std::size_t do_ranges_revision() const noexcept = 0;
+    /// Get all address ranges owned by the memory resource
+    virtual void do_owned_ranges(std::vector<range>& ranges) const = 0;
+
+    /// @}
+
+};  // class memory_range_provider
+
+}  // namespace vecmem::details
@@ -0,0 +1,43 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_space.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+namespace vecmem::details {
+
+/// Interface for memory resources that know what kind of memory they allocate
+///
+/// Use @c vecmem::get_memory_space to query the memory space of an arbitrary
+/// memory resource.
+///
+class VECMEM_CORE_EXPORT memory_space_provider {
+
+public:
+    /// Virtual destructor
+    virtual ~memory_space_provider();
+
+    /// Get the kind of memory allocated by the memory resource
+    ///
+    /// @return The memory space of all allocations of the resource
+    ///
+    memory_space space() const noexcept { return do_space(); }
+
+private:
+    /// @name Function(s) to be implemented by the derived types
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    virtual memory_space do_space() const noexcept = 0;
+
+    /// @}
+
+};  // class memory_space_provider
+
+}  // namespace vecmem::details
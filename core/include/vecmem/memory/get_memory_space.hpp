@@ -0,0 +1,25 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/memory_space.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+namespace vecmem {
+
+/// Get the kind of memory allocated by a memory resource
+///
+/// @param resource The memory resource to query
+/// @return The memory space advertised by the resource, or
+///         @c vecmem::memory_space::unknown if it does not advertise one
+///
+VECMEM_CORE_EXPORT
+memory_space get_memory_space(const memory_resource& resource) noexcept;
+
+}  // namespace vecmem
@@ -10,6 +10,7 @@
 
 // Local include(s).
 #include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
 namespace vecmem {
@@ -21,7 +22,9 @@ namespace vecmem {
  * is a terminal resource which does nothing but wrap @c std::aligned_alloc and
  * @c std::free. It is state-free (on the relevant levels of abstraction).
  */
-class host_memory_resource final : public details::memory_resource_base {
+class host_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_space_provider {
 
 public:
     /// Default constructor
@@ -46,6 +49,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // class host_memory_resource
 
 }  // namespace vecmem
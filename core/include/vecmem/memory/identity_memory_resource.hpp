@@ -8,6 +8,7 @@
 
 // Local include(s).
 #include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
@@ -24,7 +25,9 @@ namespace vecmem {
  * This allocator is here to act as the unit in the monoid of memory resources.
  * It serves only a niche practical purpose.
  */
-class identity_memory_resource final : public details::memory_resource_base {
+class identity_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_space_provider {
 
 public:
     /**
@@ -54,6 +57,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// The upstream memory resource to use
     std::reference_wrapper<memory_resource> m_upstream;
 
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -151,6 +151,20 @@ public:
     void add_pre_deallocate_hook(
         std::function<void(void*, std::size_t, std::size_t)> f);
 
+    /**
+     * @brief Add a post-deallocation hook.
+     *
+     * Whenever memory is deallocated, all post-deallocation hooks are
+     * executed after the upstream resource has returned.
+     *
+     * The function passed to this function should accept the pointer that
+     * was deallocated as its first argument, the size of the request as the
+     * second argument, and the alignment as the third.
+     */
+    VECMEM_CORE_EXPORT
+    void add_post_deallocate_hook(
+        std::function<void(void*, std::size_t, std::size_t)> f);
+
 private:
     /// @name Function(s) implementing @c vecmem::memory_resource
     /// @{
@@ -0,0 +1,42 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+namespace vecmem {
+
+/// The kind of memory that some piece of data lives in
+///
+/// Memory resources can advertise the kind of memory that they allocate
+/// through @c vecmem::details::memory_space_provider. Buffers carry this
+/// information through their views, allowing @c vecmem::copy to choose the
+/// right type of copy without querying the pointers at runtime.
+///
+enum class memory_space : unsigned char {
+
+    unknown = 0,  ///< The kind of memory is not known
+    host = 1,     ///< Pageable host memory
+    device = 2,   ///< Memory only accessible from a device
+    shared = 3,   ///< Memory accessible from both the host and a device
+    pinned = 4    ///< Page-locked host memory
+
+};  // enum class memory_space
+
+/// Check whether a memory space is accessible from the host
+///
+/// @param space The memory space to check
+/// @return @c true for host, pinned and shared memory, @c false otherwise
+///
+VECMEM_HOST_AND_DEVICE
+constexpr bool is_host_accessible(memory_space space) {
+    return ((space == memory_space::host) || (space == memory_space::pinned) ||
+            (space == memory_space::shared));
+}
+
+}  // namespace vecmem
@@ -0,0 +1,60 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Scoped guard setting the allocation tag of the current thread
+///
+/// While an object of this type is alive, all allocations made on the
+/// current thread through a @c vecmem::tagging_memory_resource are accounted
+/// to the specified tag. Guards can be nested, the destructor restores the
+/// tag that was active before the guard's construction.
+///
+/// The tag string must remain valid for the lifetime of the guard. (Using
+/// string literals is the simplest way to ensure this.) Tags are interned
+/// when the guard is created, so that the allocations themselves only need
+/// to look up the already resolved tag.
+///
+class VECMEM_CORE_EXPORT scoped_allocation_tag {
+
+public:
+    /// Constructor, setting a new allocation tag for the current thread
+    ///
+    /// @param tag The name of the subsystem/algorithm to account
+    ///            allocations to
+    ///
+    explicit scoped_allocation_tag(const char* tag);
+    /// Destructor, restoring the previous allocation tag
+    ~scoped_allocation_tag();
+
+    /// Disallow copying the guard
+    scoped_allocation_tag(const scoped_allocation_tag&) = delete;
+    /// Disallow copying the guard
+    scoped_allocation_tag& operator=(const scoped_allocation_tag&) = delete;
+
+    /// Get the allocation tag active on the current thread
+    ///
+    /// @return The active tag, or @c nullptr if no tag is active
+    ///
+    static const char* current();
+
+private:
+    /// The tag that was active before this guard was created
+    const char* m_previous;
+    /// The identifier of the tag that was active before this guard
+    std::size_t m_previous_id;
+
+};  // class scoped_allocation_tag
+
+}  // namespace vecmem
@@ -0,0 +1,66 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+namespace vecmem {
+
+/// Scoped guard overriding the default memory resource of the current thread
+///
+/// While an object of this type is alive, all allocations made on the
+/// current thread through the default memory resource (for instance by
+/// default constructed @c vecmem::vector objects) are served by the
+/// specified memory resource. Guards can be nested, the destructor restores
+/// the override that was active before the guard's construction.
+///
+/// To make this possible, the first guard installs a dispatching memory
+/// resource as the process-wide default resource, which forwards allocations
+/// to the current thread's override, or to the previous default resource if
+/// there is no override. The dispatcher remembers which resource allocated
+/// each block, so containers can outlive the guard under which they were
+/// created, and can be destroyed on any thread.
+///
+/// Note that:
+///  - The overriding resource must outlive all memory allocated through it;
+///  - If the overriding resource is not thread-safe, memory allocated with
+///    it must only be released on threads that are allowed to use it;
+///  - Allocations made through the dispatcher carry a small header, holding
+///    the identity of the resource that made the allocation.
+///
+class VECMEM_CORE_EXPORT scoped_default_resource {
+
+public:
+    /// Constructor, overriding the current thread's default resource
+    ///
+    /// @param resource The memory resource to use as the default resource
+    ///
+    explicit scoped_default_resource(memory_resource& resource);
+    /// Destructor, restoring the previous override (if any)
+    ~scoped_default_resource();
+
+    /// Disallow copying the guard
+    scoped_default_resource(const scoped_default_resource&) = delete;
+    /// Disallow copying the guard
+    scoped_default_resource& operator=(const scoped_default_resource&) =
+        delete;
+
+    /// Get the default resource override of the current thread
+    ///
+    /// @return The overriding resource, or @c nullptr if there is none
+    ///
+    static memory_resource* current();
+
+private:
+    /// The override that was active before this guard was created
+    memory_resource* m_previous;
+
+};  // class scoped_default_resource
+
+}  // namespace vecmem
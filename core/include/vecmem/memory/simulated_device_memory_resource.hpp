@@ -0,0 +1,147 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+
+namespace vecmem {
+
+// Forward declaration(s).
+namespace details {
+class simulated_device_memory_resource_impl;
+}
+
+/**
+ * @brief Memory resource simulating device memory on the host.
+ *
+ * The memory handed out by this resource is ordinary host memory, but it is
+ * advertised as @c vecmem::memory_space::device, and (where the platform
+ * allows it) it is protected against any access from the host. Only code
+ * explicitly lifting the protection, like @c vecmem::simulated_device_copy,
+ * can read or write it. Any other access crashes the process, just like a
+ * host access to real device memory would.
+ *
+ * This allows exercising (and benchmarking) the device side code paths of
+ * the library and of its clients on machines without a GPU.
+ *
+ * @note Every allocation is made in (at least) one separate memory page, so
+ * this resource is only meant for testing, not for production use.
+ */
+class simulated_device_memory_resource final
+    : public details::memory_resource_base,
+      public details::memory_space_provider {
+
+public:
+    /// Helper object making a memory range accessible for its lifetime
+    class access_guard {
+
+    public:
+        /// Make a memory range accessible
+        ///
+        /// Memory that does not belong to @c resource is silently ignored.
+        ///
+        /// @param resource The resource that (may have) allocated the memory
+        /// @param ptr The beginning of the memory range
+        /// @param size The size of the memory range in bytes
+        ///
+        VECMEM_CORE_EXPORT
+        access_guard(const simulated_device_memory_resource& resource,
+                     const void* ptr, std::size_t size);
+        /// Disallow copying the guard
+        access_guard(const access_guard&) = delete;
+        /// Protect the memory range again
+        VECMEM_CORE_EXPORT
+        ~access_guard();
+
+        /// Disallow copying the guard
+        access_guard& operator=(const access_guard&) = delete;
+
+    private:
+        /// The resource that allocated the memory
+        const simulated_device_memory_resource& m_resource;
+        /// The beginning of the memory range
+        const void* m_ptr;
+        /// The size of the memory range
+        std::size_t m_size;
+
+    };  // class access_guard
+
+    /**
+     * @brief Constructs the simulated device memory resource.
+     *
+     * @param[in] protect Whether to protect the memory against host access
+     */
+    VECMEM_CORE_EXPORT
+    explicit simulated_device_memory_resource(bool protect = true);
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    simulated_device_memory_resource(
+        simulated_device_memory_resource&& parent) noexcept;
+    /// Disallow copying the memory resource
+    simulated_device_memory_resource(const simulated_device_memory_resource&) =
+        delete;
+
+    /// Destructor
+    VECMEM_CORE_EXPORT
+    ~simulated_device_memory_resource() override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    simulated_device_memory_resource& operator=(
+        simulated_device_memory_resource&& rhs) noexcept;
+    /// Disallow copying the memory resource
+    simulated_device_memory_resource& operator=(
+        const simulated_device_memory_resource&) = delete;
+
+    /// Check whether the memory is really protected against host access
+    ///
+    /// Memory protection is only available on POSIX platforms.
+    ///
+    VECMEM_CORE_EXPORT
+    bool is_protected() const;
+
+    /// Check whether a pointer points into the memory of this resource
+    VECMEM_CORE_EXPORT
+    bool owns(const void* ptr) const;
+
+private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate simulated device memory
+    VECMEM_CORE_EXPORT
+    void* do_allocate(std::size_t, std::size_t) override;
+    /// De-allocate a previously allocated memory block
+    VECMEM_CORE_EXPORT
+    void do_deallocate(void* p, std::size_t, std::size_t) override;
+
+    /// @}
+
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CORE_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
+    /// The implementation of the simulated device memory resource.
+    std::unique_ptr<details::simulated_device_memory_resource_impl> m_impl;
+
+};  // class simulated_device_memory_resource
+
+}  // namespace vecmem
@@ -1,12 +1,13 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/bulk_memory_resource.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
@@ -23,7 +24,9 @@ namespace vecmem {
 /// memory resources that are themselves not thread-safe, but need to be used in
 /// a multi-threaded environment.
 ///
-class synchronized_memory_resource final : public memory_resource {
+class synchronized_memory_resource final
+    : public memory_resource,
+      public details::bulk_memory_resource {
 
 public:
     /// Constructor around an upstream memory resource
@@ -58,6 +61,25 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing @c vecmem::details::bulk_memory_resource
+    /// @{
+
+    /// Allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_allocate_bulk(std::size_t n, const std::size_t* sizes,
+                          std::size_t alignment, void** ptrs) override;
+    /// De-allocate multiple memory blocks at once
+    VECMEM_CORE_EXPORT
+    void do_deallocate_bulk(std::size_t n, void* const* ptrs,
+                            const std::size_t* sizes,
+                            std::size_t alignment) override;
+    /// Prepare for a number of upcoming allocations
+    VECMEM_CORE_EXPORT
+    void do_reserve_bulk(std::size_t n, const std::size_t* sizes,
+                         std::size_t alignment) override;
+
+    /// @}
+
     /// The upstream memory resource
     std::reference_wrapper<memory_resource> m_upstream;
     /// The mutex to synchronize the upstream memory resource's operations
@@ -0,0 +1,127 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vecmem {
+
+// Forward declaration(s).
+namespace details {
+class tagging_memory_resource_impl;
+}
+
+/// Memory resource accounting allocations to subsystems/algorithms
+///
+/// Every allocation made through this resource is attributed to the tag set
+/// on the allocating thread with @c vecmem::scoped_allocation_tag. (And its
+/// de-allocation to the same tag, whichever thread it happens on.) The
+/// resource keeps track of the number of allocations, and the current, total
+/// and peak number of bytes allocated for every tag.
+///
+/// The resource itself is thread safe, but it does not synchronize the calls
+/// to its upstream resource.
+///
+class tagging_memory_resource final : public details::memory_resource_base {
+
+public:
+    /// Name of the tag that untagged allocations are accounted to
+    static constexpr const char* untagged = "<untagged>";
+
+    /// Allocation statistics of a single tag
+    struct VECMEM_CORE_EXPORT tag_statistics {
+
+        /// Default constructor
+        ///
+        /// It is necessary to work around issue:
+        /// https://github.com/llvm/llvm-project/issues/36032
+        ///
+        tag_statistics();
+
+        /// The name of the tag
+        std::string tag;
+        /// The number of allocations made with the tag
+        std::size_t n_allocations = 0u;
+        /// The number of de-allocations made with the tag
+        std::size_t n_deallocations = 0u;
+        /// The total number of bytes allocated with the tag
+        std::size_t total_bytes = 0u;
+        /// The number of bytes currently allocated with the tag
+        std::size_t current_bytes = 0u;
+        /// The largest number of bytes allocated at any time with the tag
+        std::size_t peak_bytes = 0u;
+
+    };  // struct tag_statistics
+
+    /// Constructor on top of an upstream memory resource
+    ///
+    /// @param upstream The memory resource to perform the allocations with
+    ///
+    VECMEM_CORE_EXPORT
+    explicit tagging_memory_resource(memory_resource& upstream);
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    tagging_memory_resource(tagging_memory_resource&& parent) noexcept;
+    /// Disallow copying the memory resource
+    tagging_memory_resource(const tagging_memory_resource&) = delete;
+
+    /// Destructor
+    VECMEM_CORE_EXPORT
+    ~tagging_memory_resource() override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    tagging_memory_resource& operator=(
+        tagging_memory_resource&& rhs) noexcept;
+    /// Disallow copying the memory resource
+    tagging_memory_resource& operator=(const tagging_memory_resource&) =
+        delete;
+
+    /// Get the statistics of all tags seen so far
+    ///
+    /// @return The statistics of each tag, ordered by decreasing peak memory
+    ///         usage
+    ///
+    VECMEM_CORE_EXPORT
+    std::vector<tag_statistics> statistics() const;
+
+    /// Print a human readable report of the statistics of all tags
+    ///
+    /// @param out The stream to print the report to
+    ///
+    VECMEM_CORE_EXPORT
+    void report(std::ostream& out) const;
+
+private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory with the upstream resource
+    VECMEM_CORE_EXPORT
+    void* do_allocate(std::size_t, std::size_t) override;
+    /// De-allocate a previously allocated memory block
+    VECMEM_CORE_EXPORT
+    void do_deallocate(void* p, std::size_t, std::size_t) override;
+
+    /// @}
+
+    /// Object implementing the memory resource's logic
+    std::unique_ptr<details::tagging_memory_resource_impl> m_impl;
+
+};  // class tagging_memory_resource
+
+}  // namespace vecmem
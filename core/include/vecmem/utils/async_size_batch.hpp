@@ -0,0 +1,84 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/size_batch.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <memory>
+
+namespace vecmem {
+
+/// Return type for asynchronous size batch retrievals
+///
+/// The individual sizes are accessed through the handles received while
+/// setting up the @c vecmem::size_batch object.
+///
+class VECMEM_CORE_EXPORT async_size_batch : public abstract_event {
+
+public:
+    /// Size type used
+    using size_type = size_batch::size_type;
+    /// Underlying type that stores the size variables on the heap
+    using storage_type = vector<size_type>;
+    /// Type of the held event
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Constructor taking ownership of the sizes and an event
+    ///
+    /// @param sizes The vector holding the size variables
+    /// @param event Event to wait on before accessing the sizes
+    ///
+    async_size_batch(storage_type&& sizes, event_type event);
+
+    /// Access a single size, after waiting for the retrieval to finish
+    size_type get(const size_batch::size_handle& handle) const;
+    /// Access the sizes of a jagged vector, after waiting for the
+    /// retrieval to finish
+    data::vector_view<const size_type> get(
+        const size_batch::sizes_handle& handle) const;
+
+    /// Access a single size without waiting for completion
+    /// Completion must be ensured by the user
+    size_type unsafe_get(const size_batch::size_handle& handle) const;
+    /// Access the sizes of a jagged vector without waiting for completion
+    /// Completion must be ensured by the user
+    data::vector_view<const size_type> unsafe_get(
+        const size_batch::sizes_handle& handle) const;
+
+    /// @name Function(s) implemented from @c vecmem::abstract_event
+    /// @{
+
+    /// Function that would block the current thread until the event is
+    /// complete
+    void wait() override;
+
+    /// Function checking whether the event is complete without blocking
+    ///
+    /// @return true if the event is complete, false otherwise
+    ///
+    bool is_ready() const override;
+
+    /// Function telling the object not to wait for the underlying event
+    void ignore() override;
+
+    /// @}
+
+private:
+    /// Size storage
+    storage_type m_sizes;
+    /// Underlying event
+    event_type m_event;
+
+};  // class async_size_batch
+
+}  // namespace vecmem
@@ -0,0 +1,160 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/buffer_type.hpp"
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/edm/buffer.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <vector>
+
+namespace vecmem {
+
+// Forward declaration(s).
+class copy;
+
+/// Cache of buffers, for re-using them between @c vecmem::copy::to calls
+///
+/// Code copying containers of the same shape over and over again (like
+/// copying every event's data to a device) would allocate, and set up, the
+/// same buffers again and again with @c vecmem::copy::to. Buffers given back
+/// to this cache with @c release(...) are instead handed out again by the
+/// @c vecmem::copy::to overloads receiving a cache, whenever a buffer of the
+/// exact same type, buffer type and capacities is needed.
+///
+/// All buffers of a cache are allocated with the memory resource(s) given
+/// to its constructor. Released buffers must come from the same resource(s).
+///
+/// The cache itself is thread safe, but the buffers released to it must no
+/// longer be used by any (asynchronous) operation.
+///
+class buffer_cache {
+
+public:
+    /// Constructor with the memory resource(s) to allocate the buffers with
+    ///
+    /// @param resource The (device accessible) memory resource
+    /// @param host_access_resource An optional host accessible memory
+    ///        resource, needed for jagged buffers if @c resource is not host
+    ///        accessible
+    ///
+    VECMEM_CORE_EXPORT
+    explicit buffer_cache(memory_resource& resource,
+                          memory_resource* host_access_resource = nullptr);
+    /// Disallow copying the cache
+    buffer_cache(const buffer_cache&) = delete;
+    /// Destructor
+    VECMEM_CORE_EXPORT
+    ~buffer_cache();
+
+    /// Disallow copying the cache
+    buffer_cache& operator=(const buffer_cache&) = delete;
+
+    /// The memory resource used for the buffers
+    VECMEM_CORE_EXPORT
+    memory_resource& resource() const;
+    /// The host accessible memory resource used for the buffers
+    VECMEM_CORE_EXPORT
+    memory_resource* host_access_resource() const;
+
+    /// Give a 1D buffer back to the cache
+    template <typename TYPE>
+    void release(data::vector_buffer<TYPE>&& buffer);
+    /// Give a jagged buffer back to the cache
+    template <typename TYPE>
+    void release(data::jagged_vector_buffer<TYPE>&& buffer);
+    /// Give a SoA buffer back to the cache
+    template <typename SCHEMA>
+    void release(edm::buffer<SCHEMA>&& buffer);
+
+    /// The number of buffers currently held by the cache
+    VECMEM_CORE_EXPORT
+    std::size_t size() const;
+    /// Free all of the buffers held by the cache
+    VECMEM_CORE_EXPORT
+    void clear();
+
+private:
+    /// The copy class is the one taking buffers from the cache
+    friend class copy;
+
+    /// Key identifying the shape of a buffer
+    struct key {
+        /// The type of the buffer
+        std::type_index m_type;
+        /// The type (fixed size / resizable) of the buffer
+        data::buffer_type m_buffer_type;
+        /// The capacities of the buffer
+        std::vector<std::size_t> m_capacities;
+    };  // struct key
+
+    /// Base class of the type erased holders of the buffers
+    struct holder_base {
+        /// Virtual destructor
+        virtual ~holder_base() = default;
+    };  // struct holder_base
+
+    /// Type erased holder of a buffer
+    template <typename BUFFER>
+    struct holder : public holder_base {
+        /// Constructor with the buffer to hold on to
+        explicit holder(BUFFER&& buffer) : m_buffer(std::move(buffer)) {}
+        /// The buffer
+        BUFFER m_buffer;
+    };  // struct holder
+
+    /// Make the key of a buffer with a given shape
+    template <typename BUFFER>
+    static key make_key(data::buffer_type btype,
+                        std::vector<std::size_t>&& capacities);
+
+    /// Take a buffer with the given shape from the cache
+    ///
+    /// @return The cached buffer, or an empty buffer if there was none
+    ///
+    template <typename BUFFER>
+    BUFFER take(const key& k);
+
+    /// Store a buffer in the cache
+    VECMEM_CORE_EXPORT
+    void put(key&& k, std::unique_ptr<holder_base> buffer);
+    /// Take a stored buffer from the cache
+    VECMEM_CORE_EXPORT
+    std::unique_ptr<holder_base> take_holder(const key& k);
+
+    /// One entry in the cache
+    struct entry {
+        /// The key of the buffer
+        key m_key;
+        /// The buffer
+        std::unique_ptr<holder_base> m_buffer;
+    };  // struct entry
+
+    /// The memory resource used for the buffers
+    memory_resource& m_resource;
+    /// The host accessible memory resource used for the buffers
+    memory_resource* m_host_access_resource;
+    /// The cached buffers
+    std::vector<entry> m_entries;
+    /// Mutex protecting the cached buffers
+    mutable std::mutex m_mutex;
+
+};  // class buffer_cache
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/buffer_cache.ipp"
@@ -1,13 +1,15 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 #pragma once
 
 // VecMem include(s).
+#include "vecmem/containers/data/borrowed_buffer.hpp"
+#include "vecmem/containers/data/flat_jagged_buffer.hpp"
 #include "vecmem/containers/data/jagged_vector_buffer.hpp"
 #include "vecmem/containers/data/jagged_vector_view.hpp"
 #include "vecmem/containers/data/vector_buffer.hpp"
@@ -18,20 +20,32 @@
 #include "vecmem/edm/host.hpp"
 #include "vecmem/edm/view.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/memory_space.hpp"
 #include "vecmem/utils/abstract_event.hpp"
 #include "vecmem/utils/async_size.hpp"
+#include "vecmem/utils/async_size_batch.hpp"
 #include "vecmem/utils/async_sizes.hpp"
 #include "vecmem/utils/attributes.hpp"
+#include "vecmem/utils/buffer_cache.hpp"
+#include "vecmem/utils/copy_plan.hpp"
+#include "vecmem/utils/copy_region.hpp"
+#include "vecmem/utils/details/copy_staging.hpp"
+#include "vecmem/utils/size_batch.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
 // System include(s).
+#include <bitset>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace vecmem {
 
+// Forward declaration(s).
+class copy_observer;
+
 /// Class implementing (synchronous) host <-> device memory copies
 ///
 /// Since most of the logic of explicitly copying the payload of vecmem
@@ -72,6 +86,16 @@ public:
     /// Event type used by the copy class
     using event_type = std::unique_ptr<abstract_event>;
 
+    /// Range of elements to copy with the slice copy operators
+    struct slice {
+        /// Index of the first (outer) element to copy from the source
+        std::size_t begin = 0u;
+        /// Index one past the last (outer) element to copy from the source
+        std::size_t end = 0u;
+        /// Index of the target element to copy the first element into
+        std::size_t offset = 0u;
+    };  // struct slice
+
     /// @name 1-dimensional vector data handling functions
     /// @{
 
@@ -93,6 +117,64 @@ public:
         const data::vector_view<TYPE>& data, memory_resource& resource,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a 1-dimensional vector to the specified memory resource, without
+    /// waiting for the copy to finish
+    ///
+    /// The buffer must not be used before the returned event completes.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD
+        std::pair<data::vector_buffer<std::remove_cv_t<TYPE>>, event_type>
+        to_async(const data::vector_view<TYPE>& data,
+                 memory_resource& resource,
+                 type::copy_type cptype = type::unknown) const;
+
+    /// Copy a 1-dimensional vector into an existing buffer, if possible
+    ///
+    /// The buffer is re-used if it was allocated from @c resource, and if it
+    /// can hold the data. Fixed sized buffers need to have exactly the size
+    /// of the source for this, resizable ones at least that capacity.
+    /// Otherwise the buffer is re-created (keeping its type) with the needed
+    /// capacity.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD event_type
+    to_into(const data::vector_view<TYPE>& data,
+            data::vector_buffer<std::remove_cv_t<TYPE>>& target,
+            memory_resource& resource,
+            type::copy_type cptype = type::unknown) const;
+
+    /// Copy a 1-dimensional vector into a buffer taken from a cache
+    ///
+    /// The buffer should be given back to the cache with
+    /// @c vecmem::buffer_cache::release once it is no longer needed.
+    ///
+    template <typename TYPE>
+    data::vector_buffer<std::remove_cv_t<TYPE>> to(
+        const data::vector_view<TYPE>& data, buffer_cache& cache,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Make a 1-dimensional vector available in the specified memory
+    /// resource, without copying it if possible
+    ///
+    /// If the memory of @c data is usable in place of memory allocated by
+    /// @c resource (see @c can_borrow), the returned buffer just refers to
+    /// that memory, keeping @c owner alive. Otherwise it holds a copy of the
+    /// data, made with @c to(...).
+    ///
+    /// @param data The data to make available
+    /// @param owner Handle to the owner of all memory referenced by @c data
+    ///        (may be null if the caller keeps it alive by other means)
+    /// @param resource The memory resource to copy the data to if needed
+    /// @param cptype The type of the copy, if it needs to be made
+    /// @return A read-only buffer with the data
+    ///
+    template <typename TYPE>
+    data::borrowed_buffer<data::vector_view<std::add_const_t<TYPE>>>
+    to_borrowed(const data::vector_view<TYPE>& data,
+                std::shared_ptr<const void> owner, memory_resource& resource,
+                type::copy_type cptype = type::unknown) const;
+
     /// Copy a 1-dimensional vector's data between two existing memory blocks
     template <typename TYPE>
     VECMEM_NODISCARD event_type
@@ -100,6 +182,29 @@ public:
                data::vector_view<TYPE> to,
                type::copy_type cptype = type::unknown) const;
 
+    /// Copy a range of elements between two 1-dimensional vectors
+    ///
+    /// The range has to be within the size of the source. Resizable
+    /// targets get their size set to <tt>offset + (end - begin)</tt>.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD event_type
+    operator()(const data::vector_view<std::add_const_t<TYPE>>& from,
+               data::vector_view<TYPE> to, const slice& range,
+               type::copy_type cptype = type::unknown) const;
+
+    /// Copy multiple ranges of elements between two 1-dimensional vectors
+    ///
+    /// The ranges are copied as a single batch. Each of them has to be within
+    /// the size of the source and the capacity of the target. Unlike with the
+    /// single range copy, the size of resizable targets is not modified.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD event_type
+    operator()(const data::vector_view<std::add_const_t<TYPE>>& from,
+               data::vector_view<TYPE> to, const std::vector<slice>& ranges,
+               type::copy_type cptype = type::unknown) const;
+
     /// Copy a 1-dimensional vector's data into a vector object
     template <typename TYPE, typename ALLOC>
     VECMEM_NODISCARD event_type
@@ -141,6 +246,72 @@ public:
         memory_resource* host_access_resource = nullptr,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a jagged vector to the specified memory resource, without
+    /// waiting for the copy to finish
+    ///
+    /// The buffer must not be used before the returned event completes.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD
+        std::pair<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>,
+                  event_type>
+        to_async(const data::jagged_vector_view<TYPE>& data,
+                 memory_resource& resource,
+                 memory_resource* host_access_resource = nullptr,
+                 type::copy_type cptype = type::unknown) const;
+
+    /// Copy a jagged vector into an existing buffer, if possible
+    ///
+    /// The buffer is re-used if it was allocated from the same memory
+    /// resource(s), and if it can hold the data. Its inner capacities need
+    /// to match the capacities of the source exactly if it's fixed sized,
+    /// resizable buffers may have larger inner capacities. Otherwise the
+    /// buffer is re-created, like @c to(...) would.
+    ///
+    template <typename TYPE>
+    VECMEM_NODISCARD event_type
+    to_into(const data::jagged_vector_view<TYPE>& data,
+            data::jagged_vector_buffer<std::remove_cv_t<TYPE>>& target,
+            memory_resource& resource,
+            memory_resource* host_access_resource = nullptr,
+            type::copy_type cptype = type::unknown) const;
+
+    /// Copy a jagged vector into a buffer taken from a cache
+    template <typename TYPE>
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> to(
+        const data::jagged_vector_view<TYPE>& data, buffer_cache& cache,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Make a jagged vector available in the specified memory resource,
+    /// without copying it if possible
+    ///
+    /// @see to_borrowed(const data::vector_view<TYPE>&,
+    ///                  std::shared_ptr<const void>, memory_resource&,
+    ///                  type::copy_type)
+    ///
+    template <typename TYPE>
+    data::borrowed_buffer<data::jagged_vector_view<std::add_const_t<TYPE>>>
+    to_borrowed(const data::jagged_vector_view<TYPE>& data,
+                std::shared_ptr<const void> owner, memory_resource& resource,
+                memory_resource* host_access_resource = nullptr,
+                type::copy_type cptype = type::unknown) const;
+
+    /// Copy a jagged vector into a compact, flat buffer
+    ///
+    /// The inner vectors are copied back to back into a single allocation,
+    /// in one batch, using their sizes (not their capacities). This allows
+    /// any later transfers of the data to happen with a single copy.
+    ///
+    /// @param data The jagged vector to flatten
+    /// @param resource The memory resource to allocate the result with
+    /// @param cptype The type of the copy of the inner vectors
+    /// @return The elements of the inner vectors, and their offsets
+    ///
+    template <typename TYPE>
+    data::flat_jagged_buffer<std::remove_cv_t<TYPE>> flatten(
+        const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
+        type::copy_type cptype = type::unknown) const;
+
     /// Copy a jagged vector's data between two existing allocations
     template <typename TYPE>
     VECMEM_NODISCARD event_type
@@ -148,6 +319,13 @@ public:
                data::jagged_vector_view<TYPE> to,
                type::copy_type cptype = type::unknown) const;
 
+    /// Copy a range of inner vectors between two jagged vectors
+    template <typename TYPE>
+    VECMEM_NODISCARD event_type
+    operator()(const data::jagged_vector_view<std::add_const_t<TYPE>>& from,
+               data::jagged_vector_view<TYPE> to, const slice& range,
+               type::copy_type cptype = type::unknown) const;
+
     /// Copy a jagged vector's data into a vector object
     template <typename TYPE, typename ALLOC1, typename ALLOC2>
     VECMEM_NODISCARD event_type
@@ -195,6 +373,56 @@ public:
         memory_resource* host_access_resource = nullptr,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a container to the specified memory resource, without waiting
+    /// for the copy to finish
+    ///
+    /// The buffer must not be used before the returned event completes.
+    ///
+    template <typename... VARTYPES>
+    VECMEM_NODISCARD std::pair<
+        edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>,
+        event_type>
+    to_async(const edm::view<edm::schema<VARTYPES...>>& data,
+             memory_resource& resource,
+             memory_resource* host_access_resource = nullptr,
+             type::copy_type cptype = type::unknown) const;
+
+    /// Copy a container into an existing buffer, if possible
+    ///
+    /// The rules for re-using the buffer are the same as for the 1D and
+    /// jagged vector overloads. Buffers with jagged vectors additionally
+    /// need to have exactly the outer capacity of the source.
+    ///
+    template <typename... VARTYPES>
+    VECMEM_NODISCARD event_type to_into(
+        const edm::view<edm::schema<VARTYPES...>>& data,
+        edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>&
+            target,
+        memory_resource& resource,
+        memory_resource* host_access_resource = nullptr,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Copy a container into a buffer taken from a cache
+    template <typename... VARTYPES>
+    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> to(
+        const edm::view<edm::schema<VARTYPES...>>& data, buffer_cache& cache,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Make a container available in the specified memory resource, without
+    /// copying it if possible
+    ///
+    /// @see to_borrowed(const data::vector_view<TYPE>&,
+    ///                  std::shared_ptr<const void>, memory_resource&,
+    ///                  type::copy_type)
+    ///
+    template <typename... VARTYPES>
+    data::borrowed_buffer<
+        edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>>
+    to_borrowed(const edm::view<edm::schema<VARTYPES...>>& data,
+                std::shared_ptr<const void> owner, memory_resource& resource,
+                memory_resource* host_access_resource = nullptr,
+                type::copy_type cptype = type::unknown) const;
+
     /// Copy between two views
     template <typename... VARTYPES>
     VECMEM_NODISCARD event_type operator()(
@@ -203,6 +431,18 @@ public:
         edm::view<edm::schema<VARTYPES...>> to,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a range of elements between two views
+    ///
+    /// Only the (jagged) vector variables are copied, scalar variables are
+    /// left untouched.
+    ///
+    template <typename... VARTYPES>
+    VECMEM_NODISCARD event_type operator()(
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to, const slice& range,
+        type::copy_type cptype = type::unknown) const;
+
     /// Copy from a view, into a host container
     template <typename... VARTYPES, template <typename> class INTERFACE>
     VECMEM_NODISCARD event_type operator()(
@@ -211,6 +451,44 @@ public:
         edm::host<edm::schema<VARTYPES...>, INTERFACE>& to,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy some of the variables between two views
+    ///
+    /// The size of a resizable target without jagged vectors is only set
+    /// if at least one of its (non-jagged) vector variables is selected.
+    ///
+    template <std::size_t... INDICES, typename... VARTYPES>
+    VECMEM_NODISCARD event_type operator()(
+        std::index_sequence<INDICES...> columns,
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Copy some of the variables between two views, selected at runtime
+    template <typename... VARTYPES>
+    VECMEM_NODISCARD event_type operator()(
+        const std::bitset<sizeof...(VARTYPES)>& columns,
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Copy some of the variables of a container to the specified memory
+    /// resource
+    ///
+    /// The returned buffer only holds the selected variables. Copying into
+    /// such an existing buffer can be done with the help of
+    /// @c vecmem::edm::select.
+    ///
+    template <std::size_t... INDICES, typename... VARTYPES>
+    edm::buffer<edm::details::remove_cv_t<
+        edm::details::select_t<edm::schema<VARTYPES...>, INDICES...>>>
+    to(std::index_sequence<INDICES...> columns,
+       const edm::view<edm::schema<VARTYPES...>>& data,
+       memory_resource& resource,
+       memory_resource* host_access_resource = nullptr,
+       type::copy_type cptype = type::unknown) const;
+
     /// Get the (outer) size of a (resizable) SoA container
     template <typename... VARTYPES>
     typename edm::view<edm::schema<VARTYPES...>>::size_type get_size(
@@ -236,32 +514,276 @@ public:
 
     /// @}
 
+    /// @name Size batch handling functions
+    /// @{
+
+    /// Get all sizes registered in a batch into one block of pinned host
+    /// memory, with a single synchronization
+    VECMEM_NODISCARD async_size_batch get_sizes(
+        const size_batch& batch, memory_resource& pinnedHostMr) const;
+
+    /// @}
+
+    /// @name Copy plan handling functions
+    /// @{
+
+    /// Create a plan for repeated copies between two jagged vectors
+    template <typename TYPE>
+    copy_plan make_plan(
+        const data::jagged_vector_view<std::add_const_t<TYPE>>& from,
+        data::jagged_vector_view<TYPE> to,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Create a plan for repeated copies between two SoA containers
+    template <typename... VARTYPES>
+    copy_plan make_plan(
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Execute a previously created copy plan
+    VECMEM_NODISCARD event_type operator()(const copy_plan& plan) const;
+
+    /// @}
+
+    /// @name Copy type handling functions
+    /// @{
+
+    /// Deduce the type of a copy from the memory spaces involved in it
+    ///
+    /// Explicitly specified copy types are returned as they are. (Debug
+    /// builds with debug messages enabled report explicit copy types that
+    /// contradict the memory spaces.) @c type::unknown is replaced by the
+    /// copy type matching the memory spaces, if both of them are known.
+    ///
+    /// @param from The memory space of the copy's source
+    /// @param to The memory space of the copy's target
+    /// @param cptype The copy type specified by the user
+    /// @return The copy type to use
+    ///
+    static type::copy_type deduce_copy_type(
+        memory_space from, memory_space to,
+        type::copy_type cptype = type::unknown);
+
+    /// Check whether data could be used in place of a copy of it
+    ///
+    /// Only host accessible data can be borrowed, if its memory space is the
+    /// same as the target's, or if the target is (pageable) host memory.
+    /// Unknown memory spaces are taken to be host memory if @c cptype is
+    /// @c type::host_to_host. Any other explicit copy type prevents
+    /// borrowing.
+    ///
+    /// @param from The memory space of the data
+    /// @param to The memory space of the target
+    /// @param cptype The copy type specified by the user
+    /// @return @c true if the data can be used in place of a copy
+    ///
+    static bool can_borrow(memory_space from, memory_space to,
+                           type::copy_type cptype = type::unknown);
+
+    /// @}
+
+    /// @name Instrumentation functions
+    /// @{
+
+    /// Set the observer to notify about the low level operations
+    ///
+    /// The observer is notified about every memory copy, memory filling and
+    /// event creation that this object asks its backend for. Without an
+    /// observer (the default), this costs just a pointer check per
+    /// operation.
+    ///
+    /// The observer is not owned by this object, it must stay alive while it
+    /// is set. Copies of this object share the observer. It must not be
+    /// changed while other threads are using the object.
+    ///
+    /// @param observer The observer to use, or @c nullptr to disable the
+    ///        notifications
+    ///
+    void set_observer(copy_observer* observer);
+    /// Get the observer notified about the low level operations
+    copy_observer* observer() const;
+
+    /// @}
+
 protected:
     /// Perform a "low level" memory copy
     virtual void do_copy(std::size_t size, const void* from, void* to,
                          type::copy_type cptype) const;
+    /// Perform a "low level" copy of many independent memory regions
+    ///
+    /// The default implementation calls @c do_copy for every region.
+    /// Backends able to perform such copies natively should override it.
+    ///
+    virtual void do_copy_batch(std::size_t n, const copy_region* regions,
+                               type::copy_type cptype) const;
+    /// The largest gap (in bytes) worth copying to merge two copy regions
+    ///
+    /// Only used when the gaps between the regions are known to be unused
+    /// memory, inside the same allocations.
+    ///
+    virtual std::size_t max_copy_padding() const;
     /// Perform a "low level" memory filling operation
     virtual void do_memset(std::size_t size, void* ptr, int value) const;
     /// Create an event for synchronization
     VECMEM_NODISCARD virtual event_type create_event() const;
 
+    /// Wait for all operations that may still use staged host values
+    ///
+    /// Classes whose events depend on their own state need to call this in
+    /// their destructor. Since events that the user ignored may still be
+    /// tracked by the object at that point.
+    ///
+    void wait_for_staged_operations() const;
+
 private:
+    /// Merge neighbouring copy regions in place
+    ///
+    /// @param regions The regions to merge
+    /// @param max_gap The largest gap (in bytes) to merge regions over
+    ///
+    static void merge_copy_regions(std::vector<copy_region>& regions,
+                                   std::size_t max_gap);
+    /// The type of a copy from host memory into the target of a copy
+    static type::copy_type host_copy_type(type::copy_type cptype);
+    /// Check that a slice copy is possible between two containers
+    ///
+    /// @param range The range of elements to copy
+    /// @param from_size The size of the source container (its capacity if it
+    ///                  is not resizable)
+    /// @param to_capacity The capacity of the target container
+    ///
+    static void check_slice(const slice& range, std::size_t from_size,
+                            std::size_t to_capacity);
+    /// Merge neighbouring copy regions, and copy them with @c do_copy_batch
+    ///
+    /// @param regions The regions to copy (modified by the function)
+    /// @param cptype The type of the copy operation
+    /// @param allow_padding Whether the gaps between the regions may be
+    ///                      copied as well
+    ///
+    void copy_batch(std::vector<copy_region>& regions, type::copy_type cptype,
+                    bool allow_padding) const;
+
+    /// @name Functions forwarding the low level operations to the backend
+    ///
+    /// These call the virtual "do" functions, notifying the observer about
+    /// the operations if one is set.
+    ///
+    /// @{
+
+    /// Perform a memory copy with @c do_copy
+    void issue_copy(std::size_t size, const void* from, void* to,
+                    type::copy_type cptype) const;
+    /// Perform a batched memory copy with @c do_copy_batch
+    void issue_copy_batch(std::size_t n, const copy_region* regions,
+                          type::copy_type cptype) const;
+    /// Perform a memory filling operation with @c do_memset
+    void issue_memset(std::size_t size, void* ptr, int value) const;
+    /// Create an event with @c create_event
+    VECMEM_NODISCARD event_type issue_event() const;
+
+    /// Perform a memory copy, notifying the observer
+    void observed_copy(std::size_t size, const void* from, void* to,
+                       type::copy_type cptype) const;
+    /// Perform a batched memory copy, notifying the observer
+    void observed_copy_batch(std::size_t n, const copy_region* regions,
+                             type::copy_type cptype) const;
+    /// Perform a memory filling operation, notifying the observer
+    void observed_memset(std::size_t size, void* ptr, int value) const;
+    /// Create an event, notifying the observer
+    VECMEM_NODISCARD event_type observed_event() const;
+
+    /// @}
+
+    /// Create a buffer for copying a jagged vector into
+    template <typename TYPE>
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> make_buffer(
+        const std::vector<typename data::vector_view<TYPE>::size_type>&
+            capacities,
+        memory_resource& resource, memory_resource* host_access_resource,
+        data::buffer_type btype) const;
+    /// Create a buffer for copying a container into
+    template <typename... VARTYPES>
+    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>
+    make_buffer(const edm::view<edm::schema<VARTYPES...>>& data,
+                memory_resource& resource,
+                memory_resource* host_access_resource,
+                data::buffer_type btype) const;
+    /// Check whether a buffer's capacities are suitable for a copy
+    ///
+    /// @param target The capacities of the buffer
+    /// @param needed The capacities needed for the copy
+    /// @param resizable Whether the buffer is resizable
+    ///
+    template <typename SIZE_TYPE>
+    static bool capacities_suffice(const std::vector<SIZE_TYPE>& target,
+                                   const std::vector<SIZE_TYPE>& needed,
+                                   bool resizable);
+
+    /// Read the sizes of a jagged vector into an existing host vector
+    template <typename TYPE>
+    void read_sizes(
+        const data::jagged_vector_view<TYPE>& data,
+        std::vector<typename data::vector_view<TYPE>::size_type>& sizes) const;
+
     /// Implementation for the 1D vector copy operator
+    ///
+    /// If @c regions is not null, the payload copy is only recorded in it,
+    /// instead of being performed right away.
+    ///
     template <typename TYPE>
     bool copy_view_impl(const data::vector_view<std::add_const_t<TYPE>>& from,
-                        data::vector_view<TYPE> to,
-                        type::copy_type cptype) const;
+                        data::vector_view<TYPE> to, type::copy_type cptype,
+                        details::copy_staging::batch& staged,
+                        std::vector<copy_region>* regions = nullptr) const;
+    /// Implementation for the 1D vector slice copy operator
+    template <typename TYPE>
+    void slice_view_impl(const data::vector_view<std::add_const_t<TYPE>>& from,
+                         data::vector_view<TYPE> to, const slice& range,
+                         type::copy_type cptype,
+                         details::copy_staging::batch& staged,
+                         std::vector<copy_region>* regions = nullptr) const;
+    /// Implementation for the jagged vector slice copy operator
+    template <typename TYPE>
+    void slice_view_impl(
+        const data::jagged_vector_view<std::add_const_t<TYPE>>& from,
+        data::jagged_vector_view<TYPE> to, const slice& range,
+        type::copy_type cptype, details::copy_staging::batch& staged) const;
     /// Implementation of the jagged vector copy operator
     template <typename TYPE>
     bool copy_view_impl(
         const data::jagged_vector_view<std::add_const_t<TYPE>>& from,
-        data::jagged_vector_view<TYPE> to, type::copy_type cptype) const;
+        data::jagged_vector_view<TYPE> to, type::copy_type cptype,
+        details::copy_staging::batch& staged) const;
+    /// Check whether some sizes can be set on a jagged vector
+    ///
+    /// @return Whether the jagged vector is resizable
+    ///
+    template <typename TYPE>
+    static bool check_sizes(
+        const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+        const data::jagged_vector_view<TYPE>& data);
+    /// Implementation for setting the sizes of a resizable jagged vector
+    ///
+    /// The sizes are copied from staging memory if @c staged is not null,
+    /// and directly from @c sizes otherwise.
+    ///
+    /// @return Whether a copy operation was issued
+    ///
+    template <typename TYPE>
+    bool set_sizes_impl(
+        const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+        data::jagged_vector_view<TYPE> data,
+        details::copy_staging::batch* staged) const;
     /// Helper function performing the copy of a jagged array/vector
     template <typename TYPE>
     void copy_views_impl(
         const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
         const data::vector_view<std::add_const_t<TYPE>>* from,
-        data::vector_view<TYPE>* to, type::copy_type cptype) const;
+        data::vector_view<TYPE>* to, type::copy_type cptype,
+        bool allow_padding) const;
     /// Helper function performing the copy of a jagged array/vector
     template <typename TYPE>
     void copy_views_contiguous_impl(
@@ -272,6 +794,10 @@ private:
     template <typename TYPE>
     static bool is_contiguous(const data::vector_view<TYPE>* data,
                               std::size_t size);
+    /// Check if a vector of views have their sizes in one contiguous array
+    template <typename TYPE>
+    static bool has_contiguous_sizes(const data::vector_view<TYPE>* data,
+                                     std::size_t size);
     /// Implementation for the variadic @c memset function
     template <std::size_t INDEX, typename... VARTYPES>
     void memset_impl(edm::view<edm::schema<VARTYPES...>> data, int value) const;
@@ -288,13 +814,54 @@ private:
     void copy_sizes_impl(
         const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
             from,
-        edm::view<edm::schema<VARTYPES...>> to, type::copy_type cptype) const;
+        edm::view<edm::schema<VARTYPES...>> to, type::copy_type cptype,
+        details::copy_staging::batch& staged) const;
     /// Implementation for the variadic @c copy function (for the payload)
     template <std::size_t INDEX, typename... VARTYPES>
     void copy_payload_impl(
         const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
             from,
-        edm::view<edm::schema<VARTYPES...>> to, type::copy_type cptype) const;
+        edm::view<edm::schema<VARTYPES...>> to, type::copy_type cptype,
+        const std::bitset<sizeof...(VARTYPES)>& columns,
+        details::copy_staging::batch& staged,
+        std::vector<copy_region>& regions) const;
+    /// Add the copy of a 1D vector to a copy plan
+    template <typename TYPE>
+    void plan_view_impl(
+        copy_plan& plan,
+        const data::vector_view<std::add_const_t<TYPE>>& from,
+        data::vector_view<TYPE> to) const;
+    /// Add the copy of a jagged vector to a copy plan
+    template <typename TYPE>
+    void plan_view_impl(
+        copy_plan& plan,
+        const data::jagged_vector_view<std::add_const_t<TYPE>>& from,
+        data::jagged_vector_view<TYPE> to) const;
+    /// Implementation for the variadic @c make_plan function (for the sizes)
+    template <std::size_t INDEX, typename... VARTYPES>
+    void plan_sizes_impl(
+        copy_plan& plan,
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to) const;
+    /// Implementation for the variadic @c make_plan function (for the
+    /// payload)
+    template <std::size_t INDEX, typename... VARTYPES>
+    void plan_payload_impl(
+        copy_plan& plan,
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to) const;
+    /// Finish setting up a copy plan, making it valid
+    static void finalize_plan(copy_plan& plan);
+    /// Implementation for the variadic slice copy operator
+    template <std::size_t INDEX, typename... VARTYPES>
+    void slice_payload_impl(
+        const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+            from,
+        edm::view<edm::schema<VARTYPES...>> to, const slice& range,
+        type::copy_type cptype, details::copy_staging::batch& staged,
+        std::vector<copy_region>& regions) const;
     /// Implementation for the variadic @c get_sizes function
     template <std::size_t INDEX, typename... VARTYPES>
     std::vector<data::vector_view<int>::size_type> get_sizes_impl(
@@ -305,6 +872,12 @@ private:
         const edm::view<edm::schema<VARTYPES...>>& from,
         memory_resource& pinnedHostMr) const;
 
+    /// Persistent storage for the host values staged by copy operations
+    std::shared_ptr<details::copy_staging> m_staging =
+        std::make_shared<details::copy_staging>();
+    /// The observer notified about the low level operations
+    copy_observer* m_observer = nullptr;
+
 };  // class copy
 
 }  // namespace vecmem
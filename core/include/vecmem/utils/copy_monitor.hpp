@@ -0,0 +1,99 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/copy_observer.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace vecmem {
+
+/// Observer collecting statistics about the operations of @c vecmem::copy
+///
+/// The statistics of the (batched) memory copies are collected separately
+/// for every copy type, and those of the memory filling operations
+/// separately from them. Besides the total number of calls, bytes and time,
+/// the sizes of the calls are histogrammed into power-of-two bins.
+///
+/// Note that the lifetime of this object must be at least as long as the
+/// lifetime of the observed copy object(s), or it has to be detached from
+/// them before being destroyed.
+///
+class VECMEM_CORE_EXPORT copy_monitor : public copy_observer {
+
+public:
+    /// The number of bins in the size histograms
+    static constexpr std::size_t n_bins = 65u;
+
+    /// Counters of one kind of operation
+    struct counters {
+        /// The number of calls
+        std::size_t n_calls = 0u;
+        /// The number of bytes copied/set
+        std::size_t n_bytes = 0u;
+        /// The total time spent in the calls
+        std::chrono::nanoseconds time{0};
+        /// Histogram of the call sizes
+        ///
+        /// Bin 0 counts the calls with zero bytes, bin @c i the calls with
+        /// sizes in <tt>[2^(i-1), 2^i)</tt>.
+        ///
+        std::array<std::size_t, n_bins> histogram{};
+
+        /// The average throughput of the calls, in bytes per second
+        double throughput() const;
+        /// The number of calls smaller than a given size
+        ///
+        /// The result is exact for powers of two, and rounded down to the
+        /// previous power of two otherwise.
+        ///
+        std::size_t n_calls_below(std::size_t size) const;
+    };  // struct counters
+
+    /// All statistics collected by the monitor
+    struct statistics {
+        /// Statistics of the (batched) memory copies, per copy type
+        std::array<counters, copy::type::count> copies;
+        /// Statistics of the memory filling operations
+        counters memsets;
+        /// The number of events created
+        std::size_t n_events = 0u;
+        /// The total time spent creating events
+        std::chrono::nanoseconds event_time{0};
+        /// The number of waits on events
+        std::size_t n_waits = 0u;
+        /// The total time spent waiting on events
+        std::chrono::nanoseconds wait_time{0};
+    };  // struct statistics
+
+    /// The histogram bin of a given size
+    static std::size_t bin(std::size_t size);
+
+    /// Get (a snapshot of) the collected statistics
+    statistics get_statistics() const;
+    /// Reset all of the collected statistics
+    void reset();
+
+    /// Function collecting the statistics
+    void observe(const record& rec) override;
+
+private:
+    /// Mutex protecting the statistics
+    mutable std::mutex m_mutex;
+    /// The collected statistics
+    statistics m_statistics;
+
+};  // class copy_monitor
+
+}  // namespace vecmem
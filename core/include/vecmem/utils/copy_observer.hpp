@@ -0,0 +1,70 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+
+namespace vecmem {
+
+/// Interface for observing the low level operations of @c vecmem::copy
+///
+/// Observers can be attached to copy objects with
+/// @c vecmem::copy::set_observer. They are then notified about every
+/// memory copy, batched memory copy, memory filling and event creation that
+/// the copy object asks its backend for, and about every wait on the events
+/// returned by it. Including the implicit waits of events that get destroyed
+/// without being waited on or ignored.
+///
+/// The durations reported are the times spent in the backend's functions.
+/// For asynchronous backends this is the time needed to issue the
+/// operation, not the time needed to perform it. The latter shows up in the
+/// durations of the waits.
+///
+/// Notifications may come from multiple threads at the same time, if the
+/// observed copy object is used from multiple threads.
+///
+class VECMEM_CORE_EXPORT copy_observer {
+
+public:
+    /// The kinds of low level operations
+    enum class operation : unsigned char {
+        copy = 0,        ///< A single memory copy
+        copy_batch = 1,  ///< A batch of memory copies
+        memset = 2,      ///< A memory filling operation
+        event = 3,       ///< The creation of an event
+        wait = 4         ///< Waiting for an event
+    };  // enum class operation
+
+    /// Description of a single low level operation
+    struct record {
+        /// The kind of the operation
+        operation m_operation = operation::copy;
+        /// The type of (batched) copies, @c copy::type::unknown otherwise
+        copy::type::copy_type m_type = copy::type::unknown;
+        /// The number of bytes copied or set
+        std::size_t m_size = 0u;
+        /// The number of memory regions copied or set
+        std::size_t m_n_regions = 0u;
+        /// The time spent in the backend
+        std::chrono::nanoseconds m_duration{0};
+    };  // struct record
+
+    /// Virtual destructor
+    virtual ~copy_observer();
+
+    /// Function called after every low level operation
+    virtual void observe(const record& rec) = 0;
+
+};  // class copy_observer
+
+}  // namespace vecmem
@@ -0,0 +1,111 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/utils/copy_region.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace vecmem {
+
+// Forward declaration(s).
+class copy;
+
+/// Pre-computed description of a copy between two specific views
+///
+/// Copying between the same pair of jagged vectors or SoA containers over
+/// and over again means re-discovering the same memory layout every time.
+/// A plan, created with @c vecmem::copy::make_plan, does all of that work
+/// once. Executing it with @c vecmem::copy::operator() only issues the
+/// (already merged) memory copies.
+///
+/// Sizes of resizable source containers are still read at execution time,
+/// unless they can be copied directly between the two containers.
+///
+/// The plan stays valid as long as the memory layout of the views that it
+/// was created from does not change. It is up to the user to call
+/// @c invalidate() once it does, and to create a new plan. The plan also
+/// needs to stay alive until all executions of it have finished.
+///
+class VECMEM_CORE_EXPORT copy_plan {
+
+public:
+    /// Default constructor, creating an invalid plan
+    copy_plan();
+    /// Move constructor
+    copy_plan(copy_plan&&) noexcept;
+    /// Destructor
+    ~copy_plan();
+
+    /// Move assignment operator
+    copy_plan& operator=(copy_plan&&) noexcept;
+
+    /// Check whether the plan can be executed
+    bool valid() const;
+    /// Invalidate the plan, after the layout of its views changed
+    void invalidate();
+
+    /// The number of memory copies issued for the fixed part of the plan
+    std::size_t n_fixed_copies() const;
+    /// The number of parts that need to read sizes at execution time
+    std::size_t n_dynamic_parts() const;
+
+private:
+    /// The copy class is the one setting up and executing the plan
+    friend class copy;
+
+    /// Size type used by the views
+    using size_type = data::vector_view<int>::size_type;
+
+    /// Part of the plan depending on the sizes of a resizable source
+    struct dynamic_part {
+        /// Size of the elements in the copied (jagged) vector
+        std::size_t m_element_size = 0u;
+        /// Sizes of the source's inner vectors, starting from @c m_first
+        const size_type* m_from_sizes = nullptr;
+        /// Index of the first inner vector with a readable size
+        std::size_t m_first = 0u;
+        /// Sizes of the target's inner vectors (if it is resizable)
+        size_type* m_to_sizes = nullptr;
+        /// The inner vectors to copy, with their sizes left unset
+        std::vector<copy_region> m_inner;
+        /// The capacities of the target's inner vectors
+        std::vector<size_type> m_to_capacities;
+        /// Whether the gaps between the inner vectors may be copied along
+        bool m_allow_padding = false;
+    };
+
+    /// Store a host value in memory owned by the plan
+    ///
+    /// @param data The value(s) to store
+    /// @param size The size of the value(s) in bytes
+    /// @return Pointer to the stored value(s)
+    ///
+    const void* store(const void* data, std::size_t size);
+
+    /// Flag showing whether the plan is valid
+    bool m_valid = false;
+    /// The type of the copy (a @c vecmem::copy::type::copy_type value)
+    int m_copy_type = 0;
+    /// Memory regions copied with the plan's copy type
+    std::vector<copy_region> m_regions;
+    /// Memory regions copied from host memory owned by the plan
+    std::vector<copy_region> m_host_regions;
+    /// Parts depending on the sizes of resizable sources
+    std::vector<dynamic_part> m_dynamic;
+    /// Host memory owned by the plan
+    std::vector<std::unique_ptr<unsigned char[]>> m_storage;
+
+};  // class copy_plan
+
+}  // namespace vecmem
@@ -0,0 +1,30 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Description of a single memory region to copy
+///
+/// Used by @c vecmem::copy to describe "scatter/gather" copies, which
+/// consist of many independent regions, to the backends.
+///
+struct copy_region {
+
+    /// Start of the source memory region
+    const void* m_from = nullptr;
+    /// Start of the destination memory region
+    void* m_to = nullptr;
+    /// Size of the region in bytes
+    std::size_t m_size = 0u;
+
+};  // struct copy_region
+
+}  // namespace vecmem
@@ -0,0 +1,221 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// This header can only be used with C++20 coroutine support. While the rest
+// of the library only needs C++17, code built in C++20 mode can make use of
+// the coroutine awaitables declared here.
+#if !defined(__cpp_impl_coroutine)
+#error \
+    "This header can only be used in C++20 mode, with coroutine support " \
+         "enabled."
+#endif  // !__cpp_impl_coroutine
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/async_size.hpp"
+#include "vecmem/utils/async_sizes.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// System include(s).
+#include <coroutine>
+#include <functional>
+#include <memory>
+
+namespace vecmem {
+
+/// Function resuming a suspended coroutine
+///
+/// By default coroutines waiting for an event are resumed on the background
+/// thread of @c vecmem::then, which is shared by all continuations. Since
+/// that thread must not be blocked for long, coroutines doing substantial
+/// work after their @c co_await should be handed to a thread pool of the
+/// user's choice through such a function.
+///
+/// @warning Without a resume function, the code following a @c co_await
+///          runs on that single background thread. Any blocking call made
+///          there (like a synchronous copy waiting on a device event) stalls
+///          every other continuation and coroutine of the process. Waiting
+///          for an unfinished @c vecmem::then event from there (also when
+///          combined with others through @c vecmem::when_all) throws
+///          @c std::logic_error.
+///
+using resume_function = std::function<void(std::coroutine_handle<>)>;
+
+/// Awaitable for an event owned by the caller
+///
+/// The awaited event must outlive the suspension of the coroutine. Awaiting
+/// a @c vecmem::async_size or @c vecmem::async_sizes object results in the
+/// retrieved size(s), awaiting any other event results in @c void.
+///
+/// @tparam EVENT The type of the event to wait for
+///
+template <typename EVENT>
+class event_awaitable {
+
+public:
+    /// Constructor with the event to wait for
+    explicit event_awaitable(EVENT& event, resume_function resume = {});
+
+    /// Resume the coroutine using a custom function
+    event_awaitable resume_on(resume_function resume) &&;
+
+    /// @name Functions implementing the awaitable interface
+    /// @{
+
+    /// Check whether the event is complete already
+    bool await_ready() const;
+    /// Resume the coroutine once the event completes
+    void await_suspend(std::coroutine_handle<> handle);
+    /// Finish the event, and return its result (if it has one)
+    decltype(auto) await_resume();
+
+    /// @}
+
+private:
+    /// The event to wait for
+    EVENT* m_event;
+    /// The function used to resume the coroutine
+    resume_function m_resume;
+
+};  // class event_awaitable
+
+/// Awaitable for an asynchronous operation, producing a result
+///
+/// Unlike @c vecmem::event_awaitable, this type owns the event of the
+/// operation, so it can be used with temporary events.
+///
+/// @tparam RESULT The result of the operation (may be @c void)
+///
+template <typename RESULT>
+class async_result {
+
+public:
+    /// Type of the held event
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Constructor with the event of the operation, and its result
+    async_result(event_type event, RESULT result, resume_function resume = {});
+
+    /// Resume the coroutine using a custom function
+    async_result resume_on(resume_function resume) &&;
+
+    /// @name Functions implementing the awaitable interface
+    /// @{
+
+    /// Check whether the operation is complete already
+    bool await_ready() const;
+    /// Resume the coroutine once the operation completes
+    void await_suspend(std::coroutine_handle<> handle);
+    /// Finish the operation, and return its result
+    RESULT await_resume();
+
+    /// @}
+
+private:
+    /// The event of the operation
+    event_type m_event;
+    /// The result of the operation
+    RESULT m_result;
+    /// The function used to resume the coroutine
+    resume_function m_resume;
+
+};  // class async_result
+
+/// Awaitable for an asynchronous operation, without a result
+template <>
+class async_result<void> {
+
+public:
+    /// Type of the held event
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Constructor with the event of the operation
+    explicit async_result(event_type event, resume_function resume = {});
+
+    /// Resume the coroutine using a custom function
+    async_result resume_on(resume_function resume) &&;
+
+    /// @name Functions implementing the awaitable interface
+    /// @{
+
+    /// Check whether the operation is complete already
+    bool await_ready() const;
+    /// Resume the coroutine once the operation completes
+    void await_suspend(std::coroutine_handle<> handle);
+    /// Finish the operation
+    void await_resume();
+
+    /// @}
+
+private:
+    /// The event of the operation
+    event_type m_event;
+    /// The function used to resume the coroutine
+    resume_function m_resume;
+
+};  // class async_result<void>
+
+/// Create an awaitable for an event, resuming with a custom function
+///
+/// @param event The event to wait for
+/// @param resume The function used to resume the coroutine
+/// @return An awaitable for the event
+///
+template <typename EVENT>
+event_awaitable<EVENT> awaitable(EVENT& event, resume_function resume);
+
+/// Await an event
+///
+/// @note Unless a resume function is given, the coroutine is resumed on the
+///       shared background thread of @c vecmem::then. See
+///       @c vecmem::resume_function for the restrictions that this implies.
+///
+inline event_awaitable<abstract_event> operator co_await(
+    abstract_event& event);
+
+/// Await an asynchronous size retrieval
+template <typename SIZE_TYPE>
+event_awaitable<async_size<SIZE_TYPE>> operator co_await(
+    async_size<SIZE_TYPE>& size);
+
+/// Await an asynchronous sizes retrieval
+template <typename SIZE_TYPE>
+event_awaitable<async_sizes<SIZE_TYPE>> operator co_await(
+    async_sizes<SIZE_TYPE>& sizes);
+
+/// Perform a copy operation, that can be awaited by a coroutine
+///
+/// @param cp The copy object to use
+/// @param args The arguments for @c vecmem::copy::operator()
+/// @return An awaitable for the copy operation
+///
+/// @note Unless a resume function is given, the coroutine is resumed on the
+///       shared background thread of @c vecmem::then. See
+///       @c vecmem::resume_function for the restrictions that this implies.
+///
+template <typename... ARGS>
+async_result<void> co_copy(const copy& cp, ARGS&&... args);
+
+/// Copy data into a new buffer, with an operation that can be awaited by a
+/// coroutine
+///
+/// @param cp The copy object to use
+/// @param args The arguments for @c vecmem::copy::to_async
+/// @return An awaitable for the copy, producing the new buffer
+///
+/// @note Unless a resume function is given, the coroutine is resumed on the
+///       shared background thread of @c vecmem::then. See
+///       @c vecmem::resume_function for the restrictions that this implies.
+///
+template <typename... ARGS>
+auto co_to(const copy& cp, ARGS&&... args);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/coroutine.ipp"
@@ -0,0 +1,89 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/utils/copy_region.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <utility>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Thread-local pool of the temporary arrays used by copy operations
+///
+/// Copy operations need short lived arrays of sizes, capacities and memory
+/// regions. Leasing these from the current thread's pool lets the arrays
+/// keep their capacity from one operation to the next. So that, once the
+/// pool warmed up, copies would not need any heap allocations for them.
+///
+class VECMEM_CORE_EXPORT copy_scratch {
+
+public:
+    /// Size type used by the views
+    using size_type = data::vector_view<int>::size_type;
+
+    /// An array leased from the pool, for the lifetime of this object
+    ///
+    /// The array is empty when leased, and is given back to the pool in
+    /// the destructor.
+    ///
+    template <typename T>
+    class lease {
+
+    public:
+        /// Lease an array from a pool
+        explicit lease(std::vector<std::vector<T>>& pool) : m_pool(pool) {
+            if (m_pool.empty() == false) {
+                m_array = std::move(m_pool.back());
+                m_pool.pop_back();
+            }
+        }
+        /// Copy constructor
+        lease(const lease&) = delete;
+        /// Destructor, giving the array back to the pool
+        ~lease() {
+            m_array.clear();
+            m_pool.push_back(std::move(m_array));
+        }
+
+        /// Copy assignment
+        lease& operator=(const lease&) = delete;
+
+        /// Access the leased array
+        std::vector<T>& operator*() { return m_array; }
+        /// Access the leased array
+        std::vector<T>* operator->() { return &m_array; }
+
+    private:
+        /// The pool that the array came from
+        std::vector<std::vector<T>>& m_pool;
+        /// The leased array
+        std::vector<T> m_array;
+
+    };  // class lease
+
+    /// Lease an array of sizes from the current thread's pool
+    static lease<size_type> sizes();
+    /// Lease an array of memory regions from the current thread's pool
+    static lease<copy_region> regions();
+
+private:
+    /// Get the pool of the current thread
+    static copy_scratch& local();
+
+    /// Arrays of sizes not leased at the moment
+    std::vector<std::vector<size_type>> m_sizes;
+    /// Arrays of memory regions not leased at the moment
+    std::vector<std::vector<copy_region>> m_regions;
+
+};  // class copy_scratch
+
+}  // namespace vecmem::details
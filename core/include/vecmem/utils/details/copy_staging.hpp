@@ -0,0 +1,104 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vecmem::details {
+
+// Forward declaration(s).
+struct staged_event;
+
+/// Persistent host storage for the values staged by copy operations
+///
+/// Some copy operations need to transfer values that only exist on the
+/// calling thread's stack, like the sizes of resizable containers. Instead
+/// of waiting for such transfers to finish before returning, the values are
+/// copied into blocks of memory owned by this object. The blocks are kept
+/// alive by the event of the operation that uses them, and are recycled once
+/// that event finishes.
+///
+class VECMEM_CORE_EXPORT copy_staging
+    : public std::enable_shared_from_this<copy_staging> {
+
+public:
+    /// A single block of staging memory
+    using block = std::vector<unsigned char>;
+    /// The blocks used by a single (high level) copy operation
+    using batch = std::vector<block>;
+    /// Event type used by the copy classes
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Default constructor
+    copy_staging();
+    /// Destructor, waiting for all operations still using staging memory
+    ~copy_staging();
+
+    /// Stage an array of values for the duration of a copy operation
+    ///
+    /// @param staged The batch of blocks of the current copy operation
+    /// @param data Pointer to the values to stage
+    /// @param n The number of values to stage
+    /// @return Pointer to the staged copy of the values
+    ///
+    template <typename T>
+    const T* stage(batch& staged, const T* data, std::size_t n) {
+        return static_cast<const T*>(stage_bytes(staged, data, n * sizeof(T)));
+    }
+
+    /// Tie the lifetime of a batch of blocks to an event
+    ///
+    /// @param staged The blocks used by the operation(s) tracked by @c event
+    /// @param event The event tracking the operation(s) using the blocks
+    /// @return An event that should be handed to the user
+    ///
+    event_type attach(batch&& staged, event_type event);
+
+    /// Wait for all operations still using staging memory
+    ///
+    /// Operations whose events were ignored by the user, keep their staging
+    /// memory alive until they finish. This function waits for all of those.
+    ///
+    void wait_for_deferred();
+
+private:
+    /// Allow the staged event type to access the memory management functions
+    friend struct staged_event;
+
+    /// Copy some data into a (recycled) block of memory
+    const void* stage_bytes(batch& staged, const void* data, std::size_t size);
+    /// Recycle the blocks of a finished operation
+    void recycle(batch&& staged);
+    /// Keep the blocks of an ignored, but unfinished operation alive
+    void defer(event_type event, batch&& staged);
+    /// Recycle the blocks of all finished, deferred operations
+    ///
+    /// Must only be called while holding @c m_mutex.
+    ///
+    void reap_deferred();
+
+    /// Mutex protecting the object's state
+    std::mutex m_mutex;
+    /// Blocks ready for re-use
+    std::vector<block> m_free;
+    /// Empty batches ready for re-use
+    std::vector<batch> m_free_batches;
+    /// Ignored operations that may still be using their blocks
+    std::vector<std::pair<event_type, batch>> m_deferred;
+
+};  // class copy_staging
+
+}  // namespace vecmem::details
@@ -0,0 +1,60 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Set of the modified ranges of elements in an array
+///
+/// The ranges are kept sorted, with overlapping and neighbouring ranges
+/// merged. They are stored as (in-place) @c vecmem::copy::slice objects, so
+/// that they could be given to @c vecmem::copy as they are.
+///
+class VECMEM_CORE_EXPORT dirty_ranges {
+
+public:
+    /// Constructor with the size of the array, and the tracking granularity
+    ///
+    /// @param size The number of elements in the array
+    /// @param granularity The number of elements that ranges are rounded
+    ///        outwards to a multiple of
+    ///
+    explicit dirty_ranges(std::size_t size, std::size_t granularity = 1u);
+
+    /// Mark the elements in <tt>[begin, end)</tt> as modified
+    void add(std::size_t begin, std::size_t end);
+    /// Mark all elements as modified
+    void add_all();
+    /// Mark all elements as unmodified
+    void clear();
+
+    /// Check whether any of the elements is marked as modified
+    bool empty() const;
+    /// The number of elements marked as modified
+    std::size_t n_elements() const;
+    /// The modified ranges of elements
+    const std::vector<copy::slice>& ranges() const;
+
+private:
+    /// The number of elements in the array
+    std::size_t m_size;
+    /// The granularity of the tracking
+    std::size_t m_granularity;
+    /// The modified ranges
+    std::vector<copy::slice> m_ranges;
+
+};  // class dirty_ranges
+
+}  // namespace vecmem::details
@@ -0,0 +1,105 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace vecmem {
+
+/// Event tracking the completion of a group of events
+///
+/// Every event of the group is only polled until it is seen to be complete.
+/// Complete events are released right away, so that the resources held by
+/// them (like staging memory) would be freed as early as possible. This
+/// makes repeatedly checking a large group with @c is_ready() cheap.
+///
+/// Just like the individual events, the group is not thread safe. It needs
+/// to be used from a single thread at a time.
+///
+class VECMEM_CORE_EXPORT event_group : public abstract_event {
+
+public:
+    /// Type of the held events
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Default constructor, creating an empty (complete) group
+    event_group();
+    /// Constructor from a list of events
+    explicit event_group(std::vector<event_type> events);
+    /// Move constructor
+    event_group(event_group&&) noexcept;
+    /// Destructor, waiting for all events that were not ignored
+    ~event_group() override;
+
+    /// Move assignment operator
+    event_group& operator=(event_group&&) noexcept;
+
+    /// Add an event to the group
+    ///
+    /// @param event The event to add
+    /// @return The index of the event in the group
+    ///
+    std::size_t add(event_type event);
+
+    /// The number of events in the group
+    std::size_t size() const;
+    /// The number of events known to be complete, after polling all of them
+    std::size_t n_ready() const;
+    /// Check whether a specific event of the group is complete
+    bool is_ready(std::size_t index) const;
+
+    /// Wait for any of the events in the group to complete
+    ///
+    /// The function keeps polling the events of the group until one of them
+    /// completes, yielding the thread between the polls.
+    ///
+    /// @return The index of the (first) completed event
+    ///
+    std::size_t wait_any();
+
+    /// @name Function(s) implemented from @c vecmem::abstract_event
+    /// @{
+
+    /// Wait for all events in the group to complete
+    void wait() override;
+
+    /// Check whether all events in the group are complete without blocking
+    ///
+    /// @return true if all events are complete, false otherwise
+    ///
+    bool is_ready() const override;
+
+    /// Stop tracking all events in the group
+    void ignore() override;
+
+    /// @}
+
+private:
+    /// Poll a single event, releasing it if it finished
+    ///
+    /// @param index The index of the event to poll
+    /// @return @c true if the event is complete, @c false otherwise
+    ///
+    bool poll(std::size_t index) const;
+
+    /// The events of the group (null once they were seen to be complete)
+    mutable std::vector<event_type> m_events;
+    /// The number of events seen to be complete
+    mutable std::size_t m_n_ready = 0u;
+    /// The index of the first event that may not be complete yet
+    mutable std::size_t m_first_pending = 0u;
+
+};  // class event_group
+
+}  // namespace vecmem
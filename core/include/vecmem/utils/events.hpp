@@ -0,0 +1,83 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/event_group.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace vecmem {
+
+/// Create an event that completes once all of the received events complete
+///
+/// @param events The events to combine
+/// @return An event tracking all of the received events
+///
+VECMEM_CORE_EXPORT
+std::unique_ptr<abstract_event> when_all(
+    std::vector<std::unique_ptr<abstract_event>> events);
+
+/// Create an event that completes once all of the received events complete
+///
+/// @param events The events to combine
+/// @return An event tracking all of the received events
+///
+template <typename... EVENTS>
+std::unique_ptr<abstract_event> when_all(EVENTS&&... events);
+
+/// Create an event that completes once any of the received events completes
+///
+/// Waiting on the returned event polls the received events until one of
+/// them completes. Destroying it waits for all of the events that were not
+/// ignored, just like destroying the individual events would.
+///
+/// @param events The events to combine
+/// @return An event tracking the first completion among the received events
+///
+VECMEM_CORE_EXPORT
+std::unique_ptr<abstract_event> when_any(
+    std::vector<std::unique_ptr<abstract_event>> events);
+
+/// Create an event that completes once any of the received events completes
+///
+/// @param events The events to combine
+/// @return An event tracking the first completion among the received events
+///
+template <typename... EVENTS>
+std::unique_ptr<abstract_event> when_any(EVENTS&&... events);
+
+/// Execute a host function once an event completes
+///
+/// The function is executed on a background thread of the library, shared
+/// by all continuations. So it should be short, and must not block on other
+/// continuations. The calling thread is not blocked by this function.
+///
+/// Waiting on the returned event re-throws exceptions thrown by the
+/// function. Waiting on it from inside of another continuation, before the
+/// function was executed, throws @c std::logic_error instead of blocking
+/// forever. The returned event waits for the function to finish in its
+/// destructor, unless it is ignored, or it is destroyed inside of another
+/// continuation. (In which case the function is executed regardless.)
+///
+/// @param event The event to wait for
+/// @param callback The function to execute once the event completed
+/// @return An event that completes once the function was executed
+///
+VECMEM_CORE_EXPORT
+std::unique_ptr<abstract_event> then(std::unique_ptr<abstract_event> event,
+                                     std::function<void()> callback);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/events.ipp"
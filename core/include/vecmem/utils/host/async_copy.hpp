@@ -0,0 +1,72 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <memory>
+
+namespace vecmem::host {
+
+/// Asynchronous specialisation of @c vecmem::copy for the host
+///
+/// Unlike @c vecmem::copy, this class does not perform its memory operations
+/// on the calling thread. Every operation is added to an in-order queue, and
+/// is executed by a dedicated worker thread. The events returned by the class
+/// track the completion of all operations enqueued up to their creation. This
+/// mimics the behaviour of the asynchronous copy classes of the GPU backends.
+///
+/// It is up to the user to ensure that the memory blocks taking part in the
+/// operations remain valid until the operations' events finish.
+///
+/// Operations may be enqueued from multiple threads, but their relative
+/// order is only well defined for operations issued by a single thread.
+///
+class async_copy : public vecmem::copy {
+
+public:
+    /// Default constructor
+    VECMEM_CORE_EXPORT
+    async_copy();
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    async_copy(async_copy&&) noexcept;
+    /// Destructor, finishing all enqueued operations
+    VECMEM_CORE_EXPORT
+    ~async_copy() noexcept override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    async_copy& operator=(async_copy&&) noexcept;
+
+    /// Block the calling thread until all enqueued operations finish
+    VECMEM_CORE_EXPORT
+    void synchronize() const;
+
+private:
+    /// Enqueue an asynchronous memory copy
+    VECMEM_CORE_EXPORT
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const final;
+    /// Enqueue an asynchronous memory filling operation
+    VECMEM_CORE_EXPORT
+    void do_memset(std::size_t size, void* ptr, int value) const final;
+    /// Create an event tracking all operations enqueued so far
+    VECMEM_CORE_EXPORT
+    event_type create_event() const final;
+
+    /// Internal data type for the class
+    struct impl;
+    /// Pointer to the internal data
+    std::unique_ptr<impl> m_impl;
+
+};  // class async_copy
+
+}  // namespace vecmem::host
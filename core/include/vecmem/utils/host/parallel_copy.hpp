@@ -0,0 +1,100 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+
+namespace vecmem::host {
+
+/// Specialisation of @c vecmem::copy using multiple host threads
+///
+/// Large memory copies and memory filling operations are split into
+/// page-aligned chunks, which are processed by a persistent pool of threads
+/// (together with the calling thread). Operations smaller than a configurable
+/// threshold are performed on the calling thread, just like
+/// @c vecmem::copy would do it.
+///
+/// Just like @c vecmem::copy, this class assumes that all memory that it
+/// operates on is accessible from the host. All operations are synchronous.
+///
+/// The object may be used from multiple threads at the same time. If the
+/// thread pool is busy with an operation of another thread, operations are
+/// performed on the calling thread alone.
+///
+class parallel_copy : public vecmem::copy {
+
+public:
+    /// Runtime options for @c vecmem::host::parallel_copy
+    struct VECMEM_CORE_EXPORT options {
+
+        /// Default constructor
+        ///
+        /// It is necessary to work around issue:
+        /// https://github.com/llvm/llvm-project/issues/36032
+        ///
+        options();
+
+        /// The total number of threads to use, including the calling thread
+        ///
+        /// A value of 0 means to use as many threads as the hardware supports.
+        ///
+        std::size_t n_threads = 0u;
+        /// The size (in bytes) from which operations are parallelized
+        std::size_t threshold = 1024u * 1024u;
+        /// Chunk boundaries are aligned to multiples of this value (in bytes)
+        ///
+        /// Must be a power of 2.
+        ///
+        std::size_t chunk_alignment = 4096u;
+
+    };  // struct options
+
+    /// Constructor with the options for the object
+    ///
+    /// @param opts The options to use for the copy object
+    ///
+    VECMEM_CORE_EXPORT
+    explicit parallel_copy(const options& opts = options{});
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    parallel_copy(parallel_copy&&) noexcept;
+    /// Destructor
+    VECMEM_CORE_EXPORT
+    ~parallel_copy() noexcept override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    parallel_copy& operator=(parallel_copy&&) noexcept;
+
+    /// The total number of threads used for large operations
+    VECMEM_CORE_EXPORT
+    std::size_t n_threads() const;
+
+protected:
+    /// Perform a (possibly multi-threaded) memory copy
+    VECMEM_CORE_EXPORT
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const override;
+    /// Perform a (possibly multi-threaded) memory filling operation
+    VECMEM_CORE_EXPORT
+    void do_memset(std::size_t size, void* ptr, int value) const override;
+
+private:
+    /// Internal data type for the class
+    struct impl;
+    /// Pointer to the internal data
+    std::unique_ptr<impl> m_impl;
+
+};  // class parallel_copy
+
+}  // namespace vecmem::host
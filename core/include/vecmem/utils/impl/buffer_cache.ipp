@@ -0,0 +1,99 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/edm/details/schema_traits.hpp"
+
+// System include(s).
+#include <cassert>
+#include <typeinfo>
+#include <utility>
+
+namespace vecmem {
+
+template <typename TYPE>
+void buffer_cache::release(data::vector_buffer<TYPE>&& buffer) {
+
+    // Empty buffers are not worth keeping.
+    if (buffer.resource() == nullptr) {
+        return;
+    }
+    assert(buffer.resource() == &m_resource);
+
+    // Store the buffer.
+    const data::buffer_type btype =
+        ((buffer.size_ptr() != nullptr) ? data::buffer_type::resizable
+                                        : data::buffer_type::fixed_size);
+    put(make_key<data::vector_buffer<TYPE>>(btype, {buffer.capacity()}),
+        std::make_unique<holder<data::vector_buffer<TYPE>>>(std::move(buffer)));
+}
+
+template <typename TYPE>
+void buffer_cache::release(data::jagged_vector_buffer<TYPE>&& buffer) {
+
+    // Empty buffers are not worth keeping.
+    if (buffer.resource() == nullptr) {
+        return;
+    }
+    assert(buffer.resource() == &m_resource);
+    assert(buffer.host_resource() == m_host_access_resource);
+
+    // Store the buffer.
+    const data::buffer_type btype =
+        (((buffer.size() > 0u) && (buffer.host_ptr()[0].size_ptr() != nullptr))
+             ? data::buffer_type::resizable
+             : data::buffer_type::fixed_size);
+    const auto capacities = data::get_capacities(buffer);
+    put(make_key<data::jagged_vector_buffer<TYPE>>(
+            btype, {capacities.begin(), capacities.end()}),
+        std::make_unique<holder<data::jagged_vector_buffer<TYPE>>>(
+            std::move(buffer)));
+}
+
+template <typename SCHEMA>
+void buffer_cache::release(edm::buffer<SCHEMA>&& buffer) {
+
+    // Empty buffers are not worth keeping.
+    if (buffer.resource() == nullptr) {
+        return;
+    }
+    assert(buffer.resource() == &m_resource);
+
+    // Store the buffer.
+    const data::buffer_type btype =
+        ((buffer.size().ptr() != nullptr) ? data::buffer_type::resizable
+                                          : data::buffer_type::fixed_size);
+    std::vector<std::size_t> capacities{buffer.capacity()};
+    if constexpr (edm::details::has_jagged_vector<SCHEMA>::value) {
+        assert(buffer.host_resource() == m_host_access_resource);
+        const auto inner = edm::get_capacities(buffer);
+        capacities.insert(capacities.end(), inner.begin(), inner.end());
+    }
+    put(make_key<edm::buffer<SCHEMA>>(btype, std::move(capacities)),
+        std::make_unique<holder<edm::buffer<SCHEMA>>>(std::move(buffer)));
+}
+
+template <typename BUFFER>
+auto buffer_cache::make_key(data::buffer_type btype,
+                            std::vector<std::size_t>&& capacities) -> key {
+
+    return {std::type_index{typeid(BUFFER)}, btype, std::move(capacities)};
+}
+
+template <typename BUFFER>
+BUFFER buffer_cache::take(const key& k) {
+
+    std::unique_ptr<holder_base> result = take_holder(k);
+    if (!result) {
+        return {};
+    }
+    assert(dynamic_cast<holder<BUFFER>*>(result.get()) != nullptr);
+    return std::move(static_cast<holder<BUFFER>&>(*result).m_buffer);
+}
+
+}  // namespace vecmem
@@ -12,12 +12,17 @@
 #include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/edm/details/schema_traits.hpp"
 #include "vecmem/memory/get_default_resource.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 #include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/details/copy_scratch.hpp"
+#include "vecmem/utils/details/narrow_size.hpp"
 #include "vecmem/utils/type_traits.hpp"
 
 // System include(s).
 #include <algorithm>
+#include <bitset>
 #include <cassert>
+#include <limits>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
@@ -25,6 +30,44 @@
 
 namespace vecmem {
 
+inline void copy::issue_copy(std::size_t size, const void* from, void* to,
+                             type::copy_type cptype) const {
+
+    if (m_observer == nullptr) {
+        do_copy(size, from, to, cptype);
+    } else {
+        observed_copy(size, from, to, cptype);
+    }
+}
+
+inline void copy::issue_copy_batch(std::size_t n, const copy_region* regions,
+                                   type::copy_type cptype) const {
+
+    if (m_observer == nullptr) {
+        do_copy_batch(n, regions, cptype);
+    } else {
+        observed_copy_batch(n, regions, cptype);
+    }
+}
+
+inline void copy::issue_memset(std::size_t size, void* ptr, int value) const {
+
+    if (m_observer == nullptr) {
+        do_memset(size, ptr, value);
+    } else {
+        observed_memset(size, ptr, value);
+    }
+}
+
+inline copy::event_type copy::issue_event() const {
+
+    if (m_observer == nullptr) {
+        return create_event();
+    } else {
+        return observed_event();
+    }
+}
+
 template <typename TYPE>
 copy::event_type copy::setup(data::vector_view<TYPE> data) const {
 
@@ -34,15 +77,15 @@ copy::event_type copy::setup(data::vector_view<TYPE> data) const {
     }
 
     // Initialize the "size variable" correctly on the buffer.
-    do_memset(sizeof(typename data::vector_view<TYPE>::size_type),
-              data.size_ptr(), 0);
+    issue_memset(sizeof(typename data::vector_view<TYPE>::size_type),
+                 data.size_ptr(), 0);
     VECMEM_DEBUG_MSG(2,
                      "Prepared a device vector buffer of capacity %u "
                      "for use on a device (ptr: %p)",
                      data.capacity(), static_cast<void*>(data.size_ptr()));
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename TYPE>
@@ -54,12 +97,12 @@ copy::event_type copy::memset(data::vector_view<TYPE> data, int value) const {
     }
 
     // Call memset with the correct arguments.
-    do_memset(data.capacity() * sizeof(TYPE), data.ptr(), value);
+    issue_memset(data.capacity() * sizeof(TYPE), data.ptr(), value);
     VECMEM_DEBUG_MSG(2, "Set %u vector elements to %i at ptr: %p",
                      data.capacity(), value, static_cast<void*>(data.ptr()));
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename TYPE>
@@ -67,19 +110,94 @@ data::vector_buffer<std::remove_cv_t<TYPE>> copy::to(
     const vecmem::data::vector_view<TYPE>& data, memory_resource& resource,
     type::copy_type cptype) const {
 
+    // Copy the payload of the vector. Explicitly waiting for the copy to finish
+    // before returning the buffer.
+    auto result = to_async(data, resource, cptype);
+    result.second->wait();
+
+    // Return the buffer.
+    return std::move(result.first);
+}
+
+template <typename TYPE>
+std::pair<data::vector_buffer<std::remove_cv_t<TYPE>>, copy::event_type>
+copy::to_async(const vecmem::data::vector_view<TYPE>& data,
+               memory_resource& resource, type::copy_type cptype) const {
+
     // Set up the result buffer. No need to call setup(...) on it, as the buffer
     // is not resizable.
     data::vector_buffer<std::remove_cv_t<TYPE>> result(get_size(data),
                                                        resource);
 
-    // Copy the payload of the vector. Explicitly waiting for the copy to finish
-    // before returning the buffer.
-    operator()(data, result, cptype)->wait();
+    // Start the copy of the payload of the vector.
+    event_type event = operator()(data, result, cptype);
 
-    // Return the buffer.
+    // Return the buffer, with the event of the copy.
+    return {std::move(result), std::move(event)};
+}
+
+template <typename TYPE>
+copy::event_type copy::to_into(
+    const data::vector_view<TYPE>& data,
+    data::vector_buffer<std::remove_cv_t<TYPE>>& target,
+    memory_resource& resource, type::copy_type cptype) const {
+
+    // Re-create the target buffer if it can not be used for the copy.
+    const auto size = get_size(data);
+    const bool resizable = (target.size_ptr() != nullptr);
+    if ((target.resource() != &resource) ||
+        (resizable ? (target.capacity() < size)
+                   : (target.capacity() != size))) {
+        VECMEM_DEBUG_MSG(2, "Re-creating a 1D buffer with capacity %u",
+                         size);
+        target = {size, resource,
+                  (resizable ? data::buffer_type::resizable
+                             : data::buffer_type::fixed_size)};
+    }
+
+    // Perform the copy.
+    return operator()(data, target, cptype);
+}
+
+template <typename TYPE>
+data::vector_buffer<std::remove_cv_t<TYPE>> copy::to(
+    const data::vector_view<TYPE>& data, buffer_cache& cache,
+    type::copy_type cptype) const {
+
+    // Take a buffer of the right shape from the cache, or create a new one.
+    using buffer_t = data::vector_buffer<std::remove_cv_t<TYPE>>;
+    const auto size = get_size(data);
+    buffer_t result = cache.take<buffer_t>(buffer_cache::make_key<buffer_t>(
+        data::buffer_type::fixed_size, {size}));
+    if (result.resource() == nullptr) {
+        result = {size, cache.resource()};
+    }
+
+    // Perform the copy, and wait for it to finish.
+    operator()(data, result, cptype)->wait();
     return result;
 }
 
+template <typename TYPE>
+data::borrowed_buffer<data::vector_view<std::add_const_t<TYPE>>>
+copy::to_borrowed(const data::vector_view<TYPE>& data,
+                  std::shared_ptr<const void> owner, memory_resource& resource,
+                  type::copy_type cptype) const {
+
+    // Use the source's memory directly, if possible.
+    if (can_borrow(data.space(), get_memory_space(resource), cptype)) {
+        VECMEM_DEBUG_MSG(2, "Borrowing %u vector elements at ptr: %p",
+                         data.capacity(),
+                         static_cast<const void*>(data.ptr()));
+        return {data, std::move(owner), true};
+    }
+
+    // If not, make a copy, and let the result own it.
+    auto buffer = std::make_shared<data::vector_buffer<std::remove_cv_t<TYPE>>>(
+        to(data, resource, cptype));
+    return {*buffer, std::move(buffer), false};
+}
+
 template <typename TYPE>
 copy::event_type copy::operator()(
     const data::vector_view<std::add_const_t<TYPE>>& from_view,
@@ -87,18 +205,69 @@ copy::event_type copy::operator()(
 
     // Perform the copy. Depending on whether an actual copy has been set up /
     // performed, return either "an actual", or just a dummy event.
-    if (copy_view_impl(from_view, to_view, cptype)) {
-        return create_event();
+    details::copy_staging::batch staged;
+    if (copy_view_impl(from_view, to_view, cptype, staged)) {
+        return m_staging->attach(std::move(staged), issue_event());
     } else {
         return vecmem::copy::create_event();
     }
 }
 
+template <typename TYPE>
+copy::event_type copy::operator()(
+    const data::vector_view<std::add_const_t<TYPE>>& from_view,
+    data::vector_view<TYPE> to_view, const slice& range,
+    type::copy_type cptype) const {
+
+    // Make sure that the copy can happen. For resizable sources only the
+    // elements within the current size may be copied.
+    check_slice(range, get_size(from_view), to_view.capacity());
+
+    // Perform the copy.
+    details::copy_staging::batch staged;
+    slice_view_impl(from_view, to_view, range, cptype, staged);
+    return m_staging->attach(std::move(staged), issue_event());
+}
+
+template <typename TYPE>
+copy::event_type copy::operator()(
+    const data::vector_view<std::add_const_t<TYPE>>& from_view,
+    data::vector_view<TYPE> to_view, const std::vector<slice>& ranges,
+    type::copy_type cptype) const {
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.space(), to_view.space(), cptype);
+
+    // Collect the regions to copy, making sure that all of them are valid.
+    // For resizable sources only the elements within the current size may be
+    // copied.
+    const std::size_t from_size = get_size(from_view);
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(ranges.size());
+    for (const slice& range : ranges) {
+        check_slice(range, from_size, to_view.capacity());
+        regions.push_back({from_view.ptr() + range.begin,
+                           to_view.ptr() + range.offset,
+                           (range.end - range.begin) * sizeof(TYPE)});
+    }
+    VECMEM_DEBUG_MSG(2, "Copying %lu range(s) of a 1D vector",
+                     ranges.size());
+
+    // Perform the copy.
+    copy_batch(regions, cptype, false);
+    return issue_event();
+}
+
 template <typename TYPE, typename ALLOC>
 copy::event_type copy::operator()(
     const data::vector_view<std::add_const_t<TYPE>>& from_view,
     std::vector<TYPE, ALLOC>& to_vec, type::copy_type cptype) const {
 
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.space(), memory_space::host, cptype);
+
     // Figure out the size of the buffer.
     const typename data::vector_view<std::add_const_t<TYPE>>::size_type size =
         get_size(from_view);
@@ -111,10 +280,10 @@ copy::event_type copy::operator()(
     // Make the target vector the correct size.
     to_vec.resize(size);
     // Perform the memory copy.
-    do_copy(size * sizeof(TYPE), from_view.ptr(), to_vec.data(), cptype);
+    issue_copy(size * sizeof(TYPE), from_view.ptr(), to_vec.data(), cptype);
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename TYPE>
@@ -129,13 +298,14 @@ typename data::vector_view<TYPE>::size_type copy::get_size(
     // If it *is* resizable, don't assume that the size is host-accessible.
     // Explicitly copy it for access.
     typename data::vector_view<TYPE>::size_type result = 0;
-    do_copy(sizeof(typename data::vector_view<TYPE>::size_type),
-            data.size_ptr(), &result, type::unknown);
+    issue_copy(sizeof(typename data::vector_view<TYPE>::size_type),
+               data.size_ptr(), &result,
+               deduce_copy_type(data.space(), memory_space::host));
 
     // Wait for the copy operation to finish. With some backends
     // (khm... SYCL... khm...) copies can be asynchronous even into
     // non-pinned host memory.
-    create_event()->wait();
+    issue_event()->wait();
 
     // Return what we got.
     return result;
@@ -160,10 +330,11 @@ async_size<typename data::vector_view<TYPE>::size_type> copy::get_size(
     auto value = make_unique_alloc<value_type>(pinnedHostMr);
 
     // Set up the copy into a pinned host memory buffer.
-    do_copy(sizeof(value_type), data.size_ptr(), value.get(), type::unknown);
+    issue_copy(sizeof(value_type), data.size_ptr(), value.get(),
+               deduce_copy_type(data.space(), memory_space::host));
 
     // Return the appropriate "future" value.
-    return {std::move(value), create_event()};
+    return {std::move(value), issue_event()};
 }
 
 template <typename TYPE>
@@ -177,18 +348,18 @@ copy::event_type copy::setup(data::jagged_vector_view<TYPE> data) const {
     // "Set up" the inner vector descriptors, using the host-accessible data.
     // But only if the jagged vector buffer is resizable.
     if (data.host_ptr()[0].size_ptr() != nullptr) {
-        do_memset(
+        issue_memset(
             sizeof(typename data::vector_buffer<TYPE>::size_type) * data.size(),
             data.host_ptr()[0].size_ptr(), 0);
     }
 
     // Check if anything else needs to be done.
     if (data.ptr() == data.host_ptr()) {
-        return create_event();
+        return issue_event();
     }
 
     // Copy the description of the inner vectors of the buffer.
-    do_copy(
+    issue_copy(
         data.size() *
             sizeof(
                 typename vecmem::data::jagged_vector_buffer<TYPE>::value_type),
@@ -199,7 +370,7 @@ copy::event_type copy::setup(data::jagged_vector_view<TYPE> data) const {
                      data.size());
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename TYPE>
@@ -222,8 +393,8 @@ copy::event_type copy::memset(data::jagged_vector_view<TYPE> data,
             data::vector_view<TYPE>& iv = data.host_ptr()[i];
             if ((iv.capacity() != 0u) && (iv.ptr() != nullptr)) {
                 // Call memset with its help.
-                do_memset(total_size * sizeof(TYPE), iv.ptr(), value);
-                return create_event();
+                issue_memset(total_size * sizeof(TYPE), iv.ptr(), value);
+                return issue_event();
             }
         }
         // If we are still here, apparently we didn't need to do anything.
@@ -234,12 +405,12 @@ copy::event_type copy::memset(data::jagged_vector_view<TYPE> data,
         // as that would require us to wait for each memset individually.
         for (std::size_t i = 0; i < data.size(); ++i) {
             data::vector_view<TYPE>& iv = data.host_ptr()[i];
-            do_memset(iv.capacity() * sizeof(TYPE), iv.ptr(), value);
+            issue_memset(iv.capacity() * sizeof(TYPE), iv.ptr(), value);
         }
     }
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename TYPE>
@@ -247,25 +418,173 @@ data::jagged_vector_buffer<std::remove_cv_t<TYPE>> copy::to(
     const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
     memory_resource* host_access_resource, type::copy_type cptype) const {
 
+    // Copy the payload of the inner vectors. Explicitly waiting for the copy to
+    // finish before returning the buffer.
+    auto result = to_async(data, resource, host_access_resource, cptype);
+    result.second->wait();
+
+    // Return the newly created object.
+    return std::move(result.first);
+}
+
+template <typename TYPE>
+std::pair<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>, copy::event_type>
+copy::to_async(const data::jagged_vector_view<TYPE>& data,
+               memory_resource& resource,
+               memory_resource* host_access_resource,
+               type::copy_type cptype) const {
+
     // Create the result buffer object.
     const data::buffer_type btype =
         (((data.capacity() > 0u) && (data.host_ptr()[0].size_ptr() != nullptr))
              ? data::buffer_type::resizable
              : data::buffer_type::fixed_size);
-    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> result(
-        data::get_capacities(data), resource, host_access_resource, btype);
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> result =
+        make_buffer<TYPE>(data::get_capacities(data), resource,
+                          host_access_resource, btype);
     assert(result.size() == data.size());
 
-    // Copy the description of the "inner vectors" if necessary.
-    if (host_access_resource != nullptr) {
-        setup(result)->wait();
+    // Start the copy of the payload of the inner vectors.
+    event_type event = operator()(data, result, cptype);
+
+    // Return the newly created object, with the event of the copy.
+    return {std::move(result), std::move(event)};
+}
+
+template <typename TYPE>
+copy::event_type copy::to_into(
+    const data::jagged_vector_view<TYPE>& data,
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>>& target,
+    memory_resource& resource, memory_resource* host_access_resource,
+    type::copy_type cptype) const {
+
+    // Check whether the target buffer can be used for the copy.
+    const bool from_resizable =
+        ((data.size() > 0u) && (data.host_ptr()[0].size_ptr() != nullptr));
+    const bool to_resizable =
+        ((target.size() > 0u) && (target.host_ptr()[0].size_ptr() != nullptr));
+    const auto capacities = data::get_capacities(data);
+    if ((target.resource() != &resource) ||
+        (target.host_resource() != host_access_resource) ||
+        (target.size() != data.size()) || (from_resizable && !to_resizable) ||
+        (!capacities_suffice(data::get_capacities(target), capacities,
+                             to_resizable))) {
+        // If not, re-create it.
+        VECMEM_DEBUG_MSG(2, "Re-creating a jagged buffer with %u elements",
+                         data.size());
+        target = make_buffer<TYPE>(capacities, resource, host_access_resource,
+                                   ((from_resizable || to_resizable)
+                                        ? data::buffer_type::resizable
+                                        : data::buffer_type::fixed_size));
     }
 
-    // Copy the payload of the inner vectors. Explicitly waiting for the copy to
-    // finish before returning the buffer.
+    // Perform the copy.
+    return operator()(data, target, cptype);
+}
+
+template <typename TYPE>
+data::jagged_vector_buffer<std::remove_cv_t<TYPE>> copy::to(
+    const data::jagged_vector_view<TYPE>& data, buffer_cache& cache,
+    type::copy_type cptype) const {
+
+    // Take a buffer of the right shape from the cache, or create a new one.
+    using buffer_t = data::jagged_vector_buffer<std::remove_cv_t<TYPE>>;
+    const data::buffer_type btype =
+        (((data.size() > 0u) && (data.host_ptr()[0].size_ptr() != nullptr))
+             ? data::buffer_type::resizable
+             : data::buffer_type::fixed_size);
+    const auto capacities = data::get_capacities(data);
+    buffer_t result = cache.take<buffer_t>(buffer_cache::make_key<buffer_t>(
+        btype, {capacities.begin(), capacities.end()}));
+    if (result.resource() == nullptr) {
+        result = make_buffer<TYPE>(capacities, cache.resource(),
+                                   cache.host_access_resource(), btype);
+    }
+
+    // Perform the copy, and wait for it to finish.
     operator()(data, result, cptype)->wait();
+    return result;
+}
 
-    // Return the newly created object.
+template <typename TYPE>
+data::borrowed_buffer<data::jagged_vector_view<std::add_const_t<TYPE>>>
+copy::to_borrowed(const data::jagged_vector_view<TYPE>& data,
+                  std::shared_ptr<const void> owner, memory_resource& resource,
+                  memory_resource* host_access_resource,
+                  type::copy_type cptype) const {
+
+    // Use the source's memory directly, if possible.
+    if (can_borrow(data.space(), get_memory_space(resource), cptype)) {
+        VECMEM_DEBUG_MSG(2, "Borrowing %u inner vectors at ptr: %p",
+                         data.size(), static_cast<const void*>(data.ptr()));
+        return {data, std::move(owner), true};
+    }
+
+    // If not, make a copy, and let the result own it.
+    auto buffer =
+        std::make_shared<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>>(
+            to(data, resource, host_access_resource, cptype));
+    return {*buffer, std::move(buffer), false};
+}
+
+template <typename TYPE>
+data::flat_jagged_buffer<std::remove_cv_t<TYPE>> copy::flatten(
+    const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
+    type::copy_type cptype) const {
+
+    using size_type = typename data::vector_view<TYPE>::size_type;
+
+    // Compute the offsets of the inner vectors from their sizes. The sum is
+    // accumulated with the full host precision, to notice if the total
+    // would not fit into the device-side size type.
+    const std::vector<size_type> sizes = get_sizes(data);
+    std::vector<size_type> offsets(sizes.size() + 1u, 0u);
+    std::size_t total = 0u;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        total += sizes[i];
+        if (total > std::numeric_limits<size_type>::max()) {
+            std::ostringstream msg;
+            msg << "The total size of the inner vectors exceeds the "
+                   "largest possible offset ("
+                << std::numeric_limits<size_type>::max() << ")";
+            throw std::length_error(msg.str());
+        }
+        offsets[i + 1u] = details::narrow_size<size_type>(total);
+    }
+
+    // Create the result buffer.
+    data::flat_jagged_buffer<std::remove_cv_t<TYPE>> result(
+        std::move(offsets), resource);
+
+    // Copy the offsets into the memory resource of the buffer.
+    data::vector_view<size_type> offsets_view = result.offsets();
+    issue_copy(offsets_view.capacity() * sizeof(size_type),
+               result.host_offsets().data(), offsets_view.ptr(),
+               deduce_copy_type(memory_space::host, offsets_view.space()));
+
+    // Copy all non-empty inner vectors back to back, in a single batch.
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(data.size());
+    data::vector_view<std::remove_cv_t<TYPE>> values = result.values();
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        if (sizes[i] == 0u) {
+            continue;
+        }
+        regions.push_back({data.host_ptr()[i].ptr(),
+                           values.ptr() + result.host_offsets()[i],
+                           sizes[i] * sizeof(TYPE)});
+    }
+    VECMEM_DEBUG_MSG(2,
+                     "Flattening %lu inner vector(s) with %u element(s) "
+                     "in total",
+                     regions.size(), result.n_elements());
+    copy_batch(regions, deduce_copy_type(data.space(), values.space(), cptype),
+               false);
+
+    // Wait for the copies to finish before returning the buffer.
+    issue_event()->wait();
     return result;
 }
 
@@ -276,13 +595,29 @@ copy::event_type copy::operator()(
 
     // Perform the copy. Depending on whether an actual copy has been set up /
     // performed, return either "an actual", or just a dummy event.
-    if (copy_view_impl(from_view, to_view, cptype)) {
-        return create_event();
+    details::copy_staging::batch staged;
+    if (copy_view_impl(from_view, to_view, cptype, staged)) {
+        return m_staging->attach(std::move(staged), issue_event());
     } else {
         return vecmem::copy::create_event();
     }
 }
 
+template <typename TYPE>
+copy::event_type copy::operator()(
+    const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
+    data::jagged_vector_view<TYPE> to_view, const slice& range,
+    type::copy_type cptype) const {
+
+    // Make sure that the copy can happen.
+    check_slice(range, from_view.size(), to_view.size());
+
+    // Perform the copy.
+    details::copy_staging::batch staged;
+    slice_view_impl(from_view, to_view, range, cptype, staged);
+    return m_staging->attach(std::move(staged), issue_event());
+}
+
 template <typename TYPE, typename ALLOC1, typename ALLOC2>
 copy::event_type copy::operator()(
     const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
@@ -290,14 +625,7 @@ copy::event_type copy::operator()(
     type::copy_type cptype) const {
 
     // Resize the output object to the correct size.
-    details::resize_jagged_vector(to_vec, from_view.size());
-    const auto sizes = get_sizes(from_view);
-    assert(sizes.size() == to_vec.size());
-    for (typename data::jagged_vector_view<std::add_const_t<TYPE>>::size_type
-             i = 0;
-         i < from_view.size(); ++i) {
-        to_vec[i].resize(sizes[i]);
-    }
+    details::resize_jagged_vector(to_vec, get_sizes(from_view));
 
     // Perform the memory copy.
     return operator()(from_view, vecmem::get_data(to_vec), cptype);
@@ -307,9 +635,91 @@ template <typename TYPE>
 std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
     const data::jagged_vector_view<TYPE>& data) const {
 
-    // Create the result vector.
-    std::vector<typename data::vector_view<TYPE>::size_type> result(data.size(),
-                                                                    0);
+    // Read the sizes into a new vector.
+    std::vector<typename data::vector_view<TYPE>::size_type> result;
+    read_sizes(data, result);
+    return result;
+}
+
+template <typename TYPE>
+data::jagged_vector_buffer<std::remove_cv_t<TYPE>> copy::make_buffer(
+    const std::vector<typename data::vector_view<TYPE>::size_type>&
+        capacities,
+    memory_resource& resource, memory_resource* host_access_resource,
+    data::buffer_type btype) const {
+
+    // Create the buffer.
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> result(
+        capacities, resource, host_access_resource, btype);
+
+    // Copy the description of the "inner vectors" if necessary.
+    if (host_access_resource != nullptr) {
+        setup(result)->wait();
+    }
+    return result;
+}
+
+template <typename... VARTYPES>
+edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>
+copy::make_buffer(const edm::view<edm::schema<VARTYPES...>>& data,
+                  memory_resource& resource,
+                  [[maybe_unused]] memory_resource* host_access_resource,
+                  data::buffer_type btype) const {
+
+    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> result;
+    if constexpr (edm::details::has_jagged_vector<
+                      edm::schema<VARTYPES...>>::value) {
+        // Set up a buffer that has (a) jagged vector(s).
+        result = {edm::get_capacities(data), resource, host_access_resource,
+                  btype};
+        // The idea here is that since we are going to copy data into the newly
+        // created buffer, the only thing that setup(...) needs to do is to set
+        // up "the layout" in non-host-accessible memory. (Zeroing the size
+        // variable(s) is not needed.) When doing a device-to-host copy, copying
+        // "the layout" is not actually needed. Worse yet, the copy object is
+        // not capable of memsetting the size variable(s). Since the device
+        // specific copy object cannot memset host memory.
+        //
+        // Long story short, the entire setup is skipped in the absence of a
+        // host-accessible memory resource.
+        if (host_access_resource != nullptr) {
+            setup(result)->wait();
+        }
+    } else {
+        // Set up a buffer absent of jagged vectors.
+        result = {data.capacity(), resource, btype};
+        // In the absence of jagged vectors there is no "layout" to copy. And
+        // since the size of the buffer will be set during the copy correctly,
+        // there is nothing else that setup(...) would need to do. So no need
+        // to call it here.
+    }
+
+    return result;
+}
+
+template <typename SIZE_TYPE>
+bool copy::capacities_suffice(const std::vector<SIZE_TYPE>& target,
+                              const std::vector<SIZE_TYPE>& needed,
+                              bool resizable) {
+
+    if (target.size() != needed.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        if (resizable ? (target[i] < needed[i]) : (target[i] != needed[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename TYPE>
+void copy::read_sizes(
+    const data::jagged_vector_view<TYPE>& data,
+    std::vector<typename data::vector_view<TYPE>::size_type>& result) const {
+
+    // Set up the result vector.
+    result.assign(data.size(), 0);
 
     // Try to get the "resizable sizes" first.
     for (std::size_t i = 0; i < data.size(); ++i) {
@@ -318,17 +728,17 @@ std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
         if ((data.host_ptr()[i].capacity() != 0) &&
             (data.host_ptr()[i].size_ptr() != nullptr)) {
             // Copy the sizes of the inner vectors into the result vector.
-            do_copy(sizeof(typename data::vector_view<TYPE>::size_type) *
-                        (data.size() - i),
-                    data.host_ptr()[i].size_ptr(), result.data() + i,
-                    type::unknown);
+            issue_copy(sizeof(typename data::vector_view<TYPE>::size_type) *
+                           (data.size() - i),
+                       data.host_ptr()[i].size_ptr(), result.data() + i,
+                       deduce_copy_type(data.space(), memory_space::host));
             // Wait for the copy operation to finish. With some backends
             // (khm... SYCL... khm...) copies can be asynchronous even into
             // non-pinned host memory.
-            create_event()->wait();
+            issue_event()->wait();
             // At this point the result vector should have been set up
             // correctly.
-            return result;
+            return;
         }
     }
 
@@ -337,7 +747,6 @@ std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
     for (std::size_t i = 0; i < data.size(); ++i) {
         result[i] = data.host_ptr()[i].capacity();
     }
-    return result;
 }
 
 template <typename TYPE>
@@ -345,9 +754,22 @@ copy::event_type copy::set_sizes(
     const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
     data::jagged_vector_view<TYPE> data) const {
 
+    // Perform the copy directly from the user's vector, if needed.
+    if (set_sizes_impl(sizes, data, nullptr)) {
+        return issue_event();
+    } else {
+        return vecmem::copy::create_event();
+    }
+}
+
+template <typename TYPE>
+bool copy::check_sizes(
+    const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+    const data::jagged_vector_view<TYPE>& data) {
+
     // Finish early if possible.
     if ((sizes.size() == 0) && (data.size() == 0)) {
-        return vecmem::copy::create_event();
+        return false;
     }
     // Make sure that the sizes match up.
     if (sizes.size() != data.size()) {
@@ -379,17 +801,28 @@ copy::event_type copy::set_sizes(
                 "Inconsistent target jagged vector view received for resizing");
         }
     }
+    return perform_copy;
+}
+
+template <typename TYPE>
+bool copy::set_sizes_impl(
+    const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+    data::jagged_vector_view<TYPE> data,
+    details::copy_staging::batch* staged) const {
+
     // If no copy is necessary, we're done.
-    if (perform_copy == false) {
-        return vecmem::copy::create_event();
+    if (check_sizes(sizes, data) == false) {
+        return false;
     }
     // Perform the copy with some internal knowledge of how resizable jagged
     // vector buffers work.
-    do_copy(sizeof(typename data::vector_view<TYPE>::size_type) * sizes.size(),
-            sizes.data(), data.host_ptr()->size_ptr(), type::unknown);
-
-    // Return a new event.
-    return create_event();
+    issue_copy(
+        sizeof(typename data::vector_view<TYPE>::size_type) * sizes.size(),
+        ((staged != nullptr)
+             ? m_staging->stage(*staged, sizes.data(), sizes.size())
+             : sizes.data()),
+        data.host_ptr()->size_ptr(), type::unknown);
+    return true;
 }
 
 template <typename TYPE>
@@ -409,12 +842,12 @@ async_sizes<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
                 data.size(), 0, &pinnedHostMr);
 
             // Copy the sizes of the inner vectors into the result vector.
-            do_copy(sizeof(typename data::vector_view<TYPE>::size_type) *
-                        (data.size() - i),
-                    data.host_ptr()[i].size_ptr(), result.data() + i,
-                    type::unknown);
+            issue_copy(sizeof(typename data::vector_view<TYPE>::size_type) *
+                           (data.size() - i),
+                       data.host_ptr()[i].size_ptr(), result.data() + i,
+                       deduce_copy_type(data.space(), memory_space::host));
             // Return the appropriate "future" value.
-            return {std::move(result), create_event()};
+            return {std::move(result), issue_event()};
         }
     }
 
@@ -431,17 +864,19 @@ template <typename SCHEMA>
 copy::event_type copy::setup(edm::view<SCHEMA> data) const {
 
     // Copy the data layout to the device, if needed.
+    details::copy_staging::batch staged;
     if (data.layout().ptr() != data.host_layout().ptr()) {
         assert(data.layout().capacity() > 0u);
-        [[maybe_unused]] bool did_copy =
-            copy_view_impl(data.host_layout(), data.layout(), type::unknown);
+        [[maybe_unused]] bool did_copy = copy_view_impl(
+            data.host_layout(), data.layout(), type::unknown, staged);
         assert(did_copy);
     }
 
     // Initialize the "size variable(s)" correctly on the buffer.
     if (data.size().ptr() != nullptr) {
         assert(data.size().capacity() > 0u);
-        do_memset(data.size().capacity() * sizeof(char), data.size().ptr(), 0);
+        issue_memset(data.size().capacity() * sizeof(char), data.size().ptr(),
+                     0);
     }
     VECMEM_DEBUG_MSG(3,
                      "Prepared an SoA container of capacity %u "
@@ -451,7 +886,7 @@ copy::event_type copy::setup(edm::view<SCHEMA> data) const {
                      data.size().size(), static_cast<void*>(data.size().ptr()));
 
     // Return a new event.
-    return create_event();
+    return m_staging->attach(std::move(staged), issue_event());
 }
 
 template <typename... VARTYPES>
@@ -467,60 +902,151 @@ copy::event_type copy::memset(edm::view<edm::schema<VARTYPES...>> data,
     }
 
     // Return a new event.
-    return create_event();
+    return issue_event();
 }
 
 template <typename... VARTYPES>
 edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> copy::to(
     const edm::view<edm::schema<VARTYPES...>>& data, memory_resource& resource,
-    [[maybe_unused]] memory_resource* host_access_resource,
-    type::copy_type cptype) const {
+    memory_resource* host_access_resource, type::copy_type cptype) const {
+
+    // Perform the copy. Explicitly waiting for it to finish before returning
+    // the buffer.
+    auto result = to_async(data, resource, host_access_resource, cptype);
+    result.second->wait();
+
+    // Return the buffer.
+    return std::move(result.first);
+}
+
+template <typename... VARTYPES>
+std::pair<edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>,
+          copy::event_type>
+copy::to_async(const edm::view<edm::schema<VARTYPES...>>& data,
+               memory_resource& resource,
+               memory_resource* host_access_resource,
+               type::copy_type cptype) const {
 
     // Create the result buffer object.
     const data::buffer_type btype =
         ((data.size().ptr() != nullptr) ? data::buffer_type::resizable
                                         : data::buffer_type::fixed_size);
-    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> result;
+    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> result =
+        make_buffer(data, resource, host_access_resource, btype);
+
+    // Start the copy.
+    event_type event = operator()(data, result, cptype);
+
+    // Return the buffer, with the event of the copy.
+    return {std::move(result), std::move(event)};
+}
+
+template <typename... VARTYPES>
+copy::event_type copy::to_into(
+    const edm::view<edm::schema<VARTYPES...>>& data,
+    edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>& target,
+    memory_resource& resource, memory_resource* host_access_resource,
+    type::copy_type cptype) const {
+
+    // Check whether the target buffer can be used for the copy.
+    const bool from_resizable = (data.size().ptr() != nullptr);
+    const bool to_resizable = (target.size().ptr() != nullptr);
+    bool suitable =
+        ((target.resource() == &resource) && (!from_resizable || to_resizable));
     if constexpr (edm::details::has_jagged_vector<
                       edm::schema<VARTYPES...>>::value) {
-        // Set up a buffer that has (a) jagged vector(s).
-        result = {edm::get_capacities(data), resource, host_access_resource,
-                  btype};
-        // The idea here is that since we are going to copy data into the newly
-        // created buffer, the only thing that setup(...) needs to do is to set
-        // up "the layout" in non-host-accessible memory. (Zeroing the size
-        // variable(s) is not needed.) When doing a device-to-host copy, copying
-        // "the layout" is not actually needed. Worse yet, the copy object is
-        // not capable of memsetting the size variable(s). Since the device
-        // specific copy object cannot memset host memory.
-        //
-        // Long story short, the entire setup is skipped in the absence of a
-        // host-accessible memory resource.
-        if (host_access_resource != nullptr) {
-            setup(result)->wait();
-        }
+        suitable = (suitable &&
+                    (target.host_resource() == host_access_resource) &&
+                    (target.capacity() == data.capacity()) &&
+                    capacities_suffice(edm::get_capacities(target),
+                                       edm::get_capacities(data),
+                                       to_resizable));
     } else {
-        // Set up a buffer absent of jagged vectors.
-        result = {data.capacity(), resource, btype};
-        // In the absence of jagged vectors there is no "layout" to copy. And
-        // since the size of the buffer will be set during the copy correctly,
-        // there is nothing else that setup(...) would need to do. So no need
-        // to call it here.
+        using size_type =
+            typename edm::view<edm::schema<VARTYPES...>>::size_type;
+        suitable =
+            (suitable && capacities_suffice(
+                             std::vector<size_type>{target.capacity()},
+                             std::vector<size_type>{data.capacity()},
+                             to_resizable));
+    }
+
+    // If it can not, re-create it.
+    if (!suitable) {
+        VECMEM_DEBUG_MSG(2, "Re-creating an SoA buffer with capacity %u",
+                         data.capacity());
+        target = make_buffer(data, resource, host_access_resource,
+                             ((from_resizable || to_resizable)
+                                  ? data::buffer_type::resizable
+                                  : data::buffer_type::fixed_size));
+    }
+
+    // Perform the copy.
+    return operator()(data, target, cptype);
+}
+
+template <typename... VARTYPES>
+edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>> copy::to(
+    const edm::view<edm::schema<VARTYPES...>>& data, buffer_cache& cache,
+    type::copy_type cptype) const {
+
+    // Take a buffer of the right shape from the cache, or create a new one.
+    using buffer_t =
+        edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>;
+    const data::buffer_type btype =
+        ((data.size().ptr() != nullptr) ? data::buffer_type::resizable
+                                        : data::buffer_type::fixed_size);
+    std::vector<std::size_t> capacities{data.capacity()};
+    if constexpr (edm::details::has_jagged_vector<
+                      edm::schema<VARTYPES...>>::value) {
+        const auto inner = edm::get_capacities(data);
+        capacities.insert(capacities.end(), inner.begin(), inner.end());
+    }
+    buffer_t result = cache.take<buffer_t>(
+        buffer_cache::make_key<buffer_t>(btype, std::move(capacities)));
+    if (result.resource() == nullptr) {
+        result = make_buffer(data, cache.resource(),
+                             cache.host_access_resource(), btype);
     }
 
-    // Perform the copy.
+    // Perform the copy, and wait for it to finish.
     operator()(data, result, cptype)->wait();
-
-    // Return the buffer.
     return result;
 }
 
+template <typename... VARTYPES>
+data::borrowed_buffer<
+    edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>>
+copy::to_borrowed(const edm::view<edm::schema<VARTYPES...>>& data,
+                  std::shared_ptr<const void> owner, memory_resource& resource,
+                  memory_resource* host_access_resource,
+                  type::copy_type cptype) const {
+
+    // Use the source's memory directly, if possible.
+    if (can_borrow(data.payload().space(), get_memory_space(resource),
+                   cptype)) {
+        VECMEM_DEBUG_MSG(2, "Borrowing a container with capacity %u",
+                         data.capacity());
+        return {data, std::move(owner), true};
+    }
+
+    // If not, make a copy, and let the result own it.
+    auto buffer = std::make_shared<
+        edm::buffer<edm::details::remove_cv_t<edm::schema<VARTYPES...>>>>(
+        to(data, resource, host_access_resource, cptype));
+    return {*buffer, std::move(buffer), false};
+}
+
 template <typename... VARTYPES>
 copy::event_type copy::operator()(
     const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
         from_view,
     edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype) const {
 
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.payload().space(),
+                              to_view.payload().space(), cptype);
+
     // First, handle the simple case, when both views have a contiguous memory
     // layout.
     if ((from_view.payload().ptr() != nullptr) &&
@@ -537,7 +1063,8 @@ copy::event_type copy::operator()(
                          from_view.payload().size());
 
         // Copy the payload with a single copy operation.
-        copy_view_impl(from_view.payload(), to_view.payload(), cptype);
+        details::copy_staging::batch staged;
+        copy_view_impl(from_view.payload(), to_view.payload(), cptype, staged);
 
         // If the target view is resizable, set its size.
         if (to_view.size().ptr() != nullptr) {
@@ -553,22 +1080,129 @@ copy::event_type copy::operator()(
                     throw std::length_error(msg.str());
                 }
                 // Perform a dumb copy.
-                copy_view_impl(from_view.size(), to_view.size(), cptype);
+                copy_view_impl(from_view.size(), to_view.size(), cptype,
+                               staged);
             } else {
                 // If not, then copy the size(s) recursively.
-                copy_sizes_impl<0>(from_view, to_view, cptype);
+                copy_sizes_impl<0>(from_view, to_view, cptype, staged);
             }
         }
 
         // Create a synchronization event.
-        return create_event();
+        return m_staging->attach(std::move(staged), issue_event());
+    }
+
+    // If not, then copy the variables one-by-one. Collecting the payload of
+    // the scalar and 1D vector variables into a single batch.
+    details::copy_staging::batch staged;
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(sizeof...(VARTYPES));
+    copy_payload_impl<0>(from_view, to_view, cptype,
+                         std::bitset<sizeof...(VARTYPES)>{}.set(), staged,
+                         regions);
+    copy_batch(regions, cptype, false);
+
+    // Return a new event.
+    return m_staging->attach(std::move(staged), issue_event());
+}
+
+template <std::size_t... INDICES, typename... VARTYPES>
+copy::event_type copy::operator()(
+    std::index_sequence<INDICES...>,
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype) const {
+
+    // Make sure that the indices are valid.
+    static_assert(sizeof...(INDICES) > 0, "No variables selected");
+    static_assert(((INDICES < sizeof...(VARTYPES)) && ...),
+                  "Variable index out of range");
+
+    // Perform the copy with the equivalent runtime mask.
+    std::bitset<sizeof...(VARTYPES)> columns;
+    (columns.set(INDICES), ...);
+    return (*this)(columns, from_view, to_view, cptype);
+}
+
+template <typename... VARTYPES>
+copy::event_type copy::operator()(
+    const std::bitset<sizeof...(VARTYPES)>& columns,
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype) const {
+
+    // If all variables are selected, perform a "normal" copy.
+    if (columns.all()) {
+        return (*this)(from_view, to_view, cptype);
+    }
+    if (columns.none()) {
+        return vecmem::copy::create_event();
     }
 
-    // If not, then do an un-optimized copy, variable-by-variable.
-    copy_payload_impl<0>(from_view, to_view, cptype);
+    // Let the user know what's happening.
+    VECMEM_DEBUG_MSG(2, "Copying %lu out of %lu SoA variables", columns.count(),
+                     columns.size());
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.payload().space(),
+                              to_view.payload().space(), cptype);
+
+    // Copy the selected variables one-by-one. Even if the views have a
+    // contiguous memory layout.
+    details::copy_staging::batch staged;
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(columns.count());
+    copy_payload_impl<0>(from_view, to_view, cptype, columns, staged, regions);
+    copy_batch(regions, cptype, false);
+
+    // Return a new event.
+    return m_staging->attach(std::move(staged), issue_event());
+}
+
+template <std::size_t... INDICES, typename... VARTYPES>
+edm::buffer<edm::details::remove_cv_t<
+    edm::details::select_t<edm::schema<VARTYPES...>, INDICES...>>>
+copy::to(std::index_sequence<INDICES...>,
+         const edm::view<edm::schema<VARTYPES...>>& data,
+         memory_resource& resource, memory_resource* host_access_resource,
+         type::copy_type cptype) const {
+
+    // Copy a view of the selected variables.
+    return to(edm::select<INDICES...>(data), resource, host_access_resource,
+              cptype);
+}
+
+template <typename... VARTYPES>
+copy::event_type copy::operator()(
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view, const slice& range,
+    type::copy_type cptype) const {
+
+    // Make sure that the copy can happen. For resizable sources only the
+    // elements within the current size may be copied.
+    check_slice(range, get_size(from_view), to_view.capacity());
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.payload().space(),
+                              to_view.payload().space(), cptype);
+
+    // Copy the (jagged) vector variables one-by-one. Collecting the payload
+    // of the 1D vector variables into a single batch.
+    details::copy_staging::batch staged;
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(sizeof...(VARTYPES));
+    slice_payload_impl<0>(from_view, to_view, range, cptype, staged, regions);
+    copy_batch(regions, cptype, false);
 
     // Return a new event.
-    return create_event();
+    return m_staging->attach(std::move(staged), issue_event());
 }
 
 template <typename... VARTYPES, template <typename> class INTERFACE>
@@ -578,6 +1212,10 @@ copy::event_type copy::operator()(
     edm::host<edm::schema<VARTYPES...>, INTERFACE>& to_vec,
     type::copy_type cptype) const {
 
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.payload().space(), memory_space::host,
+                              cptype);
+
     // Resize the output object to the correct size(s).
     resize_impl<0>(from_view, to_vec, cptype);
 
@@ -612,12 +1250,14 @@ typename edm::view<edm::schema<VARTYPES...>>::size_type copy::get_size(
         assert(data.size().size() == sizeof(value_type));
 
         // Get the exact size of the container.
-        do_copy(sizeof(value_type), data.size().ptr(), &size, type::unknown);
+        issue_copy(
+            sizeof(value_type), data.size().ptr(), &size,
+            deduce_copy_type(data.payload().space(), memory_space::host));
         // We have to wait for this to finish, since the "size" variable is
         // not going to be available outside of this function. And
         // asynchronous SYCL memory copies can happen from variables on the
         // stack as well...
-        create_event()->wait();
+        issue_event()->wait();
 
         // Return what we got.
         return size;
@@ -659,11 +1299,12 @@ copy::get_size(const edm::view<edm::schema<VARTYPES...>>& data,
         auto value = make_unique_alloc<value_type>(pinnedHostMr);
 
         // Get the exact size of the container.
-        do_copy(sizeof(value_type), data.size().ptr(), value.get(),
-                type::unknown);
+        issue_copy(
+            sizeof(value_type), data.size().ptr(), value.get(),
+            deduce_copy_type(data.payload().space(), memory_space::host));
 
         // Return the appropriate "future" value.
-        return {std::move(value), create_event()};
+        return {std::move(value), issue_event()};
     }
 }
 
@@ -689,10 +1330,80 @@ async_sizes<data::vector_view<int>::size_type> copy::get_sizes(
     return get_sizes_impl<0>(data, pinnedHostMr);
 }
 
+template <typename TYPE>
+copy_plan copy::make_plan(
+    const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
+    data::jagged_vector_view<TYPE> to_view, type::copy_type cptype) const {
+
+    // Collect the copy operations into a new plan.
+    copy_plan plan;
+    plan.m_copy_type = static_cast<int>(
+        deduce_copy_type(from_view.space(), to_view.space(), cptype));
+    plan_view_impl(plan, from_view, to_view);
+    finalize_plan(plan);
+    return plan;
+}
+
+template <typename... VARTYPES>
+copy_plan copy::make_plan(
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype) const {
+
+    // Create the plan.
+    copy_plan plan;
+    plan.m_copy_type = static_cast<int>(deduce_copy_type(
+        from_view.payload().space(), to_view.payload().space(), cptype));
+
+    // Handle the simple case the same way as the copy operator does.
+    if ((from_view.payload().ptr() != nullptr) &&
+        (to_view.payload().ptr() != nullptr) &&
+        (from_view.payload().capacity() == to_view.payload().capacity())) {
+
+        // If the "common size" is zero, there's nothing to do.
+        if (from_view.payload().capacity() != 0) {
+            // Copy the payload with a single copy operation.
+            plan_view_impl(plan, from_view.payload(), to_view.payload());
+            // If the target view is resizable, set its size.
+            if (to_view.size().ptr() != nullptr) {
+                if (from_view.size().ptr() != nullptr) {
+                    // Check that the sizes are the same.
+                    if (from_view.size().capacity() !=
+                        to_view.size().capacity()) {
+                        std::ostringstream msg;
+                        msg << "from_view.size().capacity() ("
+                            << from_view.size().capacity()
+                            << ") != to_view.size().capacity() ("
+                            << to_view.size().capacity() << ")";
+                        throw std::length_error(msg.str());
+                    }
+                    // Plan a dumb copy.
+                    plan_view_impl(plan, from_view.size(), to_view.size());
+                } else {
+                    // The sizes are known up front in this case.
+                    plan_sizes_impl<0>(plan, from_view, to_view);
+                }
+            }
+        }
+    } else {
+        // If not, then plan the copy of the variables one-by-one.
+        plan_payload_impl<0>(plan, from_view, to_view);
+    }
+
+    // Return the finished plan.
+    finalize_plan(plan);
+    return plan;
+}
+
 template <typename TYPE>
 bool copy::copy_view_impl(
     const data::vector_view<std::add_const_t<TYPE>>& from_view,
-    data::vector_view<TYPE> to_view, type::copy_type cptype) const {
+    data::vector_view<TYPE> to_view, type::copy_type cptype,
+    details::copy_staging::batch& staged,
+    std::vector<copy_region>* regions) const {
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.space(), to_view.space(), cptype);
 
     // Get the size of the source view.
     const typename data::vector_view<std::add_const_t<TYPE>>::size_type size =
@@ -716,37 +1427,99 @@ bool copy::copy_view_impl(
         // Select what type of copy this should be. Keeping in mind that we copy
         // from a variable on the host stack. So the question is just whether
         // the target is the host, or a device.
-        type::copy_type size_cptype = type::unknown;
-        switch (cptype) {
-            case type::host_to_device:
-            case type::device_to_device:
-                size_cptype = type::host_to_device;
-                break;
-            case type::device_to_host:
-            case type::host_to_host:
-                size_cptype = type::host_to_host;
-                break;
-            default:
-                break;
-        }
-        // Perform the copy.
-        do_copy(sizeof(typename data::vector_view<TYPE>::size_type), &size,
-                to_view.size_ptr(), size_cptype);
-        // We have to wait for this to finish, since the "size" variable is not
-        // going to be available outside of this function. And asynchronous SYCL
-        // memory copies can happen from variables on the stack as well...
-        create_event()->wait();
+        const type::copy_type size_cptype = host_copy_type(cptype);
+        // Perform the copy. Since the "size" variable is not going to be
+        // available outside of this function, copy it from staging memory,
+        // which stays alive until the operation's event finishes.
+        issue_copy(sizeof(typename data::vector_view<TYPE>::size_type),
+                   m_staging->stage(staged, &size, 1u), to_view.size_ptr(),
+                   size_cptype);
     }
 
-    // Copy the payload.
-    do_copy(size * sizeof(TYPE), from_view.ptr(), to_view.ptr(), cptype);
+    // Copy the payload, or just record it for a batched copy.
+    if (regions != nullptr) {
+        regions->push_back(
+            {from_view.ptr(), to_view.ptr(), size * sizeof(TYPE)});
+    } else {
+        issue_copy(size * sizeof(TYPE), from_view.ptr(), to_view.ptr(), cptype);
+    }
     return true;
 }
 
+template <typename TYPE>
+void copy::slice_view_impl(
+    const data::vector_view<std::add_const_t<TYPE>>& from_view,
+    data::vector_view<TYPE> to_view, const slice& range, type::copy_type cptype,
+    details::copy_staging::batch& staged,
+    std::vector<copy_region>* regions) const {
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.space(), to_view.space(), cptype);
+
+    // The range is expected to have been checked already.
+    assert(range.begin <= range.end);
+    assert(range.end <= from_view.capacity());
+    assert(range.offset + (range.end - range.begin) <= to_view.capacity());
+    const std::size_t size = range.end - range.begin;
+
+    // Set the size of resizable targets from staging memory.
+    if (to_view.size_ptr() != nullptr) {
+        const typename data::vector_view<TYPE>::size_type to_size =
+            static_cast<typename data::vector_view<TYPE>::size_type>(
+                range.offset + size);
+        issue_copy(sizeof(to_size), m_staging->stage(staged, &to_size, 1u),
+                   to_view.size_ptr(), host_copy_type(cptype));
+    }
+
+    // Copy the payload, or just record it for a batched copy.
+    if (size == 0u) {
+        return;
+    }
+    const copy_region region{from_view.ptr() + range.begin,
+                             to_view.ptr() + range.offset,
+                             size * sizeof(TYPE)};
+    if (regions != nullptr) {
+        regions->push_back(region);
+    } else {
+        issue_copy(region.m_size, region.m_from, region.m_to, cptype);
+    }
+}
+
+template <typename TYPE>
+void copy::slice_view_impl(
+    const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
+    data::jagged_vector_view<TYPE> to_view, const slice& range,
+    type::copy_type cptype, details::copy_staging::batch& staged) const {
+
+    // The range is expected to have been checked already.
+    assert(range.begin <= range.end);
+    assert(range.end <= from_view.size());
+    assert(range.offset + (range.end - range.begin) <= to_view.size());
+    const std::size_t size = range.end - range.begin;
+    if (size == 0u) {
+        return;
+    }
+
+    // Copy between views of just the selected inner vectors. Which lets the
+    // copy use all of its usual optimisations.
+    using size_type = typename data::jagged_vector_view<TYPE>::size_type;
+    const data::jagged_vector_view<std::add_const_t<TYPE>> from_slice(
+        static_cast<size_type>(size), from_view.ptr() + range.begin,
+        from_view.host_ptr() + range.begin, from_view.space());
+    const data::jagged_vector_view<TYPE> to_slice(
+        static_cast<size_type>(size), to_view.ptr() + range.offset,
+        to_view.host_ptr() + range.offset, to_view.space());
+    copy_view_impl(from_slice, to_slice, cptype, staged);
+}
+
 template <typename TYPE>
 bool copy::copy_view_impl(
     const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
-    data::jagged_vector_view<TYPE> to_view, type::copy_type cptype) const {
+    data::jagged_vector_view<TYPE> to_view, type::copy_type cptype,
+    details::copy_staging::batch& staged) const {
+
+    // Pick the copy type from the memory spaces, if it was not specified.
+    cptype = deduce_copy_type(from_view.space(), to_view.space(), cptype);
 
     // Sanity checks.
     if (from_view.size() > to_view.size()) {
@@ -769,19 +1542,13 @@ bool copy::copy_view_impl(
     VECMEM_DEBUG_MSG(3, "from_is_contiguous = %d, to_is_contiguous = %d",
                      from_is_contiguous, to_is_contiguous);
 
-    // Get the sizes of the source jagged vector.
-    const auto sizes = get_sizes(from_view);
-
-    // Before even attempting the copy, make sure that the target view either
-    // has the correct sizes, or can be resized correctly. Captire the event
-    // marking the end of the operation. We need to wait for the copy to finish
-    // before returning from this function.
-    auto set_sizes_event = set_sizes(sizes, to_view);
-
     // Check whether the source and target capacities match up. We can only
     // perform the "optimised copy" if they do.
-    std::vector<typename data::vector_view<std::add_const_t<TYPE>>::size_type>
-        capacities(size);
+    details::copy_scratch::lease<details::copy_scratch::size_type>
+        capacities_lease = details::copy_scratch::sizes();
+    std::vector<typename data::vector_view<std::add_const_t<TYPE>>::size_type>&
+        capacities = *capacities_lease;
+    capacities.resize(size);
     bool capacities_match = true;
     for (std::size_t i = 0; i < size; ++i) {
         if (from_view.host_ptr()[i].capacity() !=
@@ -792,6 +1559,33 @@ bool copy::copy_view_impl(
         capacities[i] = from_view.host_ptr()[i].capacity();
     }
 
+    // If both views are resizable buffers with identical layouts, the sizes
+    // can be copied without ever bringing them to the host.
+    if (from_is_contiguous && to_is_contiguous && capacities_match &&
+        (from_view.size() == to_view.size()) &&
+        has_contiguous_sizes(from_view.host_ptr(), size) &&
+        has_contiguous_sizes(to_view.host_ptr(), size)) {
+        issue_copy(sizeof(typename data::vector_view<TYPE>::size_type) * size,
+                   from_view.host_ptr()->size_ptr(),
+                   to_view.host_ptr()->size_ptr(), cptype);
+        copy_views_contiguous_impl(capacities, from_view.host_ptr(),
+                                   to_view.host_ptr(), cptype);
+        return true;
+    }
+
+    // Get the sizes of the source jagged vector.
+    details::copy_scratch::lease<details::copy_scratch::size_type>
+        sizes_lease = details::copy_scratch::sizes();
+    std::vector<typename data::vector_view<TYPE>::size_type>& sizes =
+        *sizes_lease;
+    read_sizes(from_view, sizes);
+
+    // Before even attempting the copy, make sure that the target view either
+    // has the correct sizes, or can be resized correctly. The sizes are
+    // copied from staging memory, since the "sizes" variable is about to go
+    // out of scope.
+    set_sizes_impl(sizes, to_view, &staged);
+
     // Perform the copy as best as we can.
     if (from_is_contiguous && to_is_contiguous && capacities_match) {
         // Perform the copy in one go.
@@ -800,14 +1594,11 @@ bool copy::copy_view_impl(
     } else {
         // Do the copy as best as we can. Note that since they are not
         // contiguous anyway, we use the sizes of the vectors here, not their
-        // capcities.
+        // capcities. The unused memory between the inner vectors may only be
+        // copied along if both views live in single memory blocks.
         copy_views_impl(sizes, from_view.host_ptr(), to_view.host_ptr(),
-                        cptype);
+                        cptype, (from_is_contiguous && to_is_contiguous));
     }
-
-    // Before returning, make sure that the "size set" operation has finished.
-    // Because the "sizes" variable is just about to go out of scope.
-    set_sizes_event->wait();
     return true;
 }
 
@@ -815,7 +1606,8 @@ template <typename TYPE>
 void copy::copy_views_impl(
     const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
     const data::vector_view<std::add_const_t<TYPE>>* from_view,
-    data::vector_view<TYPE>* to_view, type::copy_type cptype) const {
+    data::vector_view<TYPE>* to_view, type::copy_type cptype,
+    bool allow_padding) const {
 
     // Some security checks.
     assert(from_view != nullptr);
@@ -823,9 +1615,12 @@ void copy::copy_views_impl(
 
     // Helper variable(s) used in the copy.
     const std::size_t size = sizes.size();
-    [[maybe_unused]] std::size_t copy_ops = 0;
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(size);
 
-    // Perform the copy in multiple steps.
+    // Collect the memory regions to copy.
     for (std::size_t i = 0; i < size; ++i) {
 
         // Skip empty "inner vectors".
@@ -839,17 +1634,19 @@ void copy::copy_views_impl(
         assert(sizes[i] <= from_view[i].capacity());
         assert(sizes[i] <= to_view[i].capacity());
 
-        // Perform the copy.
-        do_copy(sizes[i] * sizeof(TYPE), from_view[i].ptr(), to_view[i].ptr(),
-                cptype);
-        ++copy_ops;
+        // Record the region.
+        regions.push_back(
+            {from_view[i].ptr(), to_view[i].ptr(), sizes[i] * sizeof(TYPE)});
     }
 
+    // Perform the copy, with as few operations as possible.
+    copy_batch(regions, cptype, allow_padding);
+
     // Let the user know what happened.
     VECMEM_DEBUG_MSG(2,
                      "Copied the payload of a jagged vector of type "
                      "\"%s\" with %lu copy operation(s)",
-                     typeid(TYPE).name(), copy_ops);
+                     typeid(TYPE).name(), regions.size());
 }
 
 template <typename TYPE>
@@ -884,7 +1681,7 @@ void copy::copy_views_contiguous_impl(
         assert(to_view[i].ptr() != nullptr);
 
         // Perform the copy.
-        do_copy(total_size, from_view[i].ptr(), to_view[i].ptr(), cptype);
+        issue_copy(total_size, from_view[i].ptr(), to_view[i].ptr(), cptype);
         break;
     }
 
@@ -895,6 +1692,179 @@ void copy::copy_views_contiguous_impl(
                      typeid(TYPE).name());
 }
 
+template <typename TYPE>
+void copy::plan_view_impl(
+    copy_plan& plan, const data::vector_view<std::add_const_t<TYPE>>& from_view,
+    data::vector_view<TYPE> to_view) const {
+
+    // The size of resizable sources can only be read during the execution.
+    if (from_view.size_ptr() != nullptr) {
+        copy_plan::dynamic_part part;
+        part.m_element_size = sizeof(TYPE);
+        part.m_from_sizes = from_view.size_ptr();
+        part.m_to_sizes = to_view.size_ptr();
+        part.m_inner.push_back({from_view.ptr(), to_view.ptr(), 0u});
+        part.m_to_capacities.push_back(to_view.capacity());
+        plan.m_dynamic.push_back(std::move(part));
+        return;
+    }
+
+    // Otherwise the full capacity of the source is copied.
+    const typename data::vector_view<TYPE>::size_type size =
+        from_view.capacity();
+    if (size == 0u) {
+        return;
+    }
+    if (to_view.capacity() < size) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to_view.capacity() << ") < source size ("
+            << size << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Set the size of resizable targets from the plan's own memory.
+    if (to_view.size_ptr() != nullptr) {
+        plan.m_host_regions.push_back({plan.store(&size, sizeof(size)),
+                                       to_view.size_ptr(), sizeof(size)});
+    }
+    plan.m_regions.push_back(
+        {from_view.ptr(), to_view.ptr(), size * sizeof(TYPE)});
+}
+
+template <typename TYPE>
+void copy::plan_view_impl(
+    copy_plan& plan,
+    const data::jagged_vector_view<std::add_const_t<TYPE>>& from_view,
+    data::jagged_vector_view<TYPE> to_view) const {
+
+    // Sanity checks.
+    if (from_view.size() > to_view.size()) {
+        std::ostringstream msg;
+        msg << "from_view.size() (" << from_view.size()
+            << ") > to_view.size() (" << to_view.size() << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Get the "outer size" of the container.
+    const std::size_t size = from_view.size();
+    if (size == 0u) {
+        return;
+    }
+    const data::vector_view<std::add_const_t<TYPE>>* from =
+        from_view.host_ptr();
+    data::vector_view<TYPE>* to = to_view.host_ptr();
+
+    // Make all the decisions that the copy operator makes every time.
+    const bool from_is_contiguous = is_contiguous(from, size);
+    const bool to_is_contiguous = is_contiguous(to, size);
+    bool capacities_match = true;
+    std::vector<typename data::vector_view<TYPE>::size_type> capacities(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        capacities[i] = from[i].capacity();
+        if (capacities[i] != to[i].capacity()) {
+            capacities_match = false;
+        }
+    }
+    const bool contiguous_copy =
+        (from_is_contiguous && to_is_contiguous && capacities_match);
+    VECMEM_DEBUG_MSG(3,
+                     "Planning jagged vector copy with from_is_contiguous = "
+                     "%d, to_is_contiguous = %d, capacities_match = %d",
+                     from_is_contiguous, to_is_contiguous, capacities_match);
+
+    // Find the first resizable inner vector of the source, the same way
+    // that get_sizes(...) does.
+    std::size_t first_resizable = size;
+    for (std::size_t i = 0; i < size; ++i) {
+        if ((from[i].capacity() != 0) && (from[i].size_ptr() != nullptr)) {
+            first_resizable = i;
+            break;
+        }
+    }
+
+    // Helper lambda for planning the copy of a contiguous payload.
+    auto plan_contiguous_payload = [&]() {
+        const std::size_t total_size =
+            std::accumulate(capacities.begin(), capacities.end(),
+                            static_cast<std::size_t>(0)) *
+            sizeof(TYPE);
+        for (std::size_t i = 0; i < size; ++i) {
+            if (capacities[i] != 0) {
+                plan.m_regions.push_back(
+                    {from[i].ptr(), to[i].ptr(), total_size});
+                break;
+            }
+        }
+    };
+
+    // If both views are resizable buffers with identical layouts, the sizes
+    // can be copied directly between them.
+    if (contiguous_copy && (from_view.size() == to_view.size()) &&
+        has_contiguous_sizes(from, size) && has_contiguous_sizes(to, size)) {
+        plan.m_regions.push_back(
+            {from->size_ptr(), to->size_ptr(),
+             sizeof(typename data::vector_view<TYPE>::size_type) * size});
+        plan_contiguous_payload();
+        return;
+    }
+
+    // Handle sources with sizes that are only known at execution time.
+    if (first_resizable < size) {
+        // The sizes don't matter for copies of the full capacity into
+        // non-resizable targets. For everything else they need to be read.
+        const bool to_resizable = check_sizes(
+            std::vector<typename data::vector_view<TYPE>::size_type>(size, 0),
+            to_view);
+        if (contiguous_copy && (to_resizable == false)) {
+            plan_contiguous_payload();
+            return;
+        }
+        copy_plan::dynamic_part part;
+        part.m_element_size = sizeof(TYPE);
+        part.m_from_sizes = from[first_resizable].size_ptr();
+        part.m_first = first_resizable;
+        part.m_to_sizes = (to_resizable ? to->size_ptr() : nullptr);
+        part.m_inner.reserve(size);
+        part.m_to_capacities.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            part.m_inner.push_back({from[i].ptr(), to[i].ptr(), 0u});
+            part.m_to_capacities.push_back(to[i].capacity());
+        }
+        part.m_allow_padding = (from_is_contiguous && to_is_contiguous);
+        plan.m_dynamic.push_back(std::move(part));
+        return;
+    }
+
+    // If the source is not resizable, the sizes of its inner vectors are
+    // their capacities. Set them on the target from the plan's own memory.
+    if (check_sizes(capacities, to_view)) {
+        plan.m_host_regions.push_back(
+            {plan.store(capacities.data(),
+                        sizeof(typename data::vector_view<TYPE>::size_type) *
+                            size),
+             to->size_ptr(),
+             sizeof(typename data::vector_view<TYPE>::size_type) * size});
+    }
+
+    // Plan the copy of the payload.
+    if (contiguous_copy) {
+        plan_contiguous_payload();
+    } else {
+        std::vector<copy_region> regions;
+        regions.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            regions.push_back(
+                {from[i].ptr(), to[i].ptr(), capacities[i] * sizeof(TYPE)});
+        }
+        merge_copy_regions(regions,
+                           ((from_is_contiguous && to_is_contiguous)
+                                ? max_copy_padding()
+                                : 0u));
+        plan.m_regions.insert(plan.m_regions.end(), regions.begin(),
+                              regions.end());
+    }
+}
+
 template <typename TYPE>
 bool copy::is_contiguous(const data::vector_view<TYPE>* data,
                          std::size_t size) {
@@ -913,6 +1883,23 @@ bool copy::is_contiguous(const data::vector_view<TYPE>* data,
     return true;
 }
 
+template <typename TYPE>
+bool copy::has_contiguous_sizes(const data::vector_view<TYPE>* data,
+                                std::size_t size) {
+
+    // We should never call this function for an empty jagged vector.
+    assert(size > 0);
+
+    // Check whether all size variables are next to each other.
+    for (std::size_t i = 0; i < size; ++i) {
+        if ((data[i].size_ptr() == nullptr) ||
+            (data[i].size_ptr() != (data[0].size_ptr() + i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <std::size_t INDEX, typename... VARTYPES>
 void copy::memset_impl(edm::view<edm::schema<VARTYPES...>> data,
                        int value) const {
@@ -920,9 +1907,9 @@ void copy::memset_impl(edm::view<edm::schema<VARTYPES...>> data,
     // Scalars do not have their own dedicated @c memset functions.
     if constexpr (edm::type::details::is_scalar<typename std::tuple_element<
                       INDEX, std::tuple<VARTYPES...>>::type>::value) {
-        do_memset(sizeof(typename std::tuple_element<
-                         INDEX, std::tuple<VARTYPES...>>::type::type),
-                  data.template get<INDEX>(), value);
+        issue_memset(sizeof(typename std::tuple_element<
+                            INDEX, std::tuple<VARTYPES...>>::type::type),
+                     data.template get<INDEX>(), value);
     } else {
         // But vectors and jagged vectors do.
         memset(data.template get<INDEX>(), value);
@@ -961,14 +1948,14 @@ void copy::resize_impl(
                    sizeof(typename edm::view<edm::details::add_const_t<
                               edm::schema<VARTYPES...>>>::size_type));
             // Get the exact size of the container.
-            do_copy(sizeof(typename edm::view<edm::details::add_const_t<
-                               edm::schema<VARTYPES...>>>::size_type),
-                    from_view.size().ptr(), &size, cptype);
+            issue_copy(sizeof(typename edm::view<edm::details::add_const_t<
+                                  edm::schema<VARTYPES...>>>::size_type),
+                       from_view.size().ptr(), &size, cptype);
             // We have to wait for this to finish, since the "size" variable is
             // not going to be available outside of this function. And
             // asynchronous SYCL memory copies can happen from variables on the
             // stack as well...
-            create_event()->wait();
+            issue_event()->wait();
         }
         // Resize the target container.
         VECMEM_DEBUG_MSG(4, "Resizing a (non-jagged) container to size %u",
@@ -983,16 +1970,12 @@ void copy::resize_impl(
                               INDEX, std::tuple<VARTYPES...>>::type>::value) {
             // Get the sizes of this jagged vector.
             auto sizes = get_sizes(from_view.template get<INDEX>());
-            // Set the "outer size" of the jagged vector.
+            // Set the "outer" and "inner" sizes of the jagged vector.
             VECMEM_DEBUG_MSG(
                 4, "Resizing jagged vector variable at index %lu to size %lu",
                 INDEX, sizes.size());
             details::resize_jagged_vector(to_vec.template get<INDEX>(),
-                                          sizes.size());
-            // Set the "inner sizes" of the jagged vector.
-            for (std::size_t i = 0; i < sizes.size(); ++i) {
-                to_vec.template get<INDEX>()[i].resize(sizes[i]);
-            }
+                                          sizes);
         } else if constexpr (edm::type::details::is_vector<
                                  typename std::tuple_element<
                                      INDEX,
@@ -1017,7 +2000,8 @@ void copy::copy_sizes_impl(
     [[maybe_unused]] const edm::view<
         edm::details::add_const_t<edm::schema<VARTYPES...>>>& from_view,
     [[maybe_unused]] edm::view<edm::schema<VARTYPES...>> to_view,
-    [[maybe_unused]] type::copy_type cptype) const {
+    [[maybe_unused]] type::copy_type cptype,
+    [[maybe_unused]] details::copy_staging::batch& staged) const {
 
     // This should only be called for a resizable target container, with
     // a non-resizable source container.
@@ -1033,27 +2017,15 @@ void copy::copy_sizes_impl(
             edm::details::add_const_t<edm::schema<VARTYPES...>>>::size_type
             size = from_view.capacity();
         // Choose the copy type.
-        type::copy_type size_cptype = type::unknown;
-        switch (cptype) {
-            case type::host_to_device:
-            case type::device_to_device:
-                size_cptype = type::host_to_device;
-                break;
-            case type::host_to_host:
-            case type::device_to_host:
-                size_cptype = type::host_to_host;
-                break;
-            default:
-                break;
-        }
-        // Set the size of the target container.
-        do_copy(sizeof(typename edm::view<edm::details::add_const_t<
-                           edm::schema<VARTYPES...>>>::size_type),
-                &size, to_view.size().ptr(), size_cptype);
-        // We have to wait for this to finish, since the "size" variable is not
-        // going to be available outside of this function. And asynchronous SYCL
-        // memory copies can happen from variables on the stack as well...
-        create_event()->wait();
+        const type::copy_type size_cptype = host_copy_type(cptype);
+        // Set the size of the target container. Since the "size" variable is
+        // not going to be available outside of this function, copy it from
+        // staging memory, which stays alive until the operation's event
+        // finishes.
+        issue_copy(sizeof(typename edm::view<edm::details::add_const_t<
+                              edm::schema<VARTYPES...>>>::size_type),
+                   m_staging->stage(staged, &size, 1u), to_view.size().ptr(),
+                   size_cptype);
     } else {
         // For the jagged vector case we recursively copy the sizes of every
         // jagged vector variable. The rest of the variables are not resizable
@@ -1062,12 +2034,14 @@ void copy::copy_sizes_impl(
                           typename std::tuple_element<
                               INDEX, std::tuple<VARTYPES...>>::type>::value) {
             // Copy the sizes for this variable.
-            const auto sizes = get_sizes(from_view.template get<INDEX>());
-            set_sizes(sizes, to_view.template get<INDEX>())->wait();
+            details::copy_scratch::lease<details::copy_scratch::size_type>
+                sizes = details::copy_scratch::sizes();
+            read_sizes(from_view.template get<INDEX>(), *sizes);
+            set_sizes_impl(*sizes, to_view.template get<INDEX>(), &staged);
         }
         // Call this function recursively.
         if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
-            copy_sizes_impl<INDEX + 1>(from_view, to_view, cptype);
+            copy_sizes_impl<INDEX + 1>(from_view, to_view, cptype, staged);
         }
     }
 }
@@ -1076,23 +2050,139 @@ template <std::size_t INDEX, typename... VARTYPES>
 void copy::copy_payload_impl(
     const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
         from_view,
-    edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype) const {
+    edm::view<edm::schema<VARTYPES...>> to_view, type::copy_type cptype,
+    const std::bitset<sizeof...(VARTYPES)>& columns,
+    details::copy_staging::batch& staged,
+    std::vector<copy_region>& regions) const {
+
+    // Only copy the selected variables.
+    if (columns.test(INDEX)) {
+        // Scalars do not have their own dedicated @c copy functions.
+        if constexpr (edm::type::details::is_scalar<typename std::tuple_element<
+                          INDEX, std::tuple<VARTYPES...>>::type>::value) {
+            regions.push_back(
+                {from_view.template get<INDEX>(),
+                 to_view.template get<INDEX>(),
+                 sizeof(typename std::tuple_element<
+                        INDEX, std::tuple<VARTYPES...>>::type::type)});
+        } else if constexpr (edm::type::details::is_jagged_vector<
+                                 typename std::tuple_element<
+                                     INDEX,
+                                     std::tuple<VARTYPES...>>::type>::value) {
+            // Jagged vectors are copied with their own batches.
+            copy_view_impl(from_view.template get<INDEX>(),
+                           to_view.template get<INDEX>(), cptype, staged);
+        } else {
+            // While 1D vectors are added to the common batch.
+            copy_view_impl(from_view.template get<INDEX>(),
+                           to_view.template get<INDEX>(), cptype, staged,
+                           &regions);
+        }
+    }
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        copy_payload_impl<INDEX + 1>(from_view, to_view, cptype, columns,
+                                     staged, regions);
+    }
+}
+
+template <std::size_t INDEX, typename... VARTYPES>
+void copy::slice_payload_impl(
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view, const slice& range,
+    type::copy_type cptype, details::copy_staging::batch& staged,
+    std::vector<copy_region>& regions) const {
+
+    // Scalars are not affected by slice copies.
+    if constexpr (edm::type::details::is_jagged_vector<
+                      typename std::tuple_element<
+                          INDEX, std::tuple<VARTYPES...>>::type>::value) {
+        // Jagged vectors are copied with their own batches.
+        slice_view_impl(from_view.template get<INDEX>(),
+                        to_view.template get<INDEX>(), range, cptype, staged);
+    } else if constexpr (edm::type::details::is_vector<
+                             typename std::tuple_element<
+                                 INDEX,
+                                 std::tuple<VARTYPES...>>::type>::value) {
+        // While 1D vectors are added to the common batch.
+        slice_view_impl(from_view.template get<INDEX>(),
+                        to_view.template get<INDEX>(), range, cptype, staged,
+                        &regions);
+    }
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        slice_payload_impl<INDEX + 1>(from_view, to_view, range, cptype,
+                                      staged, regions);
+    }
+}
+
+template <std::size_t INDEX, typename... VARTYPES>
+void copy::plan_sizes_impl(
+    [[maybe_unused]] copy_plan& plan,
+    [[maybe_unused]] const edm::view<
+        edm::details::add_const_t<edm::schema<VARTYPES...>>>& from_view,
+    [[maybe_unused]] edm::view<edm::schema<VARTYPES...>> to_view) const {
+
+    // This should only be called for a resizable target container, with
+    // a non-resizable source container.
+    assert(to_view.size().ptr() != nullptr);
+    assert(from_view.size().ptr() == nullptr);
+
+    // First, handle containers with no jagged vectors in them.
+    if constexpr (std::disjunction_v<
+                      edm::type::details::is_jagged_vector<VARTYPES>...> ==
+                  false) {
+        // Set the size of the target container from the plan's own memory.
+        const typename edm::view<
+            edm::details::add_const_t<edm::schema<VARTYPES...>>>::size_type
+            size = from_view.capacity();
+        plan.m_host_regions.push_back({plan.store(&size, sizeof(size)),
+                                       to_view.size().ptr(), sizeof(size)});
+    } else {
+        // For the jagged vector case set the sizes of every jagged vector
+        // variable.
+        if constexpr (edm::type::details::is_jagged_vector<
+                          typename std::tuple_element<
+                              INDEX, std::tuple<VARTYPES...>>::type>::value) {
+            const auto sizes = get_sizes(from_view.template get<INDEX>());
+            if (check_sizes(sizes, to_view.template get<INDEX>())) {
+                const std::size_t bytes = sizeof(sizes[0]) * sizes.size();
+                plan.m_host_regions.push_back(
+                    {plan.store(sizes.data(), bytes),
+                     to_view.template get<INDEX>().host_ptr()->size_ptr(),
+                     bytes});
+            }
+        }
+        // Call this function recursively.
+        if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+            plan_sizes_impl<INDEX + 1>(plan, from_view, to_view);
+        }
+    }
+}
+
+template <std::size_t INDEX, typename... VARTYPES>
+void copy::plan_payload_impl(
+    copy_plan& plan,
+    const edm::view<edm::details::add_const_t<edm::schema<VARTYPES...>>>&
+        from_view,
+    edm::view<edm::schema<VARTYPES...>> to_view) const {
 
-    // Scalars do not have their own dedicated @c copy functions.
+    // Scalars are simple memory regions, everything else is planned by the
+    // vector and jagged vector functions.
     if constexpr (edm::type::details::is_scalar<typename std::tuple_element<
                       INDEX, std::tuple<VARTYPES...>>::type>::value) {
-        do_copy(sizeof(typename std::tuple_element<
-                       INDEX, std::tuple<VARTYPES...>>::type::type),
-                from_view.template get<INDEX>(), to_view.template get<INDEX>(),
-                cptype);
+        plan.m_regions.push_back(
+            {from_view.template get<INDEX>(), to_view.template get<INDEX>(),
+             sizeof(typename std::tuple_element<
+                    INDEX, std::tuple<VARTYPES...>>::type::type)});
     } else {
-        // But vectors and jagged vectors do.
-        copy_view_impl(from_view.template get<INDEX>(),
-                       to_view.template get<INDEX>(), cptype);
+        plan_view_impl(plan, from_view.template get<INDEX>(),
+                       to_view.template get<INDEX>());
     }
     // Recurse into the next variable.
     if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
-        copy_payload_impl<INDEX + 1>(from_view, to_view, cptype);
+        plan_payload_impl<INDEX + 1>(plan, from_view, to_view);
     }
 }
 
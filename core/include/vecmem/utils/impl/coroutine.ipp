@@ -0,0 +1,199 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/events.hpp"
+
+// System include(s).
+#include <cassert>
+#include <utility>
+
+namespace vecmem {
+namespace details {
+
+/// Non-owning event, forwarding to an event owned by someone else
+class event_reference final : public abstract_event {
+
+public:
+    /// Constructor with the referenced event
+    explicit event_reference(abstract_event& event) : m_event(event) {}
+
+    void wait() override { m_event.wait(); }
+    bool is_ready() const override { return m_event.is_ready(); }
+    void ignore() override {}
+
+private:
+    /// The referenced event
+    abstract_event& m_event;
+
+};  // class event_reference
+
+/// Resume a coroutine once an event completes
+///
+/// Note that the coroutine may be resumed (and its frame, holding the
+/// awaitable, destroyed) before this function returns. So it must not
+/// access the awaitable after scheduling the resumption.
+///
+inline void resume_after(abstract_event& event,
+                         std::coroutine_handle<> handle,
+                         resume_function resume) {
+
+    then(std::make_unique<event_reference>(event),
+         [handle, resume = std::move(resume)]() {
+             if (resume) {
+                 resume(handle);
+             } else {
+                 handle.resume();
+             }
+         })
+        ->ignore();
+}
+
+}  // namespace details
+
+template <typename EVENT>
+event_awaitable<EVENT>::event_awaitable(EVENT& event, resume_function resume)
+    : m_event(&event), m_resume(std::move(resume)) {}
+
+template <typename EVENT>
+event_awaitable<EVENT> event_awaitable<EVENT>::resume_on(
+    resume_function resume) && {
+
+    m_resume = std::move(resume);
+    return std::move(*this);
+}
+
+template <typename EVENT>
+bool event_awaitable<EVENT>::await_ready() const {
+
+    return m_event->is_ready();
+}
+
+template <typename EVENT>
+void event_awaitable<EVENT>::await_suspend(std::coroutine_handle<> handle) {
+
+    details::resume_after(*m_event, handle, std::move(m_resume));
+}
+
+template <typename EVENT>
+decltype(auto) event_awaitable<EVENT>::await_resume() {
+
+    if constexpr (requires { m_event->get(); }) {
+        return m_event->get();
+    } else {
+        m_event->wait();
+    }
+}
+
+template <typename RESULT>
+async_result<RESULT>::async_result(event_type event, RESULT result,
+                                   resume_function resume)
+    : m_event(std::move(event)),
+      m_result(std::move(result)),
+      m_resume(std::move(resume)) {
+
+    assert(m_event);
+}
+
+template <typename RESULT>
+async_result<RESULT> async_result<RESULT>::resume_on(
+    resume_function resume) && {
+
+    m_resume = std::move(resume);
+    return std::move(*this);
+}
+
+template <typename RESULT>
+bool async_result<RESULT>::await_ready() const {
+
+    return m_event->is_ready();
+}
+
+template <typename RESULT>
+void async_result<RESULT>::await_suspend(std::coroutine_handle<> handle) {
+
+    details::resume_after(*m_event, handle, std::move(m_resume));
+}
+
+template <typename RESULT>
+RESULT async_result<RESULT>::await_resume() {
+
+    m_event->wait();
+    return std::move(m_result);
+}
+
+inline async_result<void>::async_result(event_type event,
+                                        resume_function resume)
+    : m_event(std::move(event)), m_resume(std::move(resume)) {
+
+    assert(m_event);
+}
+
+inline async_result<void> async_result<void>::resume_on(
+    resume_function resume) && {
+
+    m_resume = std::move(resume);
+    return std::move(*this);
+}
+
+inline bool async_result<void>::await_ready() const {
+
+    return m_event->is_ready();
+}
+
+inline void async_result<void>::await_suspend(std::coroutine_handle<> handle) {
+
+    details::resume_after(*m_event, handle, std::move(m_resume));
+}
+
+inline void async_result<void>::await_resume() {
+
+    m_event->wait();
+}
+
+template <typename EVENT>
+event_awaitable<EVENT> awaitable(EVENT& event, resume_function resume) {
+
+    return event_awaitable<EVENT>{event, std::move(resume)};
+}
+
+inline event_awaitable<abstract_event> operator co_await(
+    abstract_event& event) {
+
+    return event_awaitable<abstract_event>{event};
+}
+
+template <typename SIZE_TYPE>
+event_awaitable<async_size<SIZE_TYPE>> operator co_await(
+    async_size<SIZE_TYPE>& size) {
+
+    return event_awaitable<async_size<SIZE_TYPE>>{size};
+}
+
+template <typename SIZE_TYPE>
+event_awaitable<async_sizes<SIZE_TYPE>> operator co_await(
+    async_sizes<SIZE_TYPE>& sizes) {
+
+    return event_awaitable<async_sizes<SIZE_TYPE>>{sizes};
+}
+
+template <typename... ARGS>
+async_result<void> co_copy(const copy& cp, ARGS&&... args) {
+
+    return async_result<void>{cp(std::forward<ARGS>(args)...)};
+}
+
+template <typename... ARGS>
+auto co_to(const copy& cp, ARGS&&... args) {
+
+    auto result = cp.to_async(std::forward<ARGS>(args)...);
+    return async_result<decltype(result.first)>{std::move(result.second),
+                                                std::move(result.first)};
+}
+
+}  // namespace vecmem
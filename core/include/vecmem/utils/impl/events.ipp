@@ -0,0 +1,32 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <utility>
+
+namespace vecmem {
+
+template <typename... EVENTS>
+std::unique_ptr<abstract_event> when_all(EVENTS&&... events) {
+
+    std::vector<std::unique_ptr<abstract_event>> v;
+    v.reserve(sizeof...(EVENTS));
+    (v.push_back(std::forward<EVENTS>(events)), ...);
+    return when_all(std::move(v));
+}
+
+template <typename... EVENTS>
+std::unique_ptr<abstract_event> when_any(EVENTS&&... events) {
+
+    std::vector<std::unique_ptr<abstract_event>> v;
+    v.reserve(sizeof...(EVENTS));
+    (v.push_back(std::forward<EVENTS>(events)), ...);
+    return when_any(std::move(v));
+}
+
+}  // namespace vecmem
@@ -0,0 +1,99 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/debug.hpp"
+
+namespace vecmem {
+
+template <typename TYPE>
+mirrored_buffer<TYPE>::mirrored_buffer(size_type size,
+                                       memory_resource& host_resource,
+                                       memory_resource& device_resource,
+                                       size_type granularity)
+    : m_host(size, host_resource),
+      m_device(size, device_resource),
+      m_dirty(size, granularity) {
+
+    m_dirty.add_all();
+}
+
+template <typename TYPE>
+auto mirrored_buffer<TYPE>::size() const -> size_type {
+
+    return m_host.capacity();
+}
+
+template <typename TYPE>
+data::vector_view<TYPE> mirrored_buffer<TYPE>::host() {
+
+    return m_host;
+}
+
+template <typename TYPE>
+data::vector_view<std::add_const_t<TYPE>> mirrored_buffer<TYPE>::host()
+    const {
+
+    return m_host;
+}
+
+template <typename TYPE>
+data::vector_view<std::add_const_t<TYPE>> mirrored_buffer<TYPE>::device()
+    const {
+
+    return m_device;
+}
+
+template <typename TYPE>
+void mirrored_buffer<TYPE>::mark_dirty(size_type begin, size_type end) {
+
+    m_dirty.add(begin, end);
+}
+
+template <typename TYPE>
+void mirrored_buffer<TYPE>::mark_dirty() {
+
+    m_dirty.add_all();
+}
+
+template <typename TYPE>
+bool mirrored_buffer<TYPE>::is_dirty() const {
+
+    return (m_dirty.empty() == false);
+}
+
+template <typename TYPE>
+std::size_t mirrored_buffer<TYPE>::n_dirty() const {
+
+    return m_dirty.n_elements();
+}
+
+template <typename TYPE>
+const std::vector<copy::slice>& mirrored_buffer<TYPE>::dirty_ranges() const {
+
+    return m_dirty.ranges();
+}
+
+template <typename TYPE>
+copy::event_type mirrored_buffer<TYPE>::sync(const copy& cp,
+                                             copy::type::copy_type cptype) {
+
+    // Copy all modified ranges in a single batch.
+    VECMEM_DEBUG_MSG(2, "Synchronizing %lu of %u elements in %lu range(s)",
+                     m_dirty.n_elements(), m_host.capacity(),
+                     m_dirty.ranges().size());
+    copy::event_type result =
+        cp(data::vector_view<std::add_const_t<TYPE>>{m_host},
+           data::vector_view<TYPE>{m_device}, m_dirty.ranges(), cptype);
+
+    // The device array is up to date now.
+    m_dirty.clear();
+    return result;
+}
+
+}  // namespace vecmem
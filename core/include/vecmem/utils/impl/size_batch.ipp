@@ -0,0 +1,76 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/edm/details/schema_traits.hpp"
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem {
+
+template <typename TYPE>
+auto size_batch::add(const data::vector_view<TYPE>& data) -> size_handle {
+
+    // Reserve a place for the size.
+    const std::size_t offset = reserve(1u);
+
+    // Either schedule it to be read, or just set it to the capacity of the
+    // (fixed sized) vector.
+    if (data.size_ptr() != nullptr) {
+        read(data.size_ptr(), offset, 1u);
+    } else {
+        m_values[offset] = data.capacity();
+    }
+    return {offset};
+}
+
+template <typename TYPE>
+auto size_batch::add(const data::jagged_vector_view<TYPE>& data)
+    -> sizes_handle {
+
+    // Reserve places for all of the sizes.
+    const std::size_t offset = reserve(data.size());
+
+    // Start out with the capacities of the inner vectors. For resizable
+    // buffers the sizes are stored contiguously, starting from the first
+    // inner vector with a non-zero capacity. (Just like in
+    // vecmem::copy::get_sizes.)
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        m_values[offset + i] = data.host_ptr()[i].capacity();
+    }
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        if ((data.host_ptr()[i].capacity() != 0) &&
+            (data.host_ptr()[i].size_ptr() != nullptr)) {
+            read(data.host_ptr()[i].size_ptr(), offset + i, data.size() - i);
+            break;
+        }
+    }
+    return {offset, data.size()};
+}
+
+template <typename... VARTYPES>
+auto size_batch::add(const edm::view<edm::schema<VARTYPES...>>& data)
+    -> size_handle {
+
+    // Reserve a place for the size.
+    const std::size_t offset = reserve(1u);
+    m_values[offset] = data.capacity();
+
+    // Containers with jagged vectors have a fixed outer size.
+    if constexpr (!edm::details::has_jagged_vector_v<VARTYPES...>) {
+        if (data.size().ptr() != nullptr) {
+            assert(data.size().size() == sizeof(size_type));
+            read(reinterpret_cast<const size_type*>(data.size().ptr()),
+                 offset, 1u);
+        }
+    }
+    return {offset};
+}
+
+}  // namespace vecmem
@@ -0,0 +1,131 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/edm/buffer.hpp"
+#include "vecmem/edm/details/schema_traits.hpp"
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vecmem {
+
+template <typename TYPE, typename CALLBACK>
+void streaming_copy::operator()(const data::vector_view<TYPE>& from,
+                                CALLBACK&& callback,
+                                copy::type::copy_type cptype) const {
+
+    // Types used in the function.
+    using value_type = std::remove_cv_t<TYPE>;
+    using size_type = typename data::vector_view<value_type>::size_type;
+
+    // Set up the staging buffers.
+    const std::size_t size = m_copy.get().get_size(from);
+    const std::size_t n_buffers = this->n_buffers(size);
+    std::vector<data::vector_buffer<value_type>> buffers;
+    buffers.reserve(n_buffers);
+    for (std::size_t i = 0; i < n_buffers; ++i) {
+        buffers.emplace_back(static_cast<size_type>(m_options.chunk_size),
+                             m_resource.get());
+    }
+
+    // Stream the vector through them.
+    run(size, n_buffers,
+        [&](std::size_t buffer, std::size_t begin, std::size_t end) {
+            return m_copy.get()(from, buffers[buffer],
+                                copy::slice{begin, end, 0u}, cptype);
+        },
+        [&](std::size_t buffer, std::size_t begin, std::size_t end) {
+            callback(data::vector_view<value_type>(
+                         static_cast<size_type>(end - begin),
+                         buffers[buffer].ptr()),
+                     begin);
+        });
+}
+
+template <typename... VARTYPES, typename CALLBACK>
+void streaming_copy::operator()(const edm::view<edm::schema<VARTYPES...>>& from,
+                                CALLBACK&& callback,
+                                copy::type::copy_type cptype) const {
+
+    // Types used in the function.
+    using schema_type = edm::details::remove_cv_t<edm::schema<VARTYPES...>>;
+    using buffer_type = edm::buffer<schema_type>;
+    static_assert(!edm::details::has_jagged_vector_v<VARTYPES...>,
+                  "Containers with jagged vectors can not be streamed");
+
+    // Set up the staging buffers.
+    const std::size_t size = m_copy.get().get_size(from);
+    const std::size_t n_buffers = this->n_buffers(size);
+    std::vector<buffer_type> buffers;
+    buffers.reserve(n_buffers);
+    for (std::size_t i = 0; i < n_buffers; ++i) {
+        buffers.emplace_back(
+            static_cast<typename buffer_type::size_type>(m_options.chunk_size),
+            m_resource.get());
+    }
+
+    // Stream the container through them.
+    run(size, n_buffers,
+        [&](std::size_t buffer, std::size_t begin, std::size_t end) {
+            return m_copy.get()(from, buffers[buffer],
+                                copy::slice{begin, end, 0u}, cptype);
+        },
+        [&](std::size_t buffer, std::size_t begin, std::size_t end) {
+            callback(edm::view<schema_type>(buffers[buffer]), begin,
+                     end - begin);
+        });
+}
+
+template <typename ISSUE, typename PROCESS>
+void streaming_copy::run(std::size_t size, std::size_t n_buffers,
+                         ISSUE&& issue, PROCESS&& process) const {
+
+    // The events of the copies into the staging buffers. If the processing
+    // throws, their destructors wait for the unfinished copies before the
+    // caller's buffers would be destroyed.
+    std::vector<copy::event_type> events(n_buffers);
+
+    // Helper lambda starting the copy of the next chunk into a buffer.
+    const std::size_t chunk_size = m_options.chunk_size;
+    std::size_t next = 0u;
+    auto issue_next = [&](std::size_t buffer) {
+        const std::size_t end = std::min(size, next + chunk_size);
+        events[buffer] = issue(buffer, next, end);
+        next = end;
+    };
+
+    // Start filling all of the buffers.
+    for (std::size_t buffer = 0; (buffer < n_buffers) && (next < size);
+         ++buffer) {
+        issue_next(buffer);
+    }
+
+    // Process the chunks in order, re-filling every buffer as soon as its
+    // chunk was processed.
+    for (std::size_t begin = 0u, buffer = 0u; begin < size;
+         begin += chunk_size, buffer = (buffer + 1u) % n_buffers) {
+        const std::size_t end = std::min(size, begin + chunk_size);
+        events[buffer]->wait();
+        process(buffer, begin, end);
+        if (next < size) {
+            issue_next(buffer);
+        }
+    }
+    VECMEM_DEBUG_MSG(3,
+                     "Streamed %lu elements through %lu staging buffer(s) of "
+                     "%lu elements",
+                     size, n_buffers, chunk_size);
+}
+
+}  // namespace vecmem
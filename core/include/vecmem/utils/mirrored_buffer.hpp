@@ -0,0 +1,104 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/details/dirty_ranges.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace vecmem {
+
+/// 1D array with a host and a device copy, kept in sync incrementally
+///
+/// Large tables that are modified a little at a time on the host, and used
+/// on a device, should not be copied to the device completely after every
+/// modification. The parts of the host array modified by the user need to
+/// be marked with @c mark_dirty(...), and @c sync(...) then copies only
+/// those parts to the device, with a single batched copy.
+///
+/// Dirty ranges are rounded outwards to a multiple of the granularity given
+/// to the constructor. Which allows tracking modifications with e.g. page
+/// granularity, to keep the number of separate copies low.
+///
+template <typename TYPE>
+class mirrored_buffer {
+
+public:
+    /// Size type used by the buffer
+    using size_type = typename data::vector_view<TYPE>::size_type;
+
+    /// Constructor with the size of the array, and the memory resources
+    ///
+    /// The whole array is considered dirty after construction.
+    ///
+    /// @param size The number of elements in the array
+    /// @param host_resource The (host accessible) resource for the host array
+    /// @param device_resource The resource for the device array
+    /// @param granularity The number of elements that dirty ranges are
+    ///        rounded outwards to a multiple of
+    ///
+    mirrored_buffer(size_type size, memory_resource& host_resource,
+                    memory_resource& device_resource,
+                    size_type granularity = 1u);
+
+    /// The number of elements in the array
+    size_type size() const;
+
+    /// View of the host array, to be modified by the user
+    data::vector_view<TYPE> host();
+    /// View of the host array
+    data::vector_view<std::add_const_t<TYPE>> host() const;
+    /// View of the device array
+    data::vector_view<std::add_const_t<TYPE>> device() const;
+
+    /// Mark the elements <tt>[begin, end)</tt> of the host array as modified
+    void mark_dirty(size_type begin, size_type end);
+    /// Mark the whole host array as modified
+    void mark_dirty();
+
+    /// Check whether any part of the host array was modified since the last
+    /// synchronization
+    bool is_dirty() const;
+    /// The number of elements to copy with the next synchronization
+    std::size_t n_dirty() const;
+    /// The (merged and rounded) ranges to copy with the next synchronization
+    const std::vector<copy::slice>& dirty_ranges() const;
+
+    /// Copy the modified parts of the host array to the device array
+    ///
+    /// The host array must not be modified before the returned event
+    /// completes.
+    ///
+    /// @param cp The object performing the copy
+    /// @param cptype The type of the copy
+    /// @return The event of the (batched) copy
+    ///
+    VECMEM_NODISCARD copy::event_type sync(
+        const copy& cp, copy::type::copy_type cptype = copy::type::unknown);
+
+private:
+    /// The host array
+    data::vector_buffer<TYPE> m_host;
+    /// The device array
+    data::vector_buffer<TYPE> m_device;
+    /// The modified ranges of the host array
+    details::dirty_ranges m_dirty;
+
+};  // class mirrored_buffer
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/mirrored_buffer.ipp"
@@ -0,0 +1,139 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace vecmem {
+
+/// Copy class for use with @c vecmem::simulated_device_memory_resource
+///
+/// It performs its copies on the host, lifting the protection of the
+/// simulated device memory for the duration of each operation. On top of
+/// that, it charges every copy with a cost according to a simple latency +
+/// bandwidth model, and collects statistics about the performed operations.
+/// Allowing the transfer volumes and synchronization counts of code written
+/// for real devices to be measured on machines without any.
+///
+/// The direction of every copy is determined from the pointers taking part
+/// in it, independent of the copy type requested by the caller.
+///
+class simulated_device_copy : public vecmem::copy {
+
+public:
+    /// Cost model of one kind of memory transfer
+    struct link_model {
+        /// The fixed cost of every transfer
+        std::chrono::nanoseconds latency{0};
+        /// The bandwidth of the transfer in bytes / second (0 meaning
+        /// unlimited)
+        double bandwidth = 0.;
+    };  // struct link_model
+
+    /// Cost model of all of the memory transfers
+    struct cost_model {
+        /// The cost of the different kinds of memory transfers
+        ///
+        /// Indexed by @c vecmem::copy::type::copy_type. The model for
+        /// @c vecmem::copy::type::unknown is not used.
+        ///
+        std::array<link_model, type::count> links;
+        /// Whether to really wait for the cost of every transfer
+        ///
+        /// By default the costs are just accumulated in the statistics.
+        ///
+        bool sleep = false;
+    };  // struct cost_model
+
+    /// Statistics about one kind of memory transfer
+    struct transfer_statistics {
+        /// The number of transfers
+        std::size_t n_copies = 0u;
+        /// The number of transferred bytes
+        std::size_t n_bytes = 0u;
+        /// The simulated time spent on the transfers
+        std::chrono::nanoseconds time{0};
+    };  // struct transfer_statistics
+
+    /// Statistics about all of the performed operations
+    struct statistics {
+        /// Statistics about the different kinds of memory transfers
+        ///
+        /// Indexed by @c vecmem::copy::type::copy_type, according to the
+        /// actual direction of the transfers.
+        ///
+        std::array<transfer_statistics, type::count> copies;
+        /// The number of copies requested with a mismatched copy type
+        std::size_t n_mislabeled = 0u;
+        /// The number of memory filling operations
+        std::size_t n_memsets = 0u;
+        /// The number of bytes set by memory filling operations
+        std::size_t n_memset_bytes = 0u;
+        /// The number of times that the host waited for an event
+        std::size_t n_synchronizations = 0u;
+
+        /// The total simulated time spent on all transfers
+        VECMEM_CORE_EXPORT
+        std::chrono::nanoseconds total_time() const;
+    };  // struct statistics
+
+    /// Constructor with the simulated device memory resource to work with
+    VECMEM_CORE_EXPORT
+    explicit simulated_device_copy(
+        const simulated_device_memory_resource& resource);
+    /// Constructor with the simulated device memory resource and a cost model
+    VECMEM_CORE_EXPORT
+    simulated_device_copy(const simulated_device_memory_resource& resource,
+                          const cost_model& model);
+    /// Move constructor
+    VECMEM_CORE_EXPORT
+    simulated_device_copy(simulated_device_copy&&) noexcept;
+    /// Destructor
+    VECMEM_CORE_EXPORT
+    ~simulated_device_copy() override;
+
+    /// Move assignment operator
+    VECMEM_CORE_EXPORT
+    simulated_device_copy& operator=(simulated_device_copy&&) noexcept;
+
+    /// Get the statistics collected so far
+    VECMEM_CORE_EXPORT
+    statistics get_statistics() const;
+    /// Reset the collected statistics
+    VECMEM_CORE_EXPORT
+    void reset_statistics();
+
+protected:
+    /// Perform a memory copy, charging it according to the cost model
+    VECMEM_CORE_EXPORT
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const override;
+    /// Perform a memory filling operation
+    VECMEM_CORE_EXPORT
+    void do_memset(std::size_t size, void* ptr, int value) const override;
+    /// Create an event counting the synchronizations made with it
+    VECMEM_CORE_EXPORT
+    event_type create_event() const override;
+
+private:
+    /// Internal data type for the class
+    struct impl;
+    /// Pointer to the internal data
+    std::shared_ptr<impl> m_impl;
+
+};  // class simulated_device_copy
+
+}  // namespace vecmem
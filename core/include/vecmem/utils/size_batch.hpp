@@ -0,0 +1,117 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/edm/view.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace vecmem {
+
+// Forward declaration(s).
+class copy;
+
+/// Collection of container sizes to read back with a single synchronization
+///
+/// Reading the sizes of many resizable buffers one by one, with
+/// @c vecmem::copy::get_size and @c vecmem::copy::get_sizes, means
+/// one (tiny) memory copy and, usually, one synchronization per buffer.
+/// The sizes registered in a batch are instead all gathered into a single
+/// host memory block by @c vecmem::copy::get_sizes(const size_batch&,
+/// memory_resource&), with one batch of copies followed by a single
+/// synchronization. (Backends without a native batched copy still issue one
+/// memory copy per source region.) The sizes can be accessed through the
+/// handles returned by the @c add functions once that operation finished.
+///
+/// The (inner) sizes of a jagged vector variable of an SoA container can
+/// be registered by adding the jagged vector view of that variable.
+///
+class VECMEM_CORE_EXPORT size_batch {
+
+public:
+    /// Size type used by the views
+    using size_type = data::vector_view<int>::size_type;
+
+    /// Handle to a single size in the batch
+    struct size_handle {
+        /// Position of the size in the batch
+        std::size_t m_offset = 0u;
+    };
+    /// Handle to the sizes of the inner vectors of a jagged vector
+    struct sizes_handle {
+        /// Position of the first size in the batch
+        std::size_t m_offset = 0u;
+        /// Number of sizes
+        std::size_t m_count = 0u;
+    };
+
+    /// Default constructor
+    size_batch();
+
+    /// Register the size of a 1D vector
+    template <typename TYPE>
+    size_handle add(const data::vector_view<TYPE>& data);
+    /// Register the (inner) sizes of a jagged vector
+    template <typename TYPE>
+    sizes_handle add(const data::jagged_vector_view<TYPE>& data);
+    /// Register the (outer) size of an SoA container
+    template <typename... VARTYPES>
+    size_handle add(const edm::view<edm::schema<VARTYPES...>>& data);
+
+    /// The number of sizes registered in the batch
+    std::size_t size() const;
+    /// The number of memory regions that the sizes are read from
+    std::size_t n_sources() const;
+    /// Remove all sizes from the batch, invalidating all handles
+    void clear();
+
+private:
+    /// The copy class is the one reading the sizes
+    friend class copy;
+
+    /// Memory region holding sizes that need to be read back
+    struct source {
+        /// Pointer to the first size in (device) memory
+        const size_type* m_ptr = nullptr;
+        /// Position of the first size in the batch
+        std::size_t m_offset = 0u;
+        /// Number of sizes in the region
+        std::size_t m_count = 0u;
+    };
+
+    /// Reserve space for a number of sizes in the batch
+    ///
+    /// @param count The number of sizes to reserve space for
+    /// @return The position of the first reserved size
+    ///
+    std::size_t reserve(std::size_t count);
+    /// Register sizes to read back into an already reserved range
+    ///
+    /// @param ptr Pointer to the first size in (device) memory
+    /// @param offset The position of the first size in the batch
+    /// @param count The number of sizes to read
+    ///
+    void read(const size_type* ptr, std::size_t offset, std::size_t count);
+
+    /// Sizes known without reading them back (capacities of fixed sized
+    /// buffers), with placeholders for the sizes to read back
+    std::vector<size_type> m_values;
+    /// The memory regions to read sizes from
+    std::vector<source> m_sources;
+
+};  // class size_batch
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/size_batch.ipp"
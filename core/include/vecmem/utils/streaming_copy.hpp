@@ -0,0 +1,116 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/edm/schema.hpp"
+#include "vecmem/edm/view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+
+namespace vecmem {
+
+/// Helper moving large containers through a few bounded staging buffers
+///
+/// The data is copied one chunk at a time into staging buffers allocated
+/// from a user provided memory resource, and every chunk is handed to a
+/// user callback once it arrived. While the callback processes one chunk,
+/// the copies of the following ones can already be in flight, if the
+/// @c vecmem::copy object used is asynchronous.
+///
+/// At most @c options::n_buffers staging buffers, each holding
+/// @c options::chunk_size elements, are in use at any time.
+///
+class streaming_copy {
+
+public:
+    /// Options for the streaming copies
+    struct options {
+        /// Default constructor
+        VECMEM_CORE_EXPORT
+        options();
+        /// The number of elements to copy in one chunk
+        std::size_t chunk_size = 65536u;
+        /// The number of staging buffers to use
+        std::size_t n_buffers = 2u;
+    };  // struct options
+
+    /// Constructor with all necessary parameters
+    ///
+    /// @param cp The object performing the copies of the individual chunks
+    /// @param staging_mr The memory resource to allocate staging buffers with
+    /// @param opts The options for the streaming copies
+    ///
+    VECMEM_CORE_EXPORT
+    streaming_copy(const copy& cp, memory_resource& staging_mr,
+                   const options& opts = {});
+
+    /// Stream a 1D vector through the staging buffers
+    ///
+    /// The callback is called with a (fixed sized) view of the chunk in a
+    /// staging buffer, and the index of the chunk's first element in the
+    /// source. It must not hold on to the view after returning.
+    ///
+    /// @param from The vector to stream
+    /// @param callback The function processing the individual chunks
+    /// @param cptype The type of the copies to perform
+    ///
+    template <typename TYPE, typename CALLBACK>
+    void operator()(const data::vector_view<TYPE>& from, CALLBACK&& callback,
+                    copy::type::copy_type cptype = copy::type::unknown) const;
+
+    /// Stream an SoA container through the staging buffers
+    ///
+    /// The callback is called with a view of the staging buffer, the index
+    /// of the chunk's first element in the source, and the number of
+    /// elements in the chunk. Scalar variables are not copied into the
+    /// staging buffers. Containers with jagged vectors are not supported.
+    ///
+    /// @param from The container to stream
+    /// @param callback The function processing the individual chunks
+    /// @param cptype The type of the copies to perform
+    ///
+    template <typename... VARTYPES, typename CALLBACK>
+    void operator()(const edm::view<edm::schema<VARTYPES...>>& from,
+                    CALLBACK&& callback,
+                    copy::type::copy_type cptype = copy::type::unknown) const;
+
+private:
+    /// Copy chunks into the staging buffers, and process them in order
+    ///
+    /// @param size The number of elements to stream
+    /// @param n_buffers The number of staging buffers to use
+    /// @param issue Function starting the copy of a chunk into a buffer
+    /// @param process Function processing a chunk in a buffer
+    ///
+    template <typename ISSUE, typename PROCESS>
+    void run(std::size_t size, std::size_t n_buffers, ISSUE&& issue,
+             PROCESS&& process) const;
+
+    /// The number of staging buffers needed for a given number of elements
+    VECMEM_CORE_EXPORT
+    std::size_t n_buffers(std::size_t size) const;
+
+    /// The object performing the copies
+    std::reference_wrapper<const copy> m_copy;
+    /// The memory resource to allocate the staging buffers with
+    std::reference_wrapper<memory_resource> m_resource;
+    /// The options for the streaming copies
+    options m_options;
+
+};  // class streaming_copy
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/streaming_copy.ipp"
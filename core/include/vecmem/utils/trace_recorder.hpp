@@ -0,0 +1,79 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+namespace vecmem {
+
+/// Class recording a timeline of memory allocations and copies
+///
+/// The recorder can be attached to any number of
+/// @c vecmem::instrumenting_memory_resource and @c vecmem::copy objects.
+/// It records a span for every allocation and de-allocation made by the
+/// resources, and for every memory copy, memory filling, event creation and
+/// event wait made through the copy objects. The timeline can be written in
+/// the Chrome trace event format, which can be opened with Perfetto
+/// (https://ui.perfetto.dev) or @c chrome://tracing.
+///
+/// Every thread records into its own buffer, so threads only ever compete
+/// for a lock while the timeline is being written out or cleared.
+///
+/// Note that the lifetime of this object must be at least as long as the
+/// lifetime of the memory resources and copy objects that it is attached to.
+/// Attaching it to a copy object replaces the observer of that object.
+///
+class VECMEM_CORE_EXPORT trace_recorder {
+
+public:
+    /// Default constructor
+    trace_recorder();
+    /// Constructor with a file to write the timeline into on destruction
+    explicit trace_recorder(const std::string& filename);
+    /// Destructor
+    ~trace_recorder();
+
+    /// Record the allocations of a memory resource
+    ///
+    /// @param resource The memory resource to record the allocations of
+    /// @param name The name to identify the resource by in the timeline
+    ///
+    void attach(instrumenting_memory_resource& resource,
+                const std::string& name);
+    /// Record the operations of a copy object
+    ///
+    /// @param cp The copy object to record the operations of
+    /// @param name The name to identify the copy object by in the timeline
+    ///
+    void attach(copy& cp, const std::string& name);
+
+    /// Get the number of spans recorded so far
+    std::size_t size() const;
+    /// Remove all of the spans recorded so far
+    void clear();
+
+    /// Write the recorded timeline in the Chrome trace event format
+    void write(std::ostream& out) const;
+
+private:
+    /// Internal data type for the class
+    struct impl;
+    /// Pointer to the internal data
+    std::unique_ptr<impl> m_impl;
+
+};  // class trace_recorder
+
+}  // namespace vecmem
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,7 @@
 
 #include "details/arena_memory_resource_impl.hpp"
 #include "details/memory_resource_impl.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 namespace vecmem {
 
@@ -18,8 +19,52 @@ arena_memory_resource::arena_memory_resource(memory_resource& upstream,
                                              std::size_t initial_size,
                                              std::size_t maximum_size)
     : m_impl{std::make_unique<details::arena_memory_resource_impl>(
-          initial_size, maximum_size, upstream)} {}
+          initial_size, maximum_size, upstream)},
+      m_space{get_memory_space(upstream)} {}
+
+std::size_t arena_memory_resource::do_ranges_revision() const noexcept {
+
+    assert(m_impl);
+    return m_impl->ranges_revision();
+}
+
+void arena_memory_resource::do_owned_ranges(std::vector<range>& ranges) const {
+
+    assert(m_impl);
+    m_impl->owned_ranges(ranges);
+}
+
+void arena_memory_resource::do_allocate_bulk(std::size_t n,
+                                             const std::size_t* sizes,
+                                             std::size_t alignment,
+                                             void** ptrs) {
+
+    assert(m_impl);
+    m_impl->allocate_bulk(n, sizes, alignment, ptrs);
+}
+
+void arena_memory_resource::do_deallocate_bulk(std::size_t n,
+                                               void* const* ptrs,
+                                               const std::size_t* sizes,
+                                               std::size_t alignment) {
+
+    assert(m_impl);
+    m_impl->deallocate_bulk(n, ptrs, sizes, alignment);
+}
+
+void arena_memory_resource::do_reserve_bulk(std::size_t n,
+                                            const std::size_t* sizes,
+                                            std::size_t alignment) {
+
+    assert(m_impl);
+    m_impl->reserve_bulk(n, sizes, alignment);
+}
 
 VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(arena_memory_resource)
 
+memory_space arena_memory_resource::do_space() const noexcept {
+
+    return m_space;
+}
+
 }  // namespace vecmem
@@ -0,0 +1,31 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/batched_synchronized_memory_resource.hpp"
+
+#include "details/batched_synchronized_memory_resource_impl.hpp"
+#include "details/memory_resource_impl.hpp"
+
+namespace vecmem {
+
+batched_synchronized_memory_resource::options::options() = default;
+
+batched_synchronized_memory_resource::batched_synchronized_memory_resource(
+    memory_resource& upstream, const options& opts)
+    : m_impl{std::make_unique<
+          details::batched_synchronized_memory_resource_impl>(upstream,
+                                                              opts)} {}
+
+void batched_synchronized_memory_resource::drain() {
+
+    m_impl->drain();
+}
+
+VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(batched_synchronized_memory_resource)
+
+}  // namespace vecmem
@@ -11,14 +11,21 @@
 
 #include "details/binary_page_memory_resource_impl.hpp"
 #include "details/memory_resource_impl.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 namespace vecmem {
 
 binary_page_memory_resource::binary_page_memory_resource(
     memory_resource& upstream)
     : m_impl{std::make_unique<details::binary_page_memory_resource_impl>(
-          upstream)} {}
+          upstream)},
+      m_space{get_memory_space(upstream)} {}
 
 VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(binary_page_memory_resource)
 
+memory_space binary_page_memory_resource::do_space() const noexcept {
+
+    return m_space;
+}
+
 }  // namespace vecmem
@@ -0,0 +1,69 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/bulk_allocation.hpp"
+
+#include "vecmem/memory/details/bulk_memory_resource.hpp"
+#include "vecmem/utils/debug.hpp"
+
+namespace vecmem {
+
+void allocate_bulk(memory_resource& resource, std::size_t n,
+                   const std::size_t* sizes, std::size_t alignment,
+                   void** ptrs) {
+
+    // Use the native implementation if possible.
+    if (auto* bulk = dynamic_cast<details::bulk_memory_resource*>(&resource)) {
+        bulk->allocate_bulk(n, sizes, alignment, ptrs);
+        return;
+    }
+
+    // If not, allocate the blocks one by one.
+    VECMEM_DEBUG_MSG(4, "Allocating %lu memory blocks one by one", n);
+    std::size_t i = 0;
+    try {
+        for (; i < n; ++i) {
+            ptrs[i] = ((sizes[i] != 0u) ? resource.allocate(sizes[i], alignment)
+                                        : nullptr);
+        }
+    } catch (...) {
+        // Release everything that was allocated so far.
+        deallocate_bulk(resource, i, ptrs, sizes, alignment);
+        throw;
+    }
+}
+
+void deallocate_bulk(memory_resource& resource, std::size_t n,
+                     void* const* ptrs, const std::size_t* sizes,
+                     std::size_t alignment) {
+
+    // Use the native implementation if possible.
+    if (auto* bulk = dynamic_cast<details::bulk_memory_resource*>(&resource)) {
+        bulk->deallocate_bulk(n, ptrs, sizes, alignment);
+        return;
+    }
+
+    // If not, de-allocate the blocks one by one.
+    for (std::size_t i = 0; i < n; ++i) {
+        if (ptrs[i] != nullptr) {
+            resource.deallocate(ptrs[i], sizes[i], alignment);
+        }
+    }
+}
+
+void reserve_bulk(memory_resource& resource, std::size_t n,
+                  const std::size_t* sizes, std::size_t alignment) {
+
+    // Only memory resources implementing the bulk interface can do anything
+    // useful with this.
+    if (auto* bulk = dynamic_cast<details::bulk_memory_resource*>(&resource)) {
+        bulk->reserve_bulk(n, sizes, alignment);
+    }
+}
+
+}  // namespace vecmem
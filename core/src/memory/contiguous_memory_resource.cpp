@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,14 +11,59 @@
 
 #include "details/contiguous_memory_resource_impl.hpp"
 #include "details/memory_resource_impl.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 namespace vecmem {
 
 contiguous_memory_resource::contiguous_memory_resource(
     memory_resource& upstream, std::size_t size)
     : m_impl{std::make_unique<details::contiguous_memory_resource_impl>(
-          upstream, size)} {}
+          upstream, size)},
+      m_space{get_memory_space(upstream)} {}
+
+std::size_t contiguous_memory_resource::do_ranges_revision() const noexcept {
+
+    // The resource's memory blob never changes.
+    return 0u;
+}
+
+void contiguous_memory_resource::do_owned_ranges(
+    std::vector<range>& ranges) const {
+
+    assert(m_impl);
+    m_impl->owned_ranges(ranges);
+}
+
+void contiguous_memory_resource::do_allocate_bulk(std::size_t n,
+                                                  const std::size_t* sizes,
+                                                  std::size_t alignment,
+                                                  void** ptrs) {
+
+    assert(m_impl);
+    m_impl->allocate_bulk(n, sizes, alignment, ptrs);
+}
+
+void contiguous_memory_resource::do_deallocate_bulk(std::size_t,
+                                                    void* const*,
+                                                    const std::size_t*,
+                                                    std::size_t) {
+
+    // Deallocation is a no-op for this memory resource.
+}
+
+void contiguous_memory_resource::do_reserve_bulk(std::size_t n,
+                                                 const std::size_t* sizes,
+                                                 std::size_t alignment) {
+
+    assert(m_impl);
+    m_impl->reserve_bulk(n, sizes, alignment);
+}
 
 VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(contiguous_memory_resource)
 
+memory_space contiguous_memory_resource::do_space() const noexcept {
+
+    return m_space;
+}
+
 }  // namespace vecmem
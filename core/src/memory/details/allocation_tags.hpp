@@ -0,0 +1,32 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <string>
+
+namespace vecmem::details {
+
+/// Identifier of the allocations made without an active tag
+static constexpr std::size_t untagged_allocation_id = 0u;
+
+/// Get the identifier of the allocation tag active on the current thread
+///
+/// Tags are interned by @c vecmem::scoped_allocation_tag when the guard is
+/// created, so this is just a thread-local lookup.
+///
+std::size_t current_allocation_tag_id();
+
+/// Get the name of an interned allocation tag
+///
+/// @param id The identifier of the tag
+/// @return The name that the tag was interned with
+///
+std::string allocation_tag_name(std::size_t id);
+
+}  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,8 @@
 // System include(s).
 #include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <new>
 
 namespace {
 
@@ -29,6 +31,17 @@ inline constexpr std::size_t align_up(std::size_t v,
 
 constexpr std::size_t minimum_superblock_size = 1u << 18u;
 
+// total (aligned) size of a set of allocations
+std::size_t bulk_size(std::size_t n, const std::size_t* sizes) {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (sizes[i] != 0u) {
+            result += align_up(sizes[i]);
+        }
+    }
+    return result;
+}
+
 }  // namespace
 
 namespace vecmem::details {
@@ -140,6 +153,99 @@ bool arena_memory_resource_impl::deallocate(void* p, std::size_t bytes,
     return b.is_valid();
 }
 
+void arena_memory_resource_impl::allocate_bulk(std::size_t n,
+                                               const std::size_t* sizes,
+                                               std::size_t, void** ptrs) {
+
+    std::fill(ptrs, ptrs + n, nullptr);
+    std::size_t const total = bulk_size(n, sizes);
+    if (total == 0u) {
+        return;
+    }
+
+    // get a single block for all of the allocations
+    auto const b = get_block(total);
+    if (!b.is_valid()) {
+        throw std::bad_alloc();
+    }
+
+    // carve it up into the individual allocations, which can then be
+    // deallocated one by one as well
+    char* pointer = static_cast<char*>(b.pointer());
+    auto hint = allocated_blocks_.end();
+    try {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (sizes[i] == 0u) {
+                continue;
+            }
+            std::size_t const bytes = align_up(sizes[i]);
+            hint = std::next(
+                allocated_blocks_.emplace_hint(hint, pointer, bytes));
+            ptrs[i] = pointer;
+            pointer += bytes;
+        }
+    } catch (...) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (ptrs[i] != nullptr) {
+                allocated_blocks_.erase(block{ptrs[i], 0u});
+                ptrs[i] = nullptr;
+            }
+        }
+        coalesce_block(free_blocks_, b);
+        throw;
+    }
+}
+
+void arena_memory_resource_impl::deallocate_bulk(std::size_t n,
+                                                 void* const* ptrs,
+                                                 const std::size_t* sizes,
+                                                 std::size_t) {
+
+    // collect the freed blocks in address order
+    std::vector<block> freed;
+    freed.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((ptrs[i] != nullptr) && (sizes[i] != 0u)) {
+            auto const b = free_block(ptrs[i], align_up(sizes[i]));
+            if (b.is_valid()) {
+                freed.push_back(b);
+            }
+        }
+    }
+    std::sort(freed.begin(), freed.end());
+
+    // merge the contiguous ones before returning them to the free set, so
+    // that blocks allocated together are returned with a single insertion
+    auto run = freed.begin();
+    while (run != freed.end()) {
+        block merged = *run;
+        auto next = std::next(run);
+        while ((next != freed.end()) && merged.is_contiguous_before(*next)) {
+            merged = merged.merge(*next);
+            ++next;
+        }
+        coalesce_block(free_blocks_, merged);
+        run = next;
+    }
+}
+
+void arena_memory_resource_impl::reserve_bulk(std::size_t n,
+                                              const std::size_t* sizes,
+                                              std::size_t) {
+
+    // large requests always get their own superblock, so only make sure that
+    // a single free block exists for all of the smaller ones
+    std::size_t const total = bulk_size(n, sizes);
+    if ((total == 0u) || (total >= minimum_superblock_size)) {
+        return;
+    }
+    if (std::any_of(free_blocks_.cbegin(), free_blocks_.cend(),
+                    [total](auto const& b) { return b.fits(total); })) {
+        return;
+    }
+    expand_arena(total);
+}
+
 arena_memory_resource_impl::block arena_memory_resource_impl::first_fit(
     std::set<block>& free_blocks, std::size_t size) {
 
@@ -230,23 +336,40 @@ arena_memory_resource_impl::block arena_memory_resource_impl::get_block(
 arena_memory_resource_impl::block arena_memory_resource_impl::expand_arena(
     std::size_t size) {
 
+    // requests (or batches of requests) larger than the regular superblocks
+    // get a superblock that is large enough for them
     if (size > this->size_superblocks_)
-        size = minimum_superblock_size;
+        size = std::max(align_up(size), minimum_superblock_size);
     else {
         size = size_superblocks_;
     }
     auto [ret, _] = free_blocks_.insert({mm_.allocate(size), size});
+    superblocks_.push_back(*ret);
+    memory_range_provider::ranges_changed();
 
     current_size_ += size;
     return *ret;
 }
 
+std::size_t arena_memory_resource_impl::ranges_revision() const {
+
+    // Superblocks are only ever added, so their count identifies the state.
+    return superblocks_.size();
+}
+
+void arena_memory_resource_impl::owned_ranges(
+    std::vector<memory_range_provider::range>& ranges) const {
+
+    for (const block& b : superblocks_) {
+        ranges.push_back({b.pointer(), b.size()});
+    }
+}
+
 arena_memory_resource_impl::block arena_memory_resource_impl::free_block(
     void* p, std::size_t /*size*/) noexcept {
 
-    auto const i =
-        std::find_if(allocated_blocks_.cbegin(), allocated_blocks_.cend(),
-                     [p](auto const& b) { return b.pointer() == p; });
+    // blocks are ordered by their addresses only
+    auto const i = allocated_blocks_.find(block{p, 0u});
 
     if (i == this->allocated_blocks_.end()) {
         return {};
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,12 +9,14 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_range_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 
 // System include(s).
 #include <cstddef>
 #include <limits>
 #include <set>
+#include <vector>
 
 namespace vecmem::details {
 
@@ -57,6 +59,42 @@ public:
     // @return if the allocation was found, false otherwise
     bool deallocate(void* p, std::size_t bytes, std::size_t alignment = 0);
 
+    // Allocates multiple memory blocks at once, all or nothing
+    //
+    // @param[in] n the number of memory blocks to allocate
+    // @param[in] sizes the sizes in bytes of the allocations
+    // @param[in] alignment the alignment of the allocations (unused)
+    // @param[out] ptrs the array to store the allocated pointers in
+    void allocate_bulk(std::size_t n, const std::size_t* sizes,
+                       std::size_t alignment, void** ptrs);
+
+    // Deallocates multiple memory blocks at once
+    //
+    // @param[in] n the number of memory blocks to deallocate
+    // @param[in] ptrs the pointers to the memory blocks
+    // @param[in] sizes the sizes in bytes of the deallocations
+    // @param[in] alignment the alignment of the deallocations (unused)
+    void deallocate_bulk(std::size_t n, void* const* ptrs,
+                         const std::size_t* sizes, std::size_t alignment);
+
+    // Makes sure that multiple upcoming allocations fit into a free block
+    //
+    // @param[in] n the number of upcoming allocations
+    // @param[in] sizes the sizes in bytes of the allocations
+    // @param[in] alignment the alignment of the allocations (unused)
+    void reserve_bulk(std::size_t n, const std::size_t* sizes,
+                      std::size_t alignment);
+
+    // Get the revision of the superblocks allocated from upstream
+    //
+    // @return a number that changes whenever a new superblock is allocated
+    std::size_t ranges_revision() const;
+
+    // Get the address ranges of the superblocks allocated from upstream
+    //
+    // @param[out] ranges the vector to append the superblock ranges to
+    void owned_ranges(std::vector<memory_range_provider::range>& ranges) const;
+
 private:
     /// Representation of a memory block
     class block {
@@ -128,6 +166,7 @@ private:
 
     // Allocate space from upstream to supply the arena and return a superblock.
     //
+    // @param[in] size The number of bytes that the superblock must hold.
     // @return block A superblock.
     block expand_arena(std::size_t size);
 
@@ -149,6 +188,8 @@ private:
     // Address-ordered set of free blocks
     std::set<block> free_blocks_;
     std::set<block> allocated_blocks_;
+    // All superblocks allocated from upstream
+    std::vector<block> superblocks_;
 
 };  // class arena_memory_resource_impl
 
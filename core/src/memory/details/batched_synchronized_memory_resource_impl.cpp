@@ -0,0 +1,199 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "batched_synchronized_memory_resource_impl.hpp"
+
+#include "../../utils/integer_math.hpp"
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+namespace vecmem::details {
+namespace {
+
+/// Check the options of the memory resource, and return the queue's mask
+///
+/// @param opts The options to check
+/// @return The mask to use for turning queue positions into slot indices
+///
+std::size_t queue_mask(
+    const batched_synchronized_memory_resource::options& opts) {
+
+    if ((opts.queue_capacity < 2u) ||
+        (!vecmem::details::is_power_of_2(opts.queue_capacity))) {
+        throw std::invalid_argument(
+            "The de-allocation queue capacity must be a power of 2, larger "
+            "than 1");
+    }
+    return opts.queue_capacity - 1u;
+}
+
+}  // namespace
+
+batched_synchronized_memory_resource_impl::
+    batched_synchronized_memory_resource_impl(
+        memory_resource& upstream,
+        const batched_synchronized_memory_resource::options& opts)
+    : m_upstream(upstream), m_options(opts), m_mask(queue_mask(opts)) {
+
+    // Set up the slots of the queue.
+    m_slots = std::make_unique<slot[]>(m_options.queue_capacity);
+    for (std::size_t i = 0; i < m_options.queue_capacity; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Launch the background thread, if it was requested.
+    if (m_options.background_drain) {
+        m_thread = std::thread([this]() { background_loop(); });
+    }
+}
+
+batched_synchronized_memory_resource_impl::
+    ~batched_synchronized_memory_resource_impl() {
+
+    // Stop the background thread.
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_thread_mutex);
+            m_stop = true;
+        }
+        m_thread_cv.notify_one();
+        m_thread.join();
+    }
+
+    // Return all remaining memory to the upstream resource.
+    drain();
+}
+
+void* batched_synchronized_memory_resource_impl::allocate(
+    std::size_t bytes, std::size_t alignment) {
+
+    // Take the lock once, for both the draining and the allocation.
+    const std::scoped_lock lock{m_mutex};
+    drain_locked();
+    return m_upstream.get().allocate(bytes, alignment);
+}
+
+void batched_synchronized_memory_resource_impl::deallocate(
+    void* ptr, std::size_t bytes, std::size_t alignment) {
+
+    // Try to queue the request without taking the lock.
+    const std::size_t pending =
+        m_pending.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    if (push(request{ptr, bytes, alignment})) {
+        // Wake up the background thread if the queue is filling up.
+        if (m_thread.joinable() &&
+            (pending == (m_options.queue_capacity / 2u))) {
+            m_thread_cv.notify_one();
+        }
+        return;
+    }
+
+    // If the queue is full, drain it on this thread, and de-allocate the
+    // current block directly.
+    m_pending.fetch_sub(1u, std::memory_order_relaxed);
+    VECMEM_DEBUG_MSG(4, "De-allocation queue full, draining it in place");
+    const std::scoped_lock lock{m_mutex};
+    drain_locked();
+    m_upstream.get().deallocate(ptr, bytes, alignment);
+}
+
+void batched_synchronized_memory_resource_impl::drain() {
+
+    const std::scoped_lock lock{m_mutex};
+    drain_locked();
+}
+
+bool batched_synchronized_memory_resource_impl::push(const request& req) {
+
+    // This is the enqueue operation of Dmitry Vyukov's bounded MPMC queue.
+    // Each slot's sequence number tells whether it is free for the producer
+    // at a given queue position.
+    std::size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    slot* s = nullptr;
+    while (true) {
+        s = &(m_slots[pos & m_mask]);
+        const std::size_t seq = s->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t diff =
+            static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (m_enqueue_pos.compare_exchange_weak(
+                    pos, pos + 1u, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The queue is full.
+            return false;
+        } else {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Store the request, and publish it for the consumer.
+    assert(s != nullptr);
+    s->payload = req;
+    s->sequence.store(pos + 1u, std::memory_order_release);
+    return true;
+}
+
+bool batched_synchronized_memory_resource_impl::pop(request& req) {
+
+    // There is only a single consumer at any time (the one holding the lock),
+    // so the dequeue position doesn't need to be atomic.
+    slot& s = m_slots[m_dequeue_pos & m_mask];
+    const std::size_t seq = s.sequence.load(std::memory_order_acquire);
+    if (seq != (m_dequeue_pos + 1u)) {
+        // The queue is empty, or the next producer has not finished writing
+        // its request yet.
+        return false;
+    }
+
+    // Take the request, and release the slot for the producers.
+    req = s.payload;
+    s.sequence.store(m_dequeue_pos + m_mask + 1u, std::memory_order_release);
+    ++m_dequeue_pos;
+    return true;
+}
+
+void batched_synchronized_memory_resource_impl::drain_locked() {
+
+    // Return every queued memory block to the upstream resource.
+    request req;
+    std::size_t n_drained = 0u;
+    while (pop(req)) {
+        m_upstream.get().deallocate(req.pointer, req.bytes, req.alignment);
+        ++n_drained;
+    }
+    if (n_drained > 0u) {
+        m_pending.fetch_sub(n_drained, std::memory_order_relaxed);
+        VECMEM_DEBUG_MSG(5, "Drained %lu de-allocation request(s)", n_drained);
+    }
+}
+
+void batched_synchronized_memory_resource_impl::background_loop() {
+
+    std::unique_lock<std::mutex> lock(m_thread_mutex);
+    while (!m_stop) {
+        // Wait for the next draining period, or to be woken up.
+        m_thread_cv.wait_for(lock, m_options.drain_interval);
+        if (m_stop) {
+            break;
+        }
+        // Drain the queue if there is anything in it.
+        if (m_pending.load(std::memory_order_relaxed) > 0u) {
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    }
+}
+
+}  // namespace vecmem::details
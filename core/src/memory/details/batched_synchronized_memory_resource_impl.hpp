@@ -0,0 +1,106 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/batched_synchronized_memory_resource.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace vecmem::details {
+
+/// Implementation of @c vecmem::batched_synchronized_memory_resource
+class batched_synchronized_memory_resource_impl {
+
+public:
+    /// Constructor, on top of another memory resource
+    batched_synchronized_memory_resource_impl(
+        memory_resource& upstream,
+        const batched_synchronized_memory_resource::options& opts);
+
+    /// Destructor, stopping the background thread and draining the queue
+    ~batched_synchronized_memory_resource_impl();
+
+    /// Allocate memory, draining the de-allocation queue first
+    void* allocate(std::size_t bytes, std::size_t alignment);
+
+    /// Queue a memory block for de-allocation
+    void deallocate(void* ptr, std::size_t bytes, std::size_t alignment);
+
+    /// Return all queued de-allocations to the upstream resource
+    void drain();
+
+private:
+    /// Description of a single de-allocation request
+    struct request {
+        /// Pointer to the memory block
+        void* pointer = nullptr;
+        /// Size of the memory block
+        std::size_t bytes = 0u;
+        /// Alignment of the memory block
+        std::size_t alignment = 0u;
+    };
+
+    /// One slot of the (bounded, lock-free) de-allocation queue
+    struct slot {
+        /// Sequence number used for synchronizing producers and the consumer
+        std::atomic<std::size_t> sequence{0u};
+        /// The de-allocation request stored in the slot
+        request payload;
+    };
+
+    /// Try to push a de-allocation request into the queue
+    bool push(const request& req);
+    /// Try to pop a de-allocation request from the queue
+    ///
+    /// Must only be called while holding @c m_mutex.
+    ///
+    bool pop(request& req);
+    /// Drain the queue, assuming that @c m_mutex is already held
+    void drain_locked();
+    /// Function executed by the background thread
+    void background_loop();
+
+    /// The upstream memory resource
+    std::reference_wrapper<memory_resource> m_upstream;
+    /// The options for the memory resource
+    batched_synchronized_memory_resource::options m_options;
+
+    /// Mutex protecting the upstream memory resource (and the queue's tail)
+    std::mutex m_mutex;
+
+    /// The slots of the de-allocation queue
+    std::unique_ptr<slot[]> m_slots;
+    /// Mask used for turning queue positions into slot indices
+    const std::size_t m_mask;
+    /// The position where the next de-allocation request is pushed to
+    alignas(64) std::atomic<std::size_t> m_enqueue_pos{0u};
+    /// The position where the next de-allocation request is popped from
+    alignas(64) std::size_t m_dequeue_pos = 0u;
+    /// Approximate number of requests waiting in the queue
+    std::atomic<std::size_t> m_pending{0u};
+
+    /// Mutex used by the background thread's condition variable
+    std::mutex m_thread_mutex;
+    /// Condition variable used for waking up the background thread
+    std::condition_variable m_thread_cv;
+    /// Flag telling the background thread to stop
+    bool m_stop = false;
+    /// The background thread draining the queue (if requested)
+    std::thread m_thread;
+
+};  // class batched_synchronized_memory_resource_impl
+
+}  // namespace vecmem::details
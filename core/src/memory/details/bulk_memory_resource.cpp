@@ -0,0 +1,18 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/details/bulk_memory_resource.hpp"
+
+namespace vecmem::details {
+
+bulk_memory_resource::~bulk_memory_resource() = default;
+
+void bulk_memory_resource::do_reserve_bulk(std::size_t, const std::size_t*,
+                                           std::size_t) {}
+
+}  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -27,14 +27,19 @@ void *choice_memory_resource_impl::allocate(std::size_t size,
 
     /*
      * We cannot blindly allocate, because we need to keep track of which
-     * upstream allocator allocated this memory. Thus, we must also store
-     * the allocation result in a map.
+     * upstream allocator allocated this memory. Thus, unless the resource
+     * can tell us itself later on that it owns this memory, we must also
+     * store the allocation result in a map. (Range providers may hand out
+     * some memory from outside of their advertised ranges, so this needs to
+     * be checked every time.)
      */
     memory_resource &res = m_decision(size, align);
 
     void *ptr = res.allocate(size, align);
 
-    m_allocations.emplace(ptr, res);
+    if (!m_ranges.add(res) || (m_ranges.find(ptr) != &res)) {
+        m_allocations.emplace(ptr, res);
+    }
 
     return ptr;
 }
@@ -48,22 +53,32 @@ void choice_memory_resource_impl::deallocate(void *ptr, std::size_t size,
 
     /*
      * Extract the record of which upstream resource was used to allocate the
-     * given pointer.
+     * given pointer, if it had to be recorded explicitly.
+     */
+    if (!m_allocations.empty()) {
+        auto nh = m_allocations.extract(ptr);
+        if (nh) {
+            memory_resource &res = nh.mapped();
+            res.deallocate(nh.key(), size, align);
+            return;
+        }
+    }
+
+    /*
+     * Otherwise find the owner of the pointer in the range table.
      */
-    auto nh = m_allocations.extract(ptr);
+    memory_resource *res = m_ranges.find(ptr);
 
     /*
      * For debug builds, throw an assertion error if we do not know this
      * allocation.
      */
-    assert(nh);
+    assert(res != nullptr);
 
     /*
-     * Retrieve the correct resource and deallocate the memory.
+     * Deallocate the memory with the correct resource.
      */
-    memory_resource &res = nh.mapped();
-
-    res.deallocate(nh.key(), size, align);
+    res->deallocate(ptr, size, align);
 }
 
 }  // namespace vecmem::details
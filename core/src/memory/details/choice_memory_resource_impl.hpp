@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "memory_range_table.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 
 // System include(s).
@@ -31,7 +32,15 @@ public:
     void deallocate(void* p, std::size_t size, std::size_t align);
 
 private:
+    /// Table of the address ranges owned by the chosen resources
+    memory_range_table m_ranges;
+
     /// The map of allocations to memory resources
+    ///
+    /// Only used for upstream resources that cannot provide range
+    /// information about themselves, and for the allocations that range
+    /// providers make outside of their advertised ranges.
+    ///
     std::unordered_map<void*, std::reference_wrapper<memory_resource>>
         m_allocations;
 
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -16,7 +16,16 @@ namespace vecmem::details {
 
 coalescing_memory_resource_impl::coalescing_memory_resource_impl(
     std::vector<std::reference_wrapper<memory_resource>> &&upstreams)
-    : m_upstreams(upstreams) {}
+    : m_upstreams(upstreams) {
+
+    /*
+     * Find out which upstream resources can tell us which memory they own.
+     */
+    m_has_ranges.reserve(m_upstreams.size());
+    for (memory_resource &res : m_upstreams) {
+        m_has_ranges.push_back(m_ranges.add(res));
+    }
+}
 
 void *coalescing_memory_resource_impl::allocate(std::size_t size,
                                                 std::size_t align) {
@@ -28,15 +37,21 @@ void *coalescing_memory_resource_impl::allocate(std::size_t size,
     /*
      * Try to allocate with each of the upstream resources.
      */
-    for (memory_resource &res : m_upstreams) {
+    for (std::size_t i = 0; i < m_upstreams.size(); ++i) {
+        memory_resource &res = m_upstreams[i];
         try {
             /*
              * Try to allocate the memory, and store the result with the
-             * allocator reference in the allocation map.
+             * allocator reference in the allocation map. Unless the resource
+             * can tell us itself later on that it owns this memory. (Range
+             * providers may hand out some memory from outside of their
+             * advertised ranges, so this needs to be checked every time.)
              */
             void *ptr = res.allocate(size, align);
 
-            m_allocations.emplace(ptr, res);
+            if (!m_has_ranges[i] || (m_ranges.find(ptr) != &res)) {
+                m_allocations.emplace(ptr, res);
+            }
 
             return ptr;
         } catch (std::bad_alloc &) {
@@ -61,23 +76,35 @@ void coalescing_memory_resource_impl::deallocate(void *ptr, std::size_t size,
     }
 
     /*
-     * Fetch the resource used to allocate this pointer.
+     * Check whether the pointer was allocated by a resource that we had to
+     * record explicitly. This has to come first, in case such a resource
+     * would itself be allocating from one of the range providers.
      */
-    auto nh = m_allocations.extract(ptr);
+    if (!m_allocations.empty()) {
+        auto nh = m_allocations.extract(ptr);
+        if (nh) {
+            memory_resource &res = nh.mapped();
+            res.deallocate(nh.key(), size, align);
+            return;
+        }
+    }
+
+    /*
+     * Otherwise find the owner of the pointer in the range table.
+     */
+    memory_resource *res = m_ranges.find(ptr);
 
     /*
      * For debug builds, throw an assertion error if we do not know this
      * allocation.
      */
-    assert(nh);
+    assert(res != nullptr);
 
     /*
      * If we know who allocated this memory, forward the deallocation request
      * to them.
      */
-    memory_resource &res = nh.mapped();
-
-    res.deallocate(nh.key(), size, align);
+    res->deallocate(ptr, size, align);
 }
 
 }  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "memory_range_table.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 
 // System include(s).
@@ -35,7 +36,17 @@ private:
     /// The vector of upstream memory resources
     const std::vector<std::reference_wrapper<memory_resource>> m_upstreams;
 
+    /// Flags showing which upstream resources provide range information
+    std::vector<bool> m_has_ranges;
+    /// Table of the address ranges owned by the upstream resources
+    memory_range_table m_ranges;
+
     /// The map of allocations to memory resources
+    ///
+    /// Only used for upstream resources that cannot provide range
+    /// information about themselves, and for the allocations that range
+    /// providers make outside of their advertised ranges.
+    ///
     std::unordered_map<void*, std::reference_wrapper<memory_resource>>
         m_allocations;
 
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -85,4 +85,69 @@ void contiguous_memory_resource_impl::deallocate(void *, std::size_t,
     return;
 }
 
+void contiguous_memory_resource_impl::allocate_bulk(std::size_t n,
+                                                    const std::size_t *sizes,
+                                                    std::size_t alignment,
+                                                    void **ptrs) {
+
+    /*
+     * Hand out consecutive, aligned pieces of the remaining memory. If any of
+     * them would not fit, roll back to where we started, so that none of the
+     * memory blocks would be allocated.
+     */
+    char *const start = m_next;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (sizes[i] == 0) {
+            ptrs[i] = nullptr;
+            continue;
+        }
+        std::size_t rem = m_size - static_cast<std::size_t>(m_next - m_begin);
+        void *result = m_next;
+        if (std::align(alignment, sizes[i], result, rem) == nullptr) {
+            m_next = start;
+            throw std::bad_alloc();
+        }
+        ptrs[i] = result;
+        m_next = static_cast<char *>(result) + sizes[i];
+    }
+
+    VECMEM_DEBUG_MSG(4, "Allocated %lu blocks with %lu bytes in total", n,
+                     static_cast<std::size_t>(m_next - start));
+}
+
+void contiguous_memory_resource_impl::reserve_bulk(
+    std::size_t n, const std::size_t *sizes, std::size_t alignment) const {
+
+    /*
+     * All of the memory of the resource is acquired at construction, so there
+     * is nothing to prepare. But since the resource can not grow, let the user
+     * know early if the upcoming allocations would not fit into what is left.
+     */
+    std::size_t rem = m_size - static_cast<std::size_t>(m_next - m_begin);
+    void *next = m_next;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (sizes[i] == 0) {
+            continue;
+        }
+        if (std::align(alignment, sizes[i], next, rem) == nullptr) {
+            VECMEM_DEBUG_MSG(1,
+                             "Upcoming allocation %lu/%lu of %lu bytes will "
+                             "not fit into the remaining memory",
+                             i + 1, n, sizes[i]);
+            return;
+        }
+        next = static_cast<char *>(next) + sizes[i];
+        rem -= sizes[i];
+    }
+}
+
+void contiguous_memory_resource_impl::owned_ranges(
+    std::vector<memory_range_provider::range> &ranges) const {
+
+    /*
+     * The resource only ever owns its single memory blob.
+     */
+    ranges.push_back({m_begin, m_size});
+}
+
 }  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,10 +9,12 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_range_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 
 // System include(s).
 #include <cstddef>
+#include <vector>
 
 namespace vecmem::details {
 
@@ -31,6 +33,16 @@ public:
     /// De-allocate a previously allocated memory block
     void deallocate(void* ptr, std::size_t size, std::size_t alignment);
 
+    /// Allocate multiple memory blocks at once, all or nothing
+    void allocate_bulk(std::size_t n, const std::size_t* sizes,
+                       std::size_t alignment, void** ptrs);
+    /// Check whether a number of upcoming allocations would fit
+    void reserve_bulk(std::size_t n, const std::size_t* sizes,
+                      std::size_t alignment) const;
+
+    /// Get the address range(s) owned by the resource
+    void owned_ranges(std::vector<memory_range_provider::range>& ranges) const;
+
 private:
     /// Upstream memory resource to allocate the one memory blob with
     memory_resource& m_upstream;
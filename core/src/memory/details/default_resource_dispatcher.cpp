@@ -0,0 +1,99 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "default_resource_dispatcher.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace vecmem::details {
+namespace {
+
+/// Get the size of the header to put in front of an allocation
+///
+/// It must be large enough to hold a pointer, and must keep the payload
+/// aligned correctly.
+///
+std::size_t header_size(std::size_t alignment) {
+
+    return ((alignment > sizeof(memory_resource*)) ? alignment
+                                                   : sizeof(memory_resource*));
+}
+
+/// Set/exchange the process-wide default memory resource
+memory_resource* exchange_default_resource(memory_resource* res) {
+
+#if defined(VECMEM_HAVE_PMR_MEMORY_RESOURCE)
+    return std::pmr::set_default_resource(res);
+#else
+    return std::experimental::pmr::set_default_resource(res);
+#endif
+}
+
+}  // namespace
+
+thread_local memory_resource*
+    default_resource_dispatcher::override_resource = nullptr;
+
+default_resource_dispatcher& default_resource_dispatcher::instance() {
+
+    // The dispatcher is never destroyed, as memory allocated through it may
+    // be released during the destruction of other static objects.
+    static default_resource_dispatcher* dispatcher =
+        new default_resource_dispatcher();
+    return *dispatcher;
+}
+
+default_resource_dispatcher::default_resource_dispatcher()
+    : m_fallback(exchange_default_resource(this)) {
+
+    VECMEM_DEBUG_MSG(2, "Installed the default resource dispatcher");
+}
+
+void* default_resource_dispatcher::do_allocate(std::size_t bytes,
+                                               std::size_t alignment) {
+
+    // Decide which resource to use.
+    memory_resource* res =
+        ((override_resource != nullptr) ? override_resource : m_fallback);
+
+    // Allocate the memory, with some extra space for the header.
+    const std::size_t header = header_size(alignment);
+    if (bytes > (std::numeric_limits<std::size_t>::max() - header)) {
+        throw std::bad_alloc();
+    }
+    char* block = static_cast<char*>(res->allocate(bytes + header, alignment));
+
+    // Remember which resource made the allocation.
+    std::memcpy(block + header - sizeof(memory_resource*), &res,
+                sizeof(memory_resource*));
+    return block + header;
+}
+
+void default_resource_dispatcher::do_deallocate(void* ptr, std::size_t bytes,
+                                                std::size_t alignment) {
+
+    // Find the resource that made the allocation.
+    assert(ptr != nullptr);
+    const std::size_t header = header_size(alignment);
+    char* block = static_cast<char*>(ptr) - header;
+    memory_resource* res = nullptr;
+    std::memcpy(&res, block + header - sizeof(memory_resource*),
+                sizeof(memory_resource*));
+
+    // Let it de-allocate the memory.
+    assert(res != nullptr);
+    res->deallocate(block, bytes + header, alignment);
+}
+
+}  // namespace vecmem::details
@@ -0,0 +1,55 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/details/memory_resource_base.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::details {
+
+/// Default memory resource honouring thread-local overrides
+///
+/// It is installed as the process-wide default memory resource by the first
+/// @c vecmem::scoped_default_resource guard. Every allocation made through it
+/// is prefixed with a header that records the memory resource that performed
+/// the allocation, so that de-allocations could be routed back to it from any
+/// thread, at any point in time.
+///
+class default_resource_dispatcher final : public memory_resource_base {
+
+public:
+    /// Get the dispatcher, installing it as the default resource if needed
+    static default_resource_dispatcher& instance();
+
+    /// The override of the current thread
+    static thread_local memory_resource* override_resource;
+
+private:
+    /// Constructor, installing the object as the default resource
+    default_resource_dispatcher();
+
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory with the current thread's default resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// De-allocate memory with the resource that allocated it
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+
+    /// @}
+
+    /// The default resource that was active before the dispatcher
+    memory_resource* m_fallback;
+
+};  // class default_resource_dispatcher
+
+}  // namespace vecmem::details
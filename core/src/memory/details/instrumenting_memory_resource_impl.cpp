@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -42,6 +42,12 @@ void instrumenting_memory_resource_impl::add_pre_deallocate_hook(
     m_pre_deallocate_hooks.push_back(f);
 }
 
+void instrumenting_memory_resource_impl::add_post_deallocate_hook(
+    std::function<void(void *, std::size_t, std::size_t)> f) {
+
+    m_post_deallocate_hooks.push_back(f);
+}
+
 void *instrumenting_memory_resource_impl::allocate(std::size_t size,
                                                    std::size_t align) {
 
@@ -158,6 +164,14 @@ void instrumenting_memory_resource_impl::deallocate(void *ptr, std::size_t size,
     m_events.emplace_back(
         instrumenting_memory_resource::memory_event::type::DEALLOCATION, size,
         align, ptr, time);
+
+    /*
+     * Finally, we run all of our post-deallocation hooks.
+     */
+    for (const std::function<void(void *, std::size_t, std::size_t)> &f :
+         m_post_deallocate_hooks) {
+        f(ptr, size, align);
+    }
 }
 
 }  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -75,6 +75,19 @@ public:
     void add_pre_deallocate_hook(
         std::function<void(void*, std::size_t, std::size_t)> f);
 
+    /**
+     * @brief Add a post-deallocation hook.
+     *
+     * Whenever memory is deallocated, all post-deallocation hooks are
+     * executed after the upstream resource has returned.
+     *
+     * The function passed to this function should accept the pointer that
+     * was deallocated as its first argument, the size of the request as the
+     * second argument, and the alignment as the third.
+     */
+    void add_post_deallocate_hook(
+        std::function<void(void*, std::size_t, std::size_t)> f);
+
     /// Allocate memory with a upstream memory resource
     void* allocate(std::size_t, std::size_t);
 
@@ -112,6 +125,12 @@ private:
     std::vector<std::function<void(void*, std::size_t, std::size_t)>>
         m_pre_deallocate_hooks;
 
+    /*
+     * The list of all post-deallocation hooks.
+     */
+    std::vector<std::function<void(void*, std::size_t, std::size_t)>>
+        m_post_deallocate_hooks;
+
 };  // class instrumenting_memory_resource_impl
 
 }  // namespace vecmem::details
@@ -0,0 +1,34 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/details/memory_range_provider.hpp"
+
+// System include(s).
+#include <atomic>
+
+namespace vecmem::details {
+namespace {
+
+/// Counter changing whenever the ranges of any provider change
+std::atomic<std::size_t> global_revision{0u};
+
+}  // namespace
+
+memory_range_provider::~memory_range_provider() = default;
+
+std::size_t memory_range_provider::global_ranges_revision() noexcept {
+
+    return global_revision.load(std::memory_order_acquire);
+}
+
+void memory_range_provider::ranges_changed() noexcept {
+
+    global_revision.fetch_add(1u, std::memory_order_acq_rel);
+}
+
+}  // namespace vecmem::details
@@ -0,0 +1,113 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "memory_range_table.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+
+namespace vecmem::details {
+
+bool memory_range_table::add(memory_resource& res) {
+
+    // Check whether we've seen this resource already.
+    for (const provider& p : m_providers) {
+        if (p.resource == &res) {
+            return true;
+        }
+    }
+    if (std::find(m_others.begin(), m_others.end(), &res) != m_others.end()) {
+        return false;
+    }
+
+    // If not, check whether it can provide its ranges.
+    const memory_range_provider* ranges =
+        dynamic_cast<const memory_range_provider*>(&res);
+    if (ranges == nullptr) {
+        m_others.push_back(&res);
+        return false;
+    }
+    m_providers.push_back({&res, ranges, ranges->ranges_revision()});
+    m_dirty = true;
+    return true;
+}
+
+memory_resource* memory_range_table::find(const void* ptr) {
+
+    // Check whether any of the providers changed their ranges. But only if
+    // any provider in the process changed its ranges since the last check.
+    const std::size_t global_revision =
+        memory_range_provider::global_ranges_revision();
+    if (global_revision != m_global_revision) {
+        m_global_revision = global_revision;
+        for (provider& p : m_providers) {
+            const std::size_t revision = p.ranges->ranges_revision();
+            if (revision != p.revision) {
+                p.revision = revision;
+                m_dirty = true;
+            }
+        }
+    }
+    if (m_dirty) {
+        rebuild();
+    }
+
+    // Find the last range that starts at or before the pointer.
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+    auto it = std::upper_bound(
+        m_entries.begin(), m_entries.end(), address,
+        [](std::uintptr_t a, const entry& e) { return a < e.begin; });
+
+    // Walk backwards, for as long as a preceding range may still contain the
+    // pointer. (Which only happens for nested ranges.)
+    while (it != m_entries.begin()) {
+        --it;
+        if (address < it->end) {
+            return it->resource;
+        }
+        if (address >= it->max_end) {
+            break;
+        }
+    }
+    return nullptr;
+}
+
+void memory_range_table::rebuild() {
+
+    m_entries.clear();
+    for (const provider& p : m_providers) {
+        m_buffer.clear();
+        p.ranges->owned_ranges(m_buffer);
+        for (const memory_range_provider::range& r : m_buffer) {
+            const std::uintptr_t begin =
+                reinterpret_cast<std::uintptr_t>(r.begin);
+            m_entries.push_back({begin, begin + r.size, 0u, p.resource});
+        }
+    }
+
+    // Order the ranges by their beginning addresses. Larger ranges come
+    // first, so that for nested ranges the innermost one would be found.
+    std::sort(m_entries.begin(), m_entries.end(),
+              [](const entry& a, const entry& b) {
+                  return ((a.begin < b.begin) ||
+                          ((a.begin == b.begin) && (a.end > b.end)));
+              });
+    std::uintptr_t max_end = 0u;
+    for (entry& e : m_entries) {
+        max_end = std::max(max_end, e.end);
+        e.max_end = max_end;
+    }
+
+    m_dirty = false;
+    VECMEM_DEBUG_MSG(5, "Re-built the range table with %lu range(s)",
+                     m_entries.size());
+}
+
+}  // namespace vecmem::details
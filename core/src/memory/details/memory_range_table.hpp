@@ -0,0 +1,94 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/details/memory_range_provider.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Sorted table of the address ranges owned by a set of memory resources
+///
+/// It is used by the memory resources that dispatch allocations to multiple
+/// upstream resources, to find the owner of a pointer without having to
+/// record every single allocation. Only memory resources implementing
+/// @c vecmem::details::memory_range_provider can be registered in it.
+///
+/// The table is not thread safe, just like the memory resources using it.
+///
+class memory_range_table {
+
+public:
+    /// Register a memory resource, if it can provide its address ranges
+    ///
+    /// @param res The memory resource to (try to) register
+    /// @return @c true if the resource provides range information, @c false
+    ///         otherwise
+    ///
+    bool add(memory_resource& res);
+
+    /// Find the registered memory resource owning a pointer
+    ///
+    /// Note that providers may hand out pointers from outside of their
+    /// advertised ranges, so clients need to check every new allocation
+    /// with this function, and track the owners of such pointers themselves.
+    ///
+    /// @param ptr The pointer to look up
+    /// @return The owning memory resource, or @c nullptr if none of the
+    ///         registered resources own the pointer
+    ///
+    memory_resource* find(const void* ptr);
+
+private:
+    /// Description of one registered memory resource
+    struct provider {
+        /// The memory resource
+        memory_resource* resource = nullptr;
+        /// The range provider interface of the memory resource
+        const memory_range_provider* ranges = nullptr;
+        /// The last seen revision of the resource's ranges
+        std::size_t revision = 0u;
+    };
+
+    /// One entry in the range table
+    struct entry {
+        /// The beginning of the address range
+        std::uintptr_t begin = 0u;
+        /// The (exclusive) end of the address range
+        std::uintptr_t end = 0u;
+        /// The largest end address of this and all preceding entries
+        std::uintptr_t max_end = 0u;
+        /// The memory resource owning the range
+        memory_resource* resource = nullptr;
+    };
+
+    /// Re-build the table from the registered providers
+    void rebuild();
+
+    /// The registered range providers
+    std::vector<provider> m_providers;
+    /// Memory resources known not to provide range information
+    std::vector<const memory_resource*> m_others;
+    /// The range table, ordered by the ranges' beginning addresses
+    std::vector<entry> m_entries;
+    /// Buffer used while re-building the table
+    std::vector<memory_range_provider::range> m_buffer;
+    /// The last seen global revision of all range providers
+    std::size_t m_global_revision = ~std::size_t{0u};
+    /// Flag showing that the table needs to be re-built
+    bool m_dirty = false;
+
+};  // class memory_range_table
+
+}  // namespace vecmem::details
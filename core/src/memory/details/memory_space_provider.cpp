@@ -0,0 +1,15 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
+
+namespace vecmem::details {
+
+memory_space_provider::~memory_space_provider() = default;
+
+}  // namespace vecmem::details
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -175,44 +175,7 @@ void* pool_memory_resource_impl::allocate(std::size_t bytes,
     // If the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list.
     if (bucket.free_blocks.empty()) {
-
-        const std::size_t bucket_size = static_cast<std::size_t>(1)
-                                        << bytes_log2;
-
-        std::size_t n = bucket.previous_allocated_count;
-        if (n == 0) {
-            n = m_options.min_blocks_per_chunk;
-            if (n < (m_options.min_bytes_per_chunk >> bytes_log2)) {
-                n = m_options.min_bytes_per_chunk >> bytes_log2;
-            }
-        } else {
-            n = n * 3 / 2;
-            if (n > (m_options.max_bytes_per_chunk >> bytes_log2)) {
-                n = m_options.max_bytes_per_chunk >> bytes_log2;
-            }
-            if (n > m_options.max_blocks_per_chunk) {
-                n = m_options.max_blocks_per_chunk;
-            }
-        }
-
-        bytes = n << bytes_log2;
-
-        assert(n >= m_options.min_blocks_per_chunk);
-        assert(n <= m_options.max_blocks_per_chunk);
-        assert(bytes >= m_options.min_bytes_per_chunk);
-        assert(bytes <= m_options.max_bytes_per_chunk);
-
-        chunk_descriptor allocated;
-        allocated.size = bytes;
-        allocated.pointer =
-            m_upstream.get().allocate(bytes, m_options.alignment);
-        m_allocated.push_back(allocated);
-        bucket.previous_allocated_count = n;
-
-        for (std::size_t i = 0; i < n; ++i) {
-            bucket.free_blocks.push_back(static_cast<void*>(
-                static_cast<char*>(allocated.pointer) + i * bucket_size));
-        }
+        refill(bucket, bytes_log2);
     }
 
     // Use a block from the back of the bucket's free list.
@@ -266,6 +229,137 @@ void pool_memory_resource_impl::deallocate(void* ptr, std::size_t bytes,
     bucket.free_blocks.push_back(ptr);
 }
 
+void pool_memory_resource_impl::allocate_bulk(std::size_t n,
+                                              const std::size_t* sizes,
+                                              std::size_t alignment,
+                                              void** ptrs) {
+
+    // Make sure that the buckets would have all the blocks that we need.
+    reserve_bulk(n, sizes, alignment);
+
+    // Hand out the blocks one by one. Which should now not need to go to the
+    // upstream resource, at least not for non-oversized blocks.
+    std::size_t i = 0;
+    try {
+        for (; i < n; ++i) {
+            ptrs[i] =
+                ((sizes[i] != 0u) ? allocate(sizes[i], alignment) : nullptr);
+        }
+    } catch (...) {
+        deallocate_bulk(i, ptrs, sizes, alignment);
+        throw;
+    }
+}
+
+void pool_memory_resource_impl::deallocate_bulk(std::size_t n,
+                                                void* const* ptrs,
+                                                const std::size_t* sizes,
+                                                std::size_t alignment) {
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((ptrs[i] != nullptr) && (sizes[i] != 0u)) {
+            deallocate(ptrs[i], sizes[i], alignment);
+        }
+    }
+}
+
+void pool_memory_resource_impl::reserve_bulk(std::size_t n,
+                                             const std::size_t* sizes,
+                                             std::size_t alignment) {
+
+    // Overaligned blocks are never served from the buckets.
+    if (alignment > m_options.alignment) {
+        return;
+    }
+
+    // Count how many blocks would be needed from each bucket.
+    std::vector<std::size_t> needed(m_pools.size(), 0u);
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((sizes[i] == 0u) || (sizes[i] > m_options.largest_block_size)) {
+            continue;
+        }
+        const std::size_t bytes =
+            std::max(sizes[i], m_options.smallest_block_size);
+        ++needed[vecmem::details::log2_ri(bytes) - m_smallest_block_log2];
+    }
+
+    // Refill the buckets that would not have enough free blocks, with as few
+    // chunks as possible.
+    for (std::size_t i = 0; i < m_pools.size(); ++i) {
+        pool& bucket = m_pools[i];
+        while (bucket.free_blocks.size() < needed[i]) {
+            refill(bucket, i + m_smallest_block_log2,
+                   needed[i] - bucket.free_blocks.size());
+        }
+    }
+}
+
+void pool_memory_resource_impl::refill(pool& bucket, std::size_t bytes_log2,
+                                       std::size_t n_requested) {
+
+    const std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
+
+    std::size_t n = bucket.previous_allocated_count;
+    if (n == 0) {
+        n = m_options.min_blocks_per_chunk;
+        if (n < (m_options.min_bytes_per_chunk >> bytes_log2)) {
+            n = m_options.min_bytes_per_chunk >> bytes_log2;
+        }
+    } else {
+        n = n * 3 / 2;
+        if (n > (m_options.max_bytes_per_chunk >> bytes_log2)) {
+            n = m_options.max_bytes_per_chunk >> bytes_log2;
+        }
+        if (n > m_options.max_blocks_per_chunk) {
+            n = m_options.max_blocks_per_chunk;
+        }
+    }
+
+    // Allocate a larger chunk if more blocks were asked for explicitly, as
+    // far as the chunk size limits allow it.
+    if (n < n_requested) {
+        n = std::min({n_requested,
+                      m_options.max_bytes_per_chunk >> bytes_log2,
+                      m_options.max_blocks_per_chunk});
+    }
+
+    const std::size_t bytes = n << bytes_log2;
+
+    assert(n >= m_options.min_blocks_per_chunk);
+    assert(n <= m_options.max_blocks_per_chunk);
+    assert(bytes >= m_options.min_bytes_per_chunk);
+    assert(bytes <= m_options.max_bytes_per_chunk);
+
+    chunk_descriptor allocated;
+    allocated.size = bytes;
+    allocated.pointer = m_upstream.get().allocate(bytes, m_options.alignment);
+    m_allocated.push_back(allocated);
+    ++m_ranges_revision;
+    memory_range_provider::ranges_changed();
+    bucket.previous_allocated_count = n;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        bucket.free_blocks.push_back(static_cast<void*>(
+            static_cast<char*>(allocated.pointer) + i * bucket_size));
+    }
+}
+
+std::size_t pool_memory_resource_impl::ranges_revision() const {
+
+    return m_ranges_revision;
+}
+
+void pool_memory_resource_impl::owned_ranges(
+    std::vector<memory_range_provider::range>& ranges) const {
+
+    // Only the chunks used for the pools. The oversized/overaligned blocks
+    // come and go too often to be worth re-building the clients' range
+    // tables for. Clients keep track of those allocations themselves.
+    for (const chunk_descriptor& chunk : m_allocated) {
+        ranges.push_back({chunk.pointer, chunk.size});
+    }
+}
+
 bool pool_memory_resource_impl::oversized_block_descriptor::operator<(
     const oversized_block_descriptor& other) const {
     return ((size < other.size) ||
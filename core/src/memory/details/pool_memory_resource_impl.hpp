@@ -1,13 +1,14 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_range_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/memory/pool_memory_resource.hpp"
 
@@ -34,6 +35,21 @@ public:
     /// Deallocate memory
     void deallocate(void* ptr, std::size_t bytes, std::size_t alignment);
 
+    /// Allocate multiple memory blocks at once
+    void allocate_bulk(std::size_t n, const std::size_t* sizes,
+                       std::size_t alignment, void** ptrs);
+    /// Deallocate multiple memory blocks at once
+    void deallocate_bulk(std::size_t n, void* const* ptrs,
+                         const std::size_t* sizes, std::size_t alignment);
+    /// Make sure that the buckets can serve a number of upcoming allocations
+    void reserve_bulk(std::size_t n, const std::size_t* sizes,
+                      std::size_t alignment);
+
+    /// Get the revision of the pool chunks allocated from upstream
+    std::size_t ranges_revision() const;
+    /// Get the address ranges of the pool chunks allocated from upstream
+    void owned_ranges(std::vector<memory_range_provider::range>& ranges) const;
+
 private:
     /// The upstream memory resource
     std::reference_wrapper<memory_resource> m_upstream;
@@ -68,6 +84,16 @@ private:
         std::size_t previous_allocated_count = 0u;
     };
 
+    /// Allocate a new chunk from upstream for a bucket
+    ///
+    /// @param bucket The bucket to add the new blocks to
+    /// @param bytes_log2 The base-2 log of the bucket's block size
+    /// @param n_requested The minimum number of blocks to allocate, if
+    ///                    the chunk size limits allow it
+    ///
+    void refill(pool& bucket, std::size_t bytes_log2,
+                std::size_t n_requested = 0u);
+
     /// Helper variable, with the base-2 log of the smallest block size
     const std::size_t m_smallest_block_log2;
 
@@ -82,6 +108,9 @@ private:
     /// resource
     std::vector<oversized_block_descriptor> m_oversized;
 
+    /// Counter incremented every time the upstream allocations change
+    std::size_t m_ranges_revision = 0u;
+
 };  // class pool_memory_resource_impl
 
 }  // namespace vecmem::details
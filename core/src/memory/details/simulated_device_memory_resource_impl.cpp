@@ -0,0 +1,203 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "simulated_device_memory_resource_impl.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#ifdef VECMEM_HAVE_MPROTECT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // VECMEM_HAVE_MPROTECT
+#include <cassert>
+#include <new>
+#include <stdexcept>
+
+namespace vecmem::details {
+
+namespace {
+
+#ifdef VECMEM_HAVE_MPROTECT
+/// Get the size of the memory pages of the system
+std::size_t page_size() {
+
+    static const std::size_t result =
+        static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return result;
+}
+#endif  // VECMEM_HAVE_MPROTECT
+
+}  // namespace
+
+simulated_device_memory_resource_impl::simulated_device_memory_resource_impl(
+    bool protect)
+    : m_protect(protect) {
+
+#ifndef VECMEM_HAVE_MPROTECT
+    // Memory protection is not available on this platform.
+    m_protect = false;
+#endif  // not VECMEM_HAVE_MPROTECT
+}
+
+simulated_device_memory_resource_impl::
+    ~simulated_device_memory_resource_impl() {
+
+    // Release all allocations that the user forgot about.
+    for (const auto& [address, alloc] : m_allocations) {
+        release(alloc);
+    }
+}
+
+void* simulated_device_memory_resource_impl::allocate(std::size_t size,
+                                                      std::size_t alignment) {
+
+    allocation alloc;
+    alloc.m_size = size;
+    alloc.m_alignment = alignment;
+    void* ptr = nullptr;
+
+#ifdef VECMEM_HAVE_MPROTECT
+    // Map enough whole pages for the requested size and alignment. Memory
+    // protection works on whole pages, so every allocation gets its own.
+    const std::size_t page = page_size();
+    const std::size_t extra = (alignment > page ? alignment - page : 0u);
+    alloc.m_mapping_size = ((size + extra + page - 1u) / page) * page;
+    alloc.m_mapping =
+        ::mmap(nullptr, alloc.m_mapping_size,
+               (m_protect ? PROT_NONE : (PROT_READ | PROT_WRITE)),
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (alloc.m_mapping == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    const std::uintptr_t mapping =
+        reinterpret_cast<std::uintptr_t>(alloc.m_mapping);
+    ptr = reinterpret_cast<void*>(((mapping + alignment - 1u) / alignment) *
+                                  alignment);
+#else
+    // Without memory protection, fall back on plain host memory.
+    alloc.m_mapping_size = size;
+    alloc.m_mapping = ::operator new(size, std::align_val_t{alignment});
+    ptr = alloc.m_mapping;
+#endif  // VECMEM_HAVE_MPROTECT
+
+    // Remember the allocation.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_allocations.emplace(reinterpret_cast<std::uintptr_t>(ptr), alloc);
+    VECMEM_DEBUG_MSG(3, "Allocated %lu bytes of simulated device memory at %p",
+                     size, ptr);
+    return ptr;
+}
+
+void simulated_device_memory_resource_impl::deallocate(void* ptr,
+                                                       std::size_t,
+                                                       std::size_t) {
+
+    // Find the allocation.
+    allocation alloc;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto itr = m_allocations.find(reinterpret_cast<std::uintptr_t>(ptr));
+        if (itr == m_allocations.end()) {
+            throw std::invalid_argument(
+                "Pointer was not allocated by this simulated device memory "
+                "resource");
+        }
+        alloc = itr->second;
+        m_allocations.erase(itr);
+    }
+
+    // Release its memory.
+    release(alloc);
+    VECMEM_DEBUG_MSG(3, "De-allocated simulated device memory at %p", ptr);
+}
+
+bool simulated_device_memory_resource_impl::owns(const void* ptr) const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (find(reinterpret_cast<std::uintptr_t>(ptr)) !=
+            m_allocations.end());
+}
+
+void simulated_device_memory_resource_impl::unprotect(const void* ptr,
+                                                      std::size_t size) {
+
+    change_accesses(ptr, size, true);
+}
+
+void simulated_device_memory_resource_impl::protect(const void* ptr,
+                                                    std::size_t size) {
+
+    change_accesses(ptr, size, false);
+}
+
+void simulated_device_memory_resource_impl::change_accesses(
+    [[maybe_unused]] const void* ptr, [[maybe_unused]] std::size_t size,
+    [[maybe_unused]] bool enable) {
+
+    // Without memory protection, there is nothing to do.
+    if ((m_protect == false) || (size == 0u)) {
+        return;
+    }
+
+#ifdef VECMEM_HAVE_MPROTECT
+    // Visit all allocations overlapping with the range.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::uintptr_t end = begin + size;
+    auto itr = m_allocations.upper_bound(begin);
+    if (itr != m_allocations.begin()) {
+        --itr;
+    }
+    for (; (itr != m_allocations.end()) && (itr->first < end); ++itr) {
+        allocation& alloc = itr->second;
+        if (itr->first + alloc.m_size <= begin) {
+            continue;
+        }
+        // Only change the protection of the allocation on the first / last
+        // concurrent access.
+        if (enable) {
+            if (alloc.m_accesses++ == 0u) {
+                ::mprotect(alloc.m_mapping, alloc.m_mapping_size,
+                           PROT_READ | PROT_WRITE);
+            }
+        } else {
+            assert(alloc.m_accesses > 0u);
+            if (--alloc.m_accesses == 0u) {
+                ::mprotect(alloc.m_mapping, alloc.m_mapping_size, PROT_NONE);
+            }
+        }
+    }
+#endif  // VECMEM_HAVE_MPROTECT
+}
+
+void simulated_device_memory_resource_impl::release(const allocation& alloc) {
+
+#ifdef VECMEM_HAVE_MPROTECT
+    [[maybe_unused]] const int result =
+        ::munmap(alloc.m_mapping, alloc.m_mapping_size);
+    assert(result == 0);
+#else
+    ::operator delete(alloc.m_mapping, std::align_val_t{alloc.m_alignment});
+#endif  // VECMEM_HAVE_MPROTECT
+}
+
+simulated_device_memory_resource_impl::allocation_map::const_iterator
+simulated_device_memory_resource_impl::find(std::uintptr_t address) const {
+
+    // Find the last allocation starting at or before the address.
+    auto itr = m_allocations.upper_bound(address);
+    if (itr == m_allocations.begin()) {
+        return m_allocations.end();
+    }
+    --itr;
+    return ((address < itr->first + itr->second.m_size) ? itr
+                                                        : m_allocations.end());
+}
+
+}  // namespace vecmem::details
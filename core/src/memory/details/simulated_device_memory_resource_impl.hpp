@@ -0,0 +1,75 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace vecmem::details {
+
+/// Implementation for @c vecmem::simulated_device_memory_resource
+class simulated_device_memory_resource_impl {
+
+public:
+    /// Constructor, with the memory protection flag
+    explicit simulated_device_memory_resource_impl(bool protect);
+    /// Destructor, releasing all remaining allocations
+    ~simulated_device_memory_resource_impl();
+
+    /// Allocate a protected block of memory
+    void* allocate(std::size_t size, std::size_t alignment);
+    /// Deallocate a previously allocated memory block
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment);
+
+    /// Check whether the memory is really protected against host access
+    bool is_protected() const { return m_protect; }
+    /// Check whether a pointer points into one of the allocations
+    bool owns(const void* ptr) const;
+
+    /// Make the allocations overlapping with a memory range accessible
+    void unprotect(const void* ptr, std::size_t size);
+    /// Undo the effect of a previous @c unprotect(...) call
+    void protect(const void* ptr, std::size_t size);
+
+private:
+    /// Description of one allocation
+    struct allocation {
+        /// The beginning of the underlying memory mapping
+        void* m_mapping = nullptr;
+        /// The size of the underlying memory mapping
+        std::size_t m_mapping_size = 0u;
+        /// The size of the allocation, as requested by the user
+        std::size_t m_size = 0u;
+        /// The alignment of the allocation
+        std::size_t m_alignment = 0u;
+        /// The number of active accesses to the allocation
+        std::size_t m_accesses = 0u;
+    };
+
+    /// Type of the allocation map, keyed by the allocations' addresses
+    using allocation_map = std::map<std::uintptr_t, allocation>;
+
+    /// Change the accessibility of all allocations overlapping with a range
+    void change_accesses(const void* ptr, std::size_t size, bool enable);
+    /// Release the memory of an allocation
+    static void release(const allocation& alloc);
+    /// Find the allocation holding a given address
+    allocation_map::const_iterator find(std::uintptr_t address) const;
+
+    /// Whether to protect the memory against host access
+    bool m_protect;
+    /// The current allocations
+    allocation_map m_allocations;
+    /// Mutex protecting the allocation map
+    mutable std::mutex m_mutex;
+
+};  // class simulated_device_memory_resource_impl
+
+}  // namespace vecmem::details
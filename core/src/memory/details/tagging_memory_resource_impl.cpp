@@ -0,0 +1,219 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "tagging_memory_resource_impl.hpp"
+
+#include "allocation_tags.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace vecmem::details {
+namespace {
+
+/// Get the size of the header to put in front of an allocation
+///
+/// It must be large enough to hold a pointer, and must keep the payload
+/// aligned correctly.
+///
+std::size_t header_size(std::size_t alignment) {
+
+    return ((alignment > sizeof(void*)) ? alignment : sizeof(void*));
+}
+
+}  // namespace
+
+tagging_memory_resource_impl::tagging_memory_resource_impl(
+    memory_resource& upstream)
+    : m_upstream(upstream),
+      m_use_header(is_host_accessible(get_memory_space(upstream))) {}
+
+tagging_memory_resource_impl::~tagging_memory_resource_impl() {
+
+    for (std::atomic<counters_block*>& block : m_blocks) {
+        delete block.load();
+    }
+}
+
+void* tagging_memory_resource_impl::allocate(std::size_t bytes,
+                                             std::size_t alignment) {
+
+    // Find the counters of the current thread's tag.
+    counters* c = &(find_counters(current_allocation_tag_id()));
+
+    if (m_use_header) {
+        // Perform the allocation, with some extra space for the header.
+        const std::size_t header = header_size(alignment);
+        if (bytes > (std::numeric_limits<std::size_t>::max() - header)) {
+            throw std::bad_alloc();
+        }
+        char* block = static_cast<char*>(
+            m_upstream.get().allocate(bytes + header, alignment));
+
+        // Remember which counters the allocation is accounted to.
+        std::memcpy(block + header - sizeof(counters*), &c, sizeof(counters*));
+        c->allocated(bytes);
+        m_total.allocated(bytes);
+        return block + header;
+    }
+
+    // Perform the allocation, and remember which counters it is accounted to.
+    void* ptr = m_upstream.get().allocate(bytes, alignment);
+    {
+        const std::scoped_lock lock{m_allocations_mutex};
+        m_allocations.emplace(ptr, c);
+    }
+    c->allocated(bytes);
+    m_total.allocated(bytes);
+    return ptr;
+}
+
+void tagging_memory_resource_impl::deallocate(void* ptr, std::size_t bytes,
+                                              std::size_t alignment) {
+
+    assert(ptr != nullptr);
+
+    if (m_use_header) {
+        // Find the counters that the allocation was accounted to.
+        const std::size_t header = header_size(alignment);
+        char* block = static_cast<char*>(ptr) - header;
+        counters* c = nullptr;
+        std::memcpy(&c, block + header - sizeof(counters*), sizeof(counters*));
+
+        // Update the counters, and perform the de-allocation.
+        assert(c != nullptr);
+        c->deallocated(bytes);
+        m_total.deallocated(bytes);
+        m_upstream.get().deallocate(block, bytes + header, alignment);
+        return;
+    }
+
+    // Find the counters that the allocation was accounted to.
+    counters* c = nullptr;
+    {
+        const std::scoped_lock lock{m_allocations_mutex};
+        auto nh = m_allocations.extract(ptr);
+        if (nh) {
+            c = nh.mapped();
+        }
+    }
+
+    // Update the counters.
+    if (c != nullptr) {
+        c->deallocated(bytes);
+        m_total.deallocated(bytes);
+    } else {
+        VECMEM_DEBUG_MSG(1, "De-allocating unknown pointer %p", ptr);
+        assert(false);
+    }
+
+    // Perform the de-allocation.
+    m_upstream.get().deallocate(ptr, bytes, alignment);
+}
+
+std::vector<tagging_memory_resource::tag_statistics>
+tagging_memory_resource_impl::statistics() const {
+
+    // Collect the statistics of all tags used with this resource.
+    std::vector<tagging_memory_resource::tag_statistics> result;
+    for (std::size_t i = 0; i < max_blocks; ++i) {
+        const counters_block* block =
+            m_blocks[i].load(std::memory_order_acquire);
+        if (block == nullptr) {
+            continue;
+        }
+        for (std::size_t j = 0; j < block_size; ++j) {
+            const counters& c = (*block)[j];
+            if (c.n_allocations.load(std::memory_order_relaxed) == 0u) {
+                continue;
+            }
+            result.push_back(
+                c.snapshot(allocation_tag_name(i * block_size + j)));
+        }
+    }
+
+    // Order them by decreasing peak memory usage.
+    std::stable_sort(result.begin(), result.end(),
+                     [](const tagging_memory_resource::tag_statistics& a,
+                        const tagging_memory_resource::tag_statistics& b) {
+                         return a.peak_bytes > b.peak_bytes;
+                     });
+    return result;
+}
+
+tagging_memory_resource::tag_statistics
+tagging_memory_resource_impl::total_statistics() const {
+
+    return m_total.snapshot("total");
+}
+
+tagging_memory_resource_impl::counters&
+tagging_memory_resource_impl::find_counters(std::size_t tag_id) {
+
+    // Account the allocations of too many tags as untagged ones.
+    if (tag_id >= (max_blocks * block_size)) {
+        VECMEM_DEBUG_MSG(1,
+                         "Too many allocation tags, accounting tag %lu as "
+                         "untagged",
+                         tag_id);
+        tag_id = untagged_allocation_id;
+    }
+
+    // Find the block of the tag, creating it if it does not exist yet.
+    std::atomic<counters_block*>& slot = m_blocks[tag_id / block_size];
+    counters_block* block = slot.load(std::memory_order_acquire);
+    if (block == nullptr) {
+        const std::scoped_lock lock{m_blocks_mutex};
+        block = slot.load(std::memory_order_acquire);
+        if (block == nullptr) {
+            block = new counters_block();
+            slot.store(block, std::memory_order_release);
+        }
+    }
+    return (*block)[tag_id % block_size];
+}
+
+void tagging_memory_resource_impl::counters::allocated(std::size_t bytes) {
+
+    n_allocations.fetch_add(1u, std::memory_order_relaxed);
+    total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    const std::size_t current =
+        current_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while ((current > peak) &&
+           (!peak_bytes.compare_exchange_weak(peak, current,
+                                              std::memory_order_relaxed))) {
+    }
+}
+
+void tagging_memory_resource_impl::counters::deallocated(std::size_t bytes) {
+
+    n_deallocations.fetch_add(1u, std::memory_order_relaxed);
+    current_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+tagging_memory_resource::tag_statistics
+tagging_memory_resource_impl::counters::snapshot(const std::string& tag) const {
+
+    tagging_memory_resource::tag_statistics result;
+    result.tag = tag;
+    result.n_allocations = n_allocations.load(std::memory_order_relaxed);
+    result.n_deallocations = n_deallocations.load(std::memory_order_relaxed);
+    result.total_bytes = total_bytes.load(std::memory_order_relaxed);
+    result.current_bytes = current_bytes.load(std::memory_order_relaxed);
+    result.peak_bytes = peak_bytes.load(std::memory_order_relaxed);
+    return result;
+}
+
+}  // namespace vecmem::details
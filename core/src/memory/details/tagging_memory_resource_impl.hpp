@@ -0,0 +1,106 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/tagging_memory_resource.hpp"
+
+// System include(s).
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Implementation of @c vecmem::tagging_memory_resource
+///
+/// The counters of the tags are held in blocks that are indexed by the tag
+/// identifiers assigned by @c vecmem::scoped_allocation_tag, and which are
+/// never moved or deleted while the resource exists. For host accessible
+/// upstream resources the counters that an allocation is accounted to are
+/// recorded in a small header in front of the allocation, so allocations and
+/// de-allocations only need to update some atomic counters. Allocations of
+/// other upstream resources are remembered in a (mutex protected) map.
+///
+class tagging_memory_resource_impl {
+
+public:
+    /// Constructor, on top of another memory resource
+    explicit tagging_memory_resource_impl(memory_resource& upstream);
+    /// Destructor
+    ~tagging_memory_resource_impl();
+
+    /// Allocate memory, accounting it to the current thread's tag
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    /// De-allocate memory, accounting it to the tag it was allocated with
+    void deallocate(void* ptr, std::size_t bytes, std::size_t alignment);
+
+    /// Get the statistics of all tags seen so far
+    std::vector<tagging_memory_resource::tag_statistics> statistics() const;
+    /// Get the statistics of all allocations, regardless of their tags
+    tagging_memory_resource::tag_statistics total_statistics() const;
+
+private:
+    /// Counters collected for a single tag
+    struct counters {
+        /// The number of allocations
+        std::atomic<std::size_t> n_allocations{0u};
+        /// The number of de-allocations
+        std::atomic<std::size_t> n_deallocations{0u};
+        /// The total number of bytes allocated
+        std::atomic<std::size_t> total_bytes{0u};
+        /// The number of bytes currently allocated
+        std::atomic<std::size_t> current_bytes{0u};
+        /// The largest number of bytes allocated at any time
+        std::atomic<std::size_t> peak_bytes{0u};
+
+        /// Account for an allocation
+        void allocated(std::size_t bytes);
+        /// Account for a de-allocation
+        void deallocated(std::size_t bytes);
+        /// Take a snapshot of the counters
+        tagging_memory_resource::tag_statistics snapshot(
+            const std::string& tag) const;
+    };
+
+    /// The number of tags in one block of counters
+    static constexpr std::size_t block_size = 64u;
+    /// The maximum number of counter blocks
+    static constexpr std::size_t max_blocks = 1024u;
+    /// A block of counters
+    using counters_block = std::array<counters, block_size>;
+
+    /// Find (or create) the counters of a tag
+    counters& find_counters(std::size_t tag_id);
+
+    /// The upstream memory resource
+    std::reference_wrapper<memory_resource> m_upstream;
+    /// Whether a header can be put in front of the upstream allocations
+    bool m_use_header;
+
+    /// The blocks of counters, indexed by the tag identifiers
+    std::array<std::atomic<counters_block*>, max_blocks> m_blocks{};
+    /// Mutex protecting the creation of counter blocks
+    std::mutex m_blocks_mutex;
+    /// Counters for all allocations, regardless of their tags
+    counters m_total;
+
+    /// Mutex protecting @c m_allocations
+    std::mutex m_allocations_mutex;
+    /// The counters of the live allocations, if headers can not be used
+    std::unordered_map<void*, counters*> m_allocations;
+
+};  // class tagging_memory_resource_impl
+
+}  // namespace vecmem::details
@@ -0,0 +1,22 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/get_memory_space.hpp"
+
+#include "vecmem/memory/details/memory_space_provider.hpp"
+
+namespace vecmem {
+
+memory_space get_memory_space(const memory_resource& resource) noexcept {
+
+    const auto* provider =
+        dynamic_cast<const details::memory_space_provider*>(&resource);
+    return ((provider != nullptr) ? provider->space() : memory_space::unknown);
+}
+
+}  // namespace vecmem
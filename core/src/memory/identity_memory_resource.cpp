@@ -9,6 +9,8 @@
 // Local include(s).
 #include "vecmem/memory/identity_memory_resource.hpp"
 
+#include "vecmem/memory/get_memory_space.hpp"
+
 namespace vecmem {
 
 identity_memory_resource::identity_memory_resource(memory_resource &upstream)
@@ -46,4 +48,9 @@ bool identity_memory_resource::do_is_equal(
     return o != nullptr && m_upstream.get().is_equal(o->m_upstream);
 }
 
+memory_space identity_memory_resource::do_space() const noexcept {
+
+    return get_memory_space(m_upstream.get());
+}
+
 }  // namespace vecmem
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -49,6 +49,12 @@ void instrumenting_memory_resource::add_pre_deallocate_hook(
     m_impl->add_pre_deallocate_hook(f);
 }
 
+void instrumenting_memory_resource::add_post_deallocate_hook(
+    std::function<void(void*, std::size_t, std::size_t)> f) {
+
+    m_impl->add_post_deallocate_hook(f);
+}
+
 VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(instrumenting_memory_resource)
 
 }  // namespace vecmem
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,7 @@
 
 #include "details/memory_resource_impl.hpp"
 #include "details/pool_memory_resource_impl.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
 
 namespace vecmem {
 
@@ -19,8 +20,52 @@ pool_memory_resource::options::options() = default;
 pool_memory_resource::pool_memory_resource(memory_resource& upstream,
                                            const options& opts)
     : m_impl(std::make_unique<details::pool_memory_resource_impl>(upstream,
-                                                                  opts)) {}
+                                                                  opts)),
+      m_space(get_memory_space(upstream)) {}
+
+std::size_t pool_memory_resource::do_ranges_revision() const noexcept {
+
+    assert(m_impl);
+    return m_impl->ranges_revision();
+}
+
+void pool_memory_resource::do_owned_ranges(std::vector<range>& ranges) const {
+
+    assert(m_impl);
+    m_impl->owned_ranges(ranges);
+}
+
+void pool_memory_resource::do_allocate_bulk(std::size_t n,
+                                            const std::size_t* sizes,
+                                            std::size_t alignment,
+                                            void** ptrs) {
+
+    assert(m_impl);
+    m_impl->allocate_bulk(n, sizes, alignment, ptrs);
+}
+
+void pool_memory_resource::do_deallocate_bulk(std::size_t n,
+                                              void* const* ptrs,
+                                              const std::size_t* sizes,
+                                              std::size_t alignment) {
+
+    assert(m_impl);
+    m_impl->deallocate_bulk(n, ptrs, sizes, alignment);
+}
+
+void pool_memory_resource::do_reserve_bulk(std::size_t n,
+                                           const std::size_t* sizes,
+                                           std::size_t alignment) {
+
+    assert(m_impl);
+    m_impl->reserve_bulk(n, sizes, alignment);
+}
 
 VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(pool_memory_resource)
 
+memory_space pool_memory_resource::do_space() const noexcept {
+
+    return m_space;
+}
+
 }  // namespace vecmem
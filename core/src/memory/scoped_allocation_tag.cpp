@@ -0,0 +1,137 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/scoped_allocation_tag.hpp"
+
+#include "details/allocation_tags.hpp"
+#include "vecmem/memory/tagging_memory_resource.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vecmem {
+namespace {
+
+/// The allocation tag active on the current thread
+thread_local const char* current_tag = nullptr;
+/// The identifier of the allocation tag active on the current thread
+thread_local std::size_t current_tag_id = details::untagged_allocation_id;
+
+/// Process-wide registry of the interned allocation tags
+struct tag_registry {
+    /// Mutex protecting the registry
+    std::mutex m_mutex;
+    /// The identifiers of the tags, by name
+    std::unordered_map<std::string, std::size_t> m_ids{
+        {tagging_memory_resource::untagged, details::untagged_allocation_id}};
+    /// The names of the tags, by identifier
+    std::vector<std::string> m_names{tagging_memory_resource::untagged};
+};  // struct tag_registry
+
+/// Get the tag registry
+///
+/// The registry is never destroyed, as allocations may be made/accounted
+/// during the destruction of other static objects.
+///
+tag_registry& registry() {
+
+    static tag_registry* result = new tag_registry();
+    return *result;
+}
+
+/// Entry of the thread-local cache of interned tags
+struct cached_tag {
+    /// The pointer that the tag was last seen with
+    const char* m_ptr = nullptr;
+    /// The name of the tag
+    std::string m_name;
+    /// The identifier of the tag
+    std::size_t m_id = details::untagged_allocation_id;
+};  // struct cached_tag
+
+/// Get the identifier of a tag, interning it if necessary
+std::size_t intern(const char* tag) {
+
+    if (tag == nullptr) {
+        return details::untagged_allocation_id;
+    }
+
+    // Guards are usually created with the same (literal) strings over and
+    // over, so look for the tag in a small thread-local cache first. The
+    // names are compared as well, in case the memory of a string was re-used
+    // for a different tag.
+    static constexpr std::size_t max_cache_size = 32u;
+    thread_local std::vector<cached_tag> cache;
+    for (const cached_tag& entry : cache) {
+        if ((entry.m_ptr == tag) && (entry.m_name == tag)) {
+            return entry.m_id;
+        }
+    }
+
+    // Look up / register the tag in the process-wide registry.
+    std::size_t id = details::untagged_allocation_id;
+    {
+        tag_registry& reg = registry();
+        const std::scoped_lock lock{reg.m_mutex};
+        auto [it, inserted] = reg.m_ids.emplace(tag, reg.m_names.size());
+        if (inserted) {
+            reg.m_names.push_back(it->first);
+        }
+        id = it->second;
+    }
+
+    // Remember it for the next time.
+    if (cache.size() >= max_cache_size) {
+        cache.clear();
+    }
+    cache.push_back({tag, tag, id});
+    return id;
+}
+
+}  // namespace
+
+scoped_allocation_tag::scoped_allocation_tag(const char* tag)
+    : m_previous(current_tag), m_previous_id(current_tag_id) {
+
+    current_tag_id = intern(tag);
+    current_tag = tag;
+}
+
+scoped_allocation_tag::~scoped_allocation_tag() {
+
+    current_tag = m_previous;
+    current_tag_id = m_previous_id;
+}
+
+const char* scoped_allocation_tag::current() {
+
+    return current_tag;
+}
+
+namespace details {
+
+std::size_t current_allocation_tag_id() {
+
+    return current_tag_id;
+}
+
+std::string allocation_tag_name(std::size_t id) {
+
+    tag_registry& reg = registry();
+    const std::scoped_lock lock{reg.m_mutex};
+    assert(id < reg.m_names.size());
+    return reg.m_names[id];
+}
+
+}  // namespace details
+}  // namespace vecmem
@@ -0,0 +1,34 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/scoped_default_resource.hpp"
+
+#include "details/default_resource_dispatcher.hpp"
+
+namespace vecmem {
+
+scoped_default_resource::scoped_default_resource(memory_resource& resource)
+    : m_previous(details::default_resource_dispatcher::override_resource) {
+
+    // Make sure that the dispatcher would be installed.
+    static_cast<void>(details::default_resource_dispatcher::instance());
+    // Set up the override.
+    details::default_resource_dispatcher::override_resource = &resource;
+}
+
+scoped_default_resource::~scoped_default_resource() {
+
+    details::default_resource_dispatcher::override_resource = m_previous;
+}
+
+memory_resource* scoped_default_resource::current() {
+
+    return details::default_resource_dispatcher::override_resource;
+}
+
+}  // namespace vecmem
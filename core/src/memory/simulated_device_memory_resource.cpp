@@ -0,0 +1,55 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+
+#include "details/memory_resource_impl.hpp"
+#include "details/simulated_device_memory_resource_impl.hpp"
+
+namespace vecmem {
+
+simulated_device_memory_resource::access_guard::access_guard(
+    const simulated_device_memory_resource& resource, const void* ptr,
+    std::size_t size)
+    : m_resource(resource), m_ptr(ptr), m_size(size) {
+
+    assert(m_resource.m_impl);
+    m_resource.m_impl->unprotect(m_ptr, m_size);
+}
+
+simulated_device_memory_resource::access_guard::~access_guard() {
+
+    assert(m_resource.m_impl);
+    m_resource.m_impl->protect(m_ptr, m_size);
+}
+
+simulated_device_memory_resource::simulated_device_memory_resource(
+    bool protect)
+    : m_impl{std::make_unique<details::simulated_device_memory_resource_impl>(
+          protect)} {}
+
+bool simulated_device_memory_resource::is_protected() const {
+
+    assert(m_impl);
+    return m_impl->is_protected();
+}
+
+bool simulated_device_memory_resource::owns(const void* ptr) const {
+
+    assert(m_impl);
+    return m_impl->owns(ptr);
+}
+
+VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(simulated_device_memory_resource)
+
+memory_space simulated_device_memory_resource::do_space() const noexcept {
+
+    return memory_space::device;
+}
+
+}  // namespace vecmem
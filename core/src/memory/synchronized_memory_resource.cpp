@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,8 @@
 // Local include(s).
 #include "vecmem/memory/synchronized_memory_resource.hpp"
 
+#include "vecmem/memory/bulk_allocation.hpp"
+
 namespace vecmem {
 
 synchronized_memory_resource::synchronized_memory_resource(
@@ -43,6 +45,34 @@ void synchronized_memory_resource::do_deallocate(void* p, std::size_t bytes,
     m_upstream.get().deallocate(p, bytes, alignment);
 }
 
+void synchronized_memory_resource::do_allocate_bulk(std::size_t n,
+                                                    const std::size_t* sizes,
+                                                    std::size_t alignment,
+                                                    void** ptrs) {
+
+    // Take the lock only once for all of the allocations.
+    const std::scoped_lock lock{m_mutex};
+    vecmem::allocate_bulk(m_upstream.get(), n, sizes, alignment, ptrs);
+}
+
+void synchronized_memory_resource::do_deallocate_bulk(std::size_t n,
+                                                      void* const* ptrs,
+                                                      const std::size_t* sizes,
+                                                      std::size_t alignment) {
+
+    // Take the lock only once for all of the de-allocations.
+    const std::scoped_lock lock{m_mutex};
+    vecmem::deallocate_bulk(m_upstream.get(), n, ptrs, sizes, alignment);
+}
+
+void synchronized_memory_resource::do_reserve_bulk(std::size_t n,
+                                                   const std::size_t* sizes,
+                                                   std::size_t alignment) {
+
+    const std::scoped_lock lock{m_mutex};
+    vecmem::reserve_bulk(m_upstream.get(), n, sizes, alignment);
+}
+
 bool synchronized_memory_resource::do_is_equal(
     const memory_resource& other) const noexcept {
 
@@ -0,0 +1,60 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/tagging_memory_resource.hpp"
+
+#include "details/memory_resource_impl.hpp"
+#include "details/tagging_memory_resource_impl.hpp"
+
+// System include(s).
+#include <iomanip>
+#include <ostream>
+
+namespace vecmem {
+
+tagging_memory_resource::tag_statistics::tag_statistics() = default;
+
+tagging_memory_resource::tagging_memory_resource(memory_resource& upstream)
+    : m_impl{std::make_unique<details::tagging_memory_resource_impl>(
+          upstream)} {}
+
+std::vector<tagging_memory_resource::tag_statistics>
+tagging_memory_resource::statistics() const {
+
+    assert(m_impl);
+    return m_impl->statistics();
+}
+
+void tagging_memory_resource::report(std::ostream& out) const {
+
+    assert(m_impl);
+
+    // Helper lambda printing one line of the report.
+    auto print = [&out](const tag_statistics& stat) {
+        out << std::left << std::setw(30) << stat.tag << std::right
+            << std::setw(12) << stat.n_allocations << std::setw(12)
+            << stat.n_deallocations << std::setw(16) << stat.total_bytes
+            << std::setw(16) << stat.current_bytes << std::setw(16)
+            << stat.peak_bytes << "\n";
+    };
+
+    // Print the report.
+    out << std::left << std::setw(30) << "Tag" << std::right << std::setw(12)
+        << "Allocs" << std::setw(12) << "Deallocs" << std::setw(16)
+        << "Total [B]" << std::setw(16) << "Current [B]" << std::setw(16)
+        << "Peak [B]" << "\n";
+    for (const tag_statistics& stat : m_impl->statistics()) {
+        print(stat);
+    }
+    print(m_impl->total_statistics());
+    out << std::flush;
+}
+
+VECMEM_MEMORY_RESOURCE_PIMPL_IMPL(tagging_memory_resource)
+
+}  // namespace vecmem
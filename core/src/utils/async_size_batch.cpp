@@ -0,0 +1,71 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/async_size_batch.hpp"
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem {
+
+async_size_batch::async_size_batch(storage_type&& sizes, event_type event)
+    : m_sizes{std::move(sizes)}, m_event{std::move(event)} {}
+
+auto async_size_batch::get(const size_batch::size_handle& handle) const
+    -> size_type {
+
+    // Wait for the event to complete before accessing the value
+    m_event->wait();
+    return unsafe_get(handle);
+}
+
+data::vector_view<const async_size_batch::size_type> async_size_batch::get(
+    const size_batch::sizes_handle& handle) const {
+
+    // Wait for the event to complete before accessing the values
+    m_event->wait();
+    return unsafe_get(handle);
+}
+
+auto async_size_batch::unsafe_get(const size_batch::size_handle& handle) const
+    -> size_type {
+
+    // Access the value assuming the event is complete
+    assert(m_event->is_ready());
+    assert(handle.m_offset < m_sizes.size());
+    m_event->ignore();
+    return m_sizes[handle.m_offset];
+}
+
+data::vector_view<const async_size_batch::size_type>
+async_size_batch::unsafe_get(const size_batch::sizes_handle& handle) const {
+
+    // Access the values assuming the event is complete
+    assert(m_event->is_ready());
+    assert(handle.m_offset + handle.m_count <= m_sizes.size());
+    m_event->ignore();
+    return {static_cast<size_type>(handle.m_count),
+            m_sizes.data() + handle.m_offset};
+}
+
+void async_size_batch::wait() {
+
+    m_event->wait();
+}
+
+bool async_size_batch::is_ready() const {
+
+    return m_event->is_ready();
+}
+
+void async_size_batch::ignore() {
+
+    m_event->ignore();
+}
+
+}  // namespace vecmem
@@ -0,0 +1,83 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/buffer_cache.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iterator>
+
+namespace vecmem {
+
+buffer_cache::buffer_cache(memory_resource& resource,
+                           memory_resource* host_access_resource)
+    : m_resource(resource), m_host_access_resource(host_access_resource) {}
+
+buffer_cache::~buffer_cache() = default;
+
+memory_resource& buffer_cache::resource() const {
+
+    return m_resource;
+}
+
+memory_resource* buffer_cache::host_access_resource() const {
+
+    return m_host_access_resource;
+}
+
+std::size_t buffer_cache::size() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void buffer_cache::clear() {
+
+    // Free the buffers outside of the lock.
+    std::vector<entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entries.swap(m_entries);
+    }
+}
+
+void buffer_cache::put(key&& k, std::unique_ptr<holder_base> buffer) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.push_back({std::move(k), std::move(buffer)});
+    VECMEM_DEBUG_MSG(3, "Cached a buffer, holding %lu buffers now",
+                     m_entries.size());
+}
+
+std::unique_ptr<buffer_cache::holder_base> buffer_cache::take_holder(
+    const key& k) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Look for the most recently released buffer of the requested shape.
+    auto itr = std::find_if(m_entries.rbegin(), m_entries.rend(),
+                            [&k](const entry& e) {
+                                return ((e.m_key.m_type == k.m_type) &&
+                                        (e.m_key.m_buffer_type ==
+                                         k.m_buffer_type) &&
+                                        (e.m_key.m_capacities ==
+                                         k.m_capacities));
+                            });
+    if (itr == m_entries.rend()) {
+        return nullptr;
+    }
+
+    // Remove it from the cache.
+    std::unique_ptr<holder_base> result = std::move(itr->m_buffer);
+    m_entries.erase(std::next(itr).base());
+    return result;
+}
+
+}  // namespace vecmem
@@ -9,12 +9,34 @@
 // VecMem include(s).
 #include "vecmem/utils/copy.hpp"
 
+#include "vecmem/utils/copy_observer.hpp"
 #include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/details/copy_scratch.hpp"
+
+// Local include(s).
+#include "details/block_pool.hpp"
 
 // System include(s).
+#include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
 namespace {
+
+/// Pool providing the memory for the no-op events
+///
+/// Since every copy operation creates an event, allocating them from the
+/// heap one by one would be quite wasteful. The pool is intentionally never
+/// destroyed, so that events outliving the static objects of the library
+/// could still be deleted safely.
+///
+vecmem::details::block_pool& event_pool();
+
 /// Empty/no-op implementation for @c vecmem::abstract_event
 struct noop_event final : public vecmem::abstract_event {
     void wait() override {
@@ -24,7 +46,67 @@ struct noop_event final : public vecmem::abstract_event {
     void ignore() override {
         // No-op
     }
+
+    /// Allocate the memory for an event from the event pool
+    static void* operator new([[maybe_unused]] std::size_t size) {
+        assert(size == sizeof(noop_event));
+        return event_pool().allocate();
+    }
+    /// Give the memory of an event back to the event pool
+    static void operator delete(void* ptr) { event_pool().deallocate(ptr); }
 };  // struct noop_event
+
+vecmem::details::block_pool& event_pool() {
+
+    static vecmem::details::block_pool* pool =
+        new vecmem::details::block_pool(sizeof(noop_event), 256u);
+    return *pool;
+}
+
+/// Event wrapper notifying an observer about the time spent waiting for it
+class observing_event final : public vecmem::abstract_event {
+
+public:
+    observing_event(std::unique_ptr<vecmem::abstract_event> event,
+                    vecmem::copy_observer& observer)
+        : m_event(std::move(event)), m_observer(observer) {}
+    /// Destructor, reporting the implicit wait of the wrapped event
+    ~observing_event() override {
+        if (m_pending) {
+            const auto start = std::chrono::steady_clock::now();
+            m_event.reset();
+            report(start);
+        }
+    }
+
+    void wait() override {
+        m_pending = false;
+        const auto start = std::chrono::steady_clock::now();
+        m_event->wait();
+        report(start);
+    }
+    bool is_ready() const override { return m_event->is_ready(); }
+    void ignore() override {
+        m_pending = false;
+        m_event->ignore();
+    }
+
+private:
+    /// Report a wait that started at a given time
+    void report(std::chrono::steady_clock::time_point start) {
+        m_observer.observe({vecmem::copy_observer::operation::wait,
+                            vecmem::copy::type::unknown, 0u, 0u,
+                            std::chrono::steady_clock::now() - start});
+    }
+
+    /// The wrapped event
+    std::unique_ptr<vecmem::abstract_event> m_event;
+    /// The observer to notify
+    vecmem::copy_observer& m_observer;
+    /// Whether the event was neither waited on, nor ignored yet
+    bool m_pending = true;
+};  // class observing_event
+
 }  // namespace
 
 namespace vecmem {
@@ -42,6 +124,22 @@ void copy::do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
                      size, from_ptr, to_ptr);
 }
 
+void copy::do_copy_batch(std::size_t n, const copy_region* regions,
+                         type::copy_type cptype) const {
+
+    // Copy the regions one by one.
+    for (std::size_t i = 0; i < n; ++i) {
+        do_copy(regions[i].m_size, regions[i].m_from, regions[i].m_to, cptype);
+    }
+}
+
+std::size_t copy::max_copy_padding() const {
+
+    // For host memory copies, copying a few hundred extra bytes costs about
+    // as much as the overhead of an additional memcpy call.
+    return 256u;
+}
+
 void copy::do_memset(std::size_t size, void* ptr, int value) const {
 
     // Perform the POSIX memory setting operation.
@@ -58,4 +156,352 @@ copy::event_type copy::create_event() const {
     return std::make_unique<noop_event>();
 }
 
+copy::event_type copy::operator()(const copy_plan& plan) const {
+
+    // Make sure that the plan can be executed.
+    if (plan.valid() == false) {
+        throw std::invalid_argument("Cannot execute an invalid copy plan");
+    }
+    const type::copy_type cptype =
+        static_cast<type::copy_type>(plan.m_copy_type);
+
+    // Read the sizes of all resizable sources with a single synchronization.
+    std::size_t n_sizes = 0u;
+    for (const copy_plan::dynamic_part& part : plan.m_dynamic) {
+        n_sizes += part.m_inner.size();
+    }
+    details::copy_scratch::lease<copy_plan::size_type> sizes_lease =
+        details::copy_scratch::sizes();
+    std::vector<copy_plan::size_type>& sizes = *sizes_lease;
+    sizes.resize(n_sizes, 0u);
+    if (n_sizes > 0u) {
+        std::size_t offset = 0u;
+        for (const copy_plan::dynamic_part& part : plan.m_dynamic) {
+            issue_copy(sizeof(copy_plan::size_type) *
+                           (part.m_inner.size() - part.m_first),
+                       part.m_from_sizes, sizes.data() + offset + part.m_first,
+                       type::unknown);
+            offset += part.m_inner.size();
+        }
+        issue_event()->wait();
+    }
+
+    // Make sure that the targets can hold the current sizes, before issuing
+    // any of the copies.
+    std::size_t offset = 0u;
+    for (const copy_plan::dynamic_part& part : plan.m_dynamic) {
+        for (std::size_t i = 0; i < part.m_inner.size(); ++i) {
+            if (part.m_to_capacities[i] < sizes[offset + i]) {
+                std::ostringstream msg;
+                msg << "Target capacity (" << part.m_to_capacities[i]
+                    << ") < source size (" << sizes[offset + i] << ")";
+                throw std::length_error(msg.str());
+            }
+        }
+        offset += part.m_inner.size();
+    }
+
+    // Perform the pre-computed copies.
+    if (plan.m_host_regions.empty() == false) {
+        issue_copy_batch(plan.m_host_regions.size(), plan.m_host_regions.data(),
+                         host_copy_type(cptype));
+    }
+    if (plan.m_regions.empty() == false) {
+        issue_copy_batch(plan.m_regions.size(), plan.m_regions.data(), cptype);
+    }
+    if (plan.m_dynamic.empty()) {
+        return issue_event();
+    }
+
+    // Perform the copies that depend on the sizes.
+    details::copy_staging::batch staged;
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    offset = 0u;
+    for (const copy_plan::dynamic_part& part : plan.m_dynamic) {
+        const std::size_t n = part.m_inner.size();
+        if (part.m_to_sizes != nullptr) {
+            issue_copy(sizeof(copy_plan::size_type) * n,
+                       m_staging->stage(staged, sizes.data() + offset, n),
+                       part.m_to_sizes, host_copy_type(cptype));
+        }
+        regions = part.m_inner;
+        for (std::size_t i = 0; i < n; ++i) {
+            regions[i].m_size = sizes[offset + i] * part.m_element_size;
+        }
+        copy_batch(regions, cptype, part.m_allow_padding);
+        offset += n;
+    }
+    return m_staging->attach(std::move(staged), issue_event());
+}
+
+async_size_batch copy::get_sizes(const size_batch& batch,
+                                 memory_resource& pinnedHostMr) const {
+
+    // If nothing needs to be read, just return the known sizes.
+    if (batch.m_sources.empty()) {
+        async_size_batch::storage_type sizes(batch.m_values.begin(),
+                                             batch.m_values.end(),
+                                             get_default_resource());
+        return {std::move(sizes), vecmem::copy::create_event()};
+    }
+
+    // Set up the result block in pinned host memory, with the already known
+    // sizes filled in.
+    async_size_batch::storage_type sizes(
+        batch.m_values.begin(), batch.m_values.end(), &pinnedHostMr);
+
+    // Gather all of the sizes into it with one batch of copies, which only
+    // needs to be synchronized once.
+    details::copy_scratch::lease<copy_region> regions_lease =
+        details::copy_scratch::regions();
+    std::vector<copy_region>& regions = *regions_lease;
+    regions.reserve(batch.m_sources.size());
+    for (const size_batch::source& source : batch.m_sources) {
+        regions.push_back({source.m_ptr, sizes.data() + source.m_offset,
+                           source.m_count * sizeof(size_batch::size_type)});
+    }
+    copy_batch(regions, type::unknown, false);
+    VECMEM_DEBUG_MSG(2, "Reading back %lu size(s) from %lu memory region(s)",
+                     sizes.size(), batch.m_sources.size());
+
+    // Return the appropriate "future" value.
+    return {std::move(sizes), issue_event()};
+}
+
+void copy::check_slice(const slice& range, std::size_t from_size,
+                       std::size_t to_capacity) {
+
+    // Make sure that the range is valid for the source.
+    if ((range.begin > range.end) || (range.end > from_size)) {
+        std::ostringstream msg;
+        msg << "Invalid source range [" << range.begin << ", " << range.end
+            << ") for size " << from_size;
+        throw std::out_of_range(msg.str());
+    }
+    // Make sure that the target is large enough.
+    if ((range.offset + (range.end - range.begin)) > to_capacity) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to_capacity << ") < offset ("
+            << range.offset << ") + range size (" << (range.end - range.begin)
+            << ")";
+        throw std::length_error(msg.str());
+    }
+}
+
+void copy::merge_copy_regions(std::vector<copy_region>& regions,
+                              std::size_t max_gap) {
+
+    // Merge the regions in place, keeping their order. Two regions are merged
+    // if they are at the same distance from each other in both the source and
+    // the destination memory.
+    std::size_t n_merged = 0u;
+    for (const copy_region& region : regions) {
+        // Skip empty regions.
+        if (region.m_size == 0u) {
+            continue;
+        }
+        // Check if the region can be appended to the previous one.
+        if (n_merged > 0u) {
+            copy_region& last = regions[n_merged - 1u];
+            const std::uintptr_t from_end =
+                reinterpret_cast<std::uintptr_t>(last.m_from) + last.m_size;
+            const std::uintptr_t to_end =
+                reinterpret_cast<std::uintptr_t>(last.m_to) + last.m_size;
+            const std::uintptr_t from_begin =
+                reinterpret_cast<std::uintptr_t>(region.m_from);
+            const std::uintptr_t to_begin =
+                reinterpret_cast<std::uintptr_t>(region.m_to);
+            if ((from_begin >= from_end) && (to_begin >= to_end) &&
+                ((from_begin - from_end) == (to_begin - to_end)) &&
+                ((from_begin - from_end) <= max_gap)) {
+                last.m_size += (from_begin - from_end) + region.m_size;
+                continue;
+            }
+        }
+        // If not, keep it as a separate region.
+        regions[n_merged++] = region;
+    }
+    VECMEM_DEBUG_MSG(4, "Merged %lu copy region(s) into %lu", regions.size(),
+                     n_merged);
+    regions.resize(n_merged);
+}
+
+copy::type::copy_type copy::deduce_copy_type(memory_space from,
+                                             memory_space to,
+                                             type::copy_type cptype) {
+
+    // Tell whether a memory space belongs to the "device side" of a copy.
+    // Shared memory can be used on either side of any copy.
+    auto matches = [](memory_space space, bool device) {
+        return ((space == memory_space::unknown) ||
+                (space == memory_space::shared) ||
+                ((space == memory_space::device) == device));
+    };
+
+    // Check explicitly specified copy types against the memory spaces.
+    if (cptype != type::unknown) {
+        const bool from_device = ((cptype == type::device_to_host) ||
+                                  (cptype == type::device_to_device));
+        const bool to_device =
+            ((cptype == type::host_to_device) ||
+             (cptype == type::device_to_device));
+        if ((!matches(from, from_device)) || (!matches(to, to_device))) {
+            VECMEM_DEBUG_MSG(1,
+                             "Copy type %i does not match the memory spaces "
+                             "of the copy (%i -> %i)",
+                             static_cast<int>(cptype), static_cast<int>(from),
+                             static_cast<int>(to));
+        }
+        return cptype;
+    }
+
+    // Without knowing both memory spaces, leave it to the runtime.
+    if ((from == memory_space::unknown) || (to == memory_space::unknown)) {
+        return type::unknown;
+    }
+
+    // Treat shared memory as device memory, to let the backends use their
+    // device aware copy functions on it.
+    const bool from_device = ((from == memory_space::device) ||
+                              (from == memory_space::shared));
+    const bool to_device =
+        ((to == memory_space::device) || (to == memory_space::shared));
+    if (from_device) {
+        return (to_device ? type::device_to_device : type::device_to_host);
+    }
+    return (to_device ? type::host_to_device : type::host_to_host);
+}
+
+bool copy::can_borrow(memory_space from, memory_space to,
+                      type::copy_type cptype) {
+
+    // Explicitly requested copies that involve a device can not be avoided.
+    if ((cptype != type::unknown) && (cptype != type::host_to_host)) {
+        return false;
+    }
+
+    // Memory spaces not known are taken to be host memory, if the user says
+    // that this is a host-to-host copy.
+    if (cptype == type::host_to_host) {
+        if (from == memory_space::unknown) {
+            from = memory_space::host;
+        }
+        if (to == memory_space::unknown) {
+            to = memory_space::host;
+        }
+    }
+
+    // Only host accessible memory is borrowed. And only if it is usable in
+    // all the ways that the target's memory would be.
+    return (is_host_accessible(from) && is_host_accessible(to) &&
+            ((from == to) || (to == memory_space::host)));
+}
+
+copy::type::copy_type copy::host_copy_type(type::copy_type cptype) {
+
+    // The source is always the host, so the question is just whether the
+    // target is the host, or a device.
+    switch (cptype) {
+        case type::host_to_device:
+        case type::device_to_device:
+            return type::host_to_device;
+        case type::device_to_host:
+        case type::host_to_host:
+            return type::host_to_host;
+        default:
+            return type::unknown;
+    }
+}
+
+void copy::copy_batch(std::vector<copy_region>& regions,
+                      type::copy_type cptype, bool allow_padding) const {
+
+    // Merge the regions, with the largest gap allowed for this copy.
+    merge_copy_regions(regions, (allow_padding ? max_copy_padding() : 0u));
+
+    // Perform the copy.
+    if (regions.empty() == false) {
+        issue_copy_batch(regions.size(), regions.data(), cptype);
+    }
+}
+
+copy_observer::~copy_observer() = default;
+
+void copy::set_observer(copy_observer* observer) {
+
+    m_observer = observer;
+}
+
+copy_observer* copy::observer() const {
+
+    return m_observer;
+}
+
+void copy::observed_copy(std::size_t size, const void* from_ptr,
+                         void* to_ptr, type::copy_type cptype) const {
+
+    assert(m_observer != nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    do_copy(size, from_ptr, to_ptr, cptype);
+    m_observer->observe({copy_observer::operation::copy, cptype, size, 1u,
+                         std::chrono::steady_clock::now() - start});
+}
+
+void copy::observed_copy_batch(std::size_t n, const copy_region* regions,
+                               type::copy_type cptype) const {
+
+    assert(m_observer != nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    do_copy_batch(n, regions, cptype);
+    const auto duration = std::chrono::steady_clock::now() - start;
+    std::size_t size = 0u;
+    for (std::size_t i = 0; i < n; ++i) {
+        size += regions[i].m_size;
+    }
+    m_observer->observe(
+        {copy_observer::operation::copy_batch, cptype, size, n, duration});
+}
+
+void copy::observed_memset(std::size_t size, void* ptr, int value) const {
+
+    assert(m_observer != nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    do_memset(size, ptr, value);
+    m_observer->observe({copy_observer::operation::memset, type::unknown,
+                         size, 1u, std::chrono::steady_clock::now() - start});
+}
+
+copy::event_type copy::observed_event() const {
+
+    assert(m_observer != nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    event_type result = create_event();
+    m_observer->observe({copy_observer::operation::event, type::unknown, 0u,
+                         0u, std::chrono::steady_clock::now() - start});
+    return std::make_unique<::observing_event>(std::move(result), *m_observer);
+}
+
+void copy::finalize_plan(copy_plan& plan) {
+
+    // Merge all the regions that happen to be next to each other. (Padding
+    // was already taken into account while planning the individual parts.)
+    merge_copy_regions(plan.m_regions, 0u);
+    merge_copy_regions(plan.m_host_regions, 0u);
+    plan.m_valid = true;
+    VECMEM_DEBUG_MSG(2,
+                     "Created a copy plan with %lu fixed copies and %lu "
+                     "dynamic part(s)",
+                     plan.n_fixed_copies(), plan.n_dynamic_parts());
+}
+
+void copy::wait_for_staged_operations() const {
+
+    // Moved-from objects don't have any staging memory.
+    if (m_staging) {
+        m_staging->wait_for_deferred();
+    }
+}
+
 }  // namespace vecmem
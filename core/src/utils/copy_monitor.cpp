@@ -0,0 +1,93 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/copy_monitor.hpp"
+
+// System include(s).
+#include <cassert>
+#include <climits>
+
+namespace vecmem {
+
+double copy_monitor::counters::throughput() const {
+
+    if (time.count() == 0) {
+        return 0.;
+    }
+    return static_cast<double>(n_bytes) /
+           std::chrono::duration<double>(time).count();
+}
+
+std::size_t copy_monitor::counters::n_calls_below(std::size_t size) const {
+
+    // Sum up the bins that are completely below the requested size.
+    std::size_t result = 0u;
+    if (size > 0u) {
+        result += histogram[0];
+    }
+    for (std::size_t i = 1u; i < n_bins; ++i) {
+        if ((i >= sizeof(std::size_t) * CHAR_BIT) ||
+            ((std::size_t{1} << i) > size)) {
+            break;
+        }
+        result += histogram[i];
+    }
+    return result;
+}
+
+std::size_t copy_monitor::bin(std::size_t size) {
+
+    // Find the position of the highest set bit.
+    std::size_t result = 0u;
+    while (size > 0u) {
+        ++result;
+        size >>= 1u;
+    }
+    assert(result < n_bins);
+    return result;
+}
+
+auto copy_monitor::get_statistics() const -> statistics {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void copy_monitor::reset() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics = {};
+}
+
+void copy_monitor::observe(const record& rec) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Events and waits are only counted.
+    if (rec.m_operation == operation::event) {
+        ++m_statistics.n_events;
+        m_statistics.event_time += rec.m_duration;
+        return;
+    }
+    if (rec.m_operation == operation::wait) {
+        ++m_statistics.n_waits;
+        m_statistics.wait_time += rec.m_duration;
+        return;
+    }
+
+    // Update the counters of the operation.
+    counters& c = ((rec.m_operation == operation::memset)
+                       ? m_statistics.memsets
+                       : m_statistics.copies[rec.m_type]);
+    ++c.n_calls;
+    c.n_bytes += rec.m_size;
+    c.time += rec.m_duration;
+    ++c.histogram[bin(rec.m_size)];
+}
+
+}  // namespace vecmem
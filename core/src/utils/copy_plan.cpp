@@ -0,0 +1,57 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/copy_plan.hpp"
+
+// System include(s).
+#include <cstring>
+
+namespace vecmem {
+
+copy_plan::copy_plan() = default;
+
+copy_plan::copy_plan(copy_plan&&) noexcept = default;
+
+copy_plan::~copy_plan() = default;
+
+copy_plan& copy_plan::operator=(copy_plan&&) noexcept = default;
+
+bool copy_plan::valid() const {
+
+    return m_valid;
+}
+
+void copy_plan::invalidate() {
+
+    m_valid = false;
+    m_regions.clear();
+    m_host_regions.clear();
+    m_dynamic.clear();
+    m_storage.clear();
+}
+
+std::size_t copy_plan::n_fixed_copies() const {
+
+    return m_regions.size() + m_host_regions.size();
+}
+
+std::size_t copy_plan::n_dynamic_parts() const {
+
+    return m_dynamic.size();
+}
+
+const void* copy_plan::store(const void* data, std::size_t size) {
+
+    // The memory blocks are allocated one by one, so that their addresses
+    // would remain stable while the plan is alive.
+    m_storage.push_back(std::make_unique<unsigned char[]>(size));
+    std::memcpy(m_storage.back().get(), data, size);
+    return m_storage.back().get();
+}
+
+}  // namespace vecmem
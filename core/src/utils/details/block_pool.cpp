@@ -0,0 +1,70 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "block_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+namespace vecmem::details {
+
+block_pool::block_pool(std::size_t block_size, std::size_t chunk_blocks)
+    : m_block_size(std::max(block_size, sizeof(node))),
+      m_chunk_blocks(std::max<std::size_t>(chunk_blocks, 1u)) {
+
+    // Round the block size up, so that every block would be suitably aligned
+    // for any type.
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+    m_block_size = ((m_block_size + alignment - 1u) / alignment) * alignment;
+
+    // Allocate the first chunk right away.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    add_chunk();
+}
+
+block_pool::~block_pool() = default;
+
+void* block_pool::allocate() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free == nullptr) {
+        add_chunk();
+    }
+    node* result = m_free;
+    m_free = m_free->m_next;
+    result->~node();
+    return result;
+}
+
+void block_pool::deallocate(void* ptr) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free = new (ptr) node{m_free};
+}
+
+void block_pool::add_chunk() {
+
+    // Allocate the memory. (Array new provides memory aligned for any type.)
+    m_chunks.push_back(
+        std::make_unique<unsigned char[]>(m_block_size * m_chunk_blocks));
+    unsigned char* chunk = m_chunks.back().get();
+
+    // Add all of its blocks to the free list.
+    for (std::size_t i = 0; i < m_chunk_blocks; ++i) {
+        m_free = new (chunk + i * m_block_size) node{m_free};
+    }
+    assert(m_free != nullptr);
+}
+
+}  // namespace vecmem::details
@@ -0,0 +1,72 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Thread safe pool of fixed sized memory blocks
+///
+/// Blocks are allocated from the heap in chunks, and are only given back to
+/// the system when the pool is destroyed. So once the pool has grown to
+/// the size needed by an application, allocating and de-allocating blocks
+/// does not involve the heap anymore.
+///
+class block_pool {
+
+public:
+    /// Constructor with the size of the blocks, and the size of the chunks
+    ///
+    /// @param block_size The size of the blocks to hand out
+    /// @param chunk_blocks The number of blocks to allocate in one go
+    ///
+    block_pool(std::size_t block_size, std::size_t chunk_blocks);
+    /// Disallow copying the pool
+    block_pool(const block_pool&) = delete;
+    /// Destructor
+    ~block_pool();
+
+    /// Disallow copying the pool
+    block_pool& operator=(const block_pool&) = delete;
+
+    /// Get a block from the pool
+    void* allocate();
+    /// Give a block back to the pool
+    void deallocate(void* ptr);
+
+private:
+    /// Node of the list of free blocks
+    struct node {
+        /// The next free block
+        node* m_next = nullptr;
+    };
+
+    /// Allocate a new chunk of blocks
+    ///
+    /// Must only be called while holding @c m_mutex.
+    ///
+    void add_chunk();
+
+    /// The size of the individual blocks
+    std::size_t m_block_size;
+    /// The number of blocks in one chunk
+    std::size_t m_chunk_blocks;
+    /// Mutex protecting the pool's state
+    std::mutex m_mutex;
+    /// The first free block
+    node* m_free = nullptr;
+    /// The chunks of memory owned by the pool
+    std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+
+};  // class block_pool
+
+}  // namespace vecmem::details
@@ -0,0 +1,179 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "continuation_runner.hpp"
+
+// VecMem include(s).
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+
+namespace vecmem::details {
+namespace {
+
+/// Flag showing whether the current thread is the thread of a runner
+thread_local bool runner_thread = false;
+
+}  // namespace
+
+continuation_runner::continuation_runner()
+    : m_thread([this]() { run(); }) {}
+
+continuation_runner::~continuation_runner() {
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_one();
+    m_thread.join();
+}
+
+continuation_runner& continuation_runner::instance() {
+
+    static continuation_runner runner;
+    return runner;
+}
+
+bool continuation_runner::is_runner_thread() noexcept {
+
+    return runner_thread;
+}
+
+void continuation_runner::submit(event_type event,
+                                 std::function<void()> callback,
+                                 std::shared_ptr<continuation_state> state) {
+
+    assert(event);
+    assert(state);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_incoming.push_back(
+            {std::move(event), std::move(callback), std::move(state)});
+    }
+    m_cv.notify_one();
+}
+
+void continuation_runner::execute(task& t) {
+
+    // Finish the event, and run the function.
+    std::exception_ptr error;
+    try {
+        t.m_event->wait();
+        t.m_event.reset();
+        if (t.m_callback) {
+            t.m_callback();
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // Signal the completion of the continuation.
+    {
+        std::lock_guard<std::mutex> lock(t.m_state->m_mutex);
+        t.m_state->m_done = true;
+        t.m_state->m_error = error;
+    }
+    t.m_state->m_cv.notify_all();
+}
+
+void continuation_runner::abandon(task& t) {
+
+    VECMEM_DEBUG_MSG(1, "Abandoning a continuation whose event did not "
+                        "complete before the runner was stopped");
+
+    // Stop tracking the event, and let anybody still waiting for the
+    // continuation know that it will never be executed.
+    t.m_event->ignore();
+    t.m_event.reset();
+    {
+        std::lock_guard<std::mutex> lock(t.m_state->m_mutex);
+        t.m_state->m_done = true;
+        t.m_state->m_error = std::make_exception_ptr(std::runtime_error(
+            "Continuation abandoned, as its event never completed"));
+    }
+    t.m_state->m_cv.notify_all();
+}
+
+void continuation_runner::run() {
+
+    // Let continuations know where they are being executed.
+    runner_thread = true;
+
+    // The tasks waiting for their events.
+    std::vector<task> pending;
+    // The time after which the remaining tasks are abandoned, once the
+    // runner is stopped.
+    std::chrono::steady_clock::time_point deadline;
+    bool draining = false;
+
+    while (true) {
+
+        // Pick up the new tasks.
+        bool stop = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (pending.empty() && (m_stop == false)) {
+                // Sleep until there is something to do.
+                m_cv.wait(lock,
+                          [this]() { return m_stop || !m_incoming.empty(); });
+            }
+            std::move(m_incoming.begin(), m_incoming.end(),
+                      std::back_inserter(pending));
+            m_incoming.clear();
+            if (m_stop && !draining) {
+                draining = true;
+                deadline = std::chrono::steady_clock::now() + drain_timeout;
+            }
+            stop = m_stop;
+        }
+
+        // Stop once all tasks were executed. (Keep polling the remaining ones
+        // until then, as they may depend on each other.)
+        if (stop && pending.empty()) {
+            return;
+        }
+
+        // Execute all tasks whose events completed.
+        const std::size_t n_pending = pending.size();
+        auto finished = std::stable_partition(
+            pending.begin(), pending.end(),
+            [](const task& t) { return (t.m_event->is_ready() == false); });
+        for (auto it = finished; it != pending.end(); ++it) {
+            execute(*it);
+        }
+        pending.erase(finished, pending.end());
+
+        // If nothing finished, wait a little before polling again. Waking up
+        // early if new tasks arrive.
+        if ((pending.empty() == false) && (pending.size() == n_pending)) {
+            if (stop) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    for (task& t : pending) {
+                        abandon(t);
+                    }
+                    pending.clear();
+                    continue;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait_for(lock, std::chrono::microseconds(50), [this]() {
+                return m_stop || !m_incoming.empty();
+            });
+        }
+    }
+}
+
+}  // namespace vecmem::details
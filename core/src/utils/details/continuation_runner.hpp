@@ -0,0 +1,113 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vecmem::details {
+
+/// State shared between a continuation, and the event tracking it
+struct continuation_state {
+
+    /// Mutex protecting the state
+    std::mutex m_mutex;
+    /// Condition variable signalling the completion of the continuation
+    std::condition_variable m_cv;
+    /// Flag showing whether the continuation finished
+    bool m_done = false;
+    /// Exception thrown by the continuation (if any)
+    std::exception_ptr m_error;
+
+};  // struct continuation_state
+
+/// Background thread executing host functions once their events complete
+///
+/// All pending events are polled in one go, with the thread sleeping for a
+/// short time when none of them completed. So the number of continuations
+/// waiting at the same time does not affect the number of threads used.
+///
+class continuation_runner {
+
+public:
+    /// Type of the events waited for
+    using event_type = std::unique_ptr<abstract_event>;
+
+    /// Default constructor
+    continuation_runner();
+    /// Disallow copying the runner
+    continuation_runner(const continuation_runner&) = delete;
+    /// Destructor, executing all remaining continuations
+    ///
+    /// Continuations whose events do not complete within
+    /// @c drain_timeout are abandoned, so that they could not block the
+    /// termination of the process.
+    ///
+    ~continuation_runner();
+
+    /// Disallow copying the runner
+    continuation_runner& operator=(const continuation_runner&) = delete;
+
+    /// Get the runner shared by the entire library
+    static continuation_runner& instance();
+    /// Check whether the current thread is the thread of a runner
+    static bool is_runner_thread() noexcept;
+
+    /// Execute a function once an event completes
+    ///
+    /// @param event The event to wait for
+    /// @param callback The function to execute
+    /// @param state The state to signal the completion of the function with
+    ///
+    void submit(event_type event, std::function<void()> callback,
+                std::shared_ptr<continuation_state> state);
+
+    /// Time given to the remaining continuations during destruction
+    static constexpr std::chrono::seconds drain_timeout{1};
+
+private:
+    /// A single continuation
+    struct task {
+        /// The event to wait for
+        event_type m_event;
+        /// The function to execute
+        std::function<void()> m_callback;
+        /// The state to signal completion with
+        std::shared_ptr<continuation_state> m_state;
+    };
+
+    /// Execute a task whose event completed
+    static void execute(task& t);
+    /// Give up on a task whose event did not complete
+    static void abandon(task& t);
+    /// The function executed by the background thread
+    void run();
+
+    /// Mutex protecting the runner's state
+    std::mutex m_mutex;
+    /// Condition variable signalling new tasks, or the stopping of the runner
+    std::condition_variable m_cv;
+    /// Tasks not yet picked up by the background thread
+    std::vector<task> m_incoming;
+    /// Flag telling the background thread to stop
+    bool m_stop = false;
+    /// The background thread
+    std::thread m_thread;
+
+};  // class continuation_runner
+
+}  // namespace vecmem::details
@@ -0,0 +1,29 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/details/copy_scratch.hpp"
+
+namespace vecmem::details {
+
+auto copy_scratch::sizes() -> lease<size_type> {
+
+    return lease<size_type>{local().m_sizes};
+}
+
+auto copy_scratch::regions() -> lease<copy_region> {
+
+    return lease<copy_region>{local().m_regions};
+}
+
+copy_scratch& copy_scratch::local() {
+
+    static thread_local copy_scratch scratch;
+    return scratch;
+}
+
+}  // namespace vecmem::details
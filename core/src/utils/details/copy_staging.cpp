@@ -0,0 +1,192 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/details/copy_staging.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+namespace vecmem::details {
+
+/// Event keeping a batch of staging blocks alive until its operation finishes
+struct staged_event : public abstract_event {
+
+    /// Constructor with all of the necessary ingredients
+    staged_event(copy_staging::event_type event, copy_staging::batch&& staged,
+                 std::shared_ptr<copy_staging> staging)
+        : m_event(std::move(event)),
+          m_staged(std::move(staged)),
+          m_staging(std::move(staging)) {
+
+        assert(m_event);
+        assert(m_staging);
+    }
+    /// Copy constructor
+    staged_event(const staged_event&) = delete;
+    /// Destructor
+    ~staged_event() override {
+        // Destroying the underlying event waits for it if needed, at which
+        // point the blocks can be recycled.
+        if (m_staging) {
+            m_event.reset();
+            m_staging->recycle(std::move(m_staged));
+        }
+    }
+
+    /// Copy assignment
+    staged_event& operator=(const staged_event&) = delete;
+
+    /// Wait for the underlying event, and recycle the blocks
+    void wait() override {
+        if (!m_staging) {
+            return;
+        }
+        m_event->wait();
+        m_staging->recycle(std::move(m_staged));
+        m_staging.reset();
+    }
+
+    /// Check the underlying event without blocking
+    bool is_ready() const override {
+        return ((!m_staging) || m_event->is_ready());
+    }
+
+    /// Stop tracking the underlying event
+    void ignore() override {
+        if (!m_staging) {
+            return;
+        }
+        if (m_event->is_ready()) {
+            m_event->ignore();
+            m_staging->recycle(std::move(m_staged));
+        } else {
+            m_staging->defer(std::move(m_event), std::move(m_staged));
+        }
+        m_staging.reset();
+    }
+
+    /// The event tracking the operation(s) using the blocks
+    copy_staging::event_type m_event;
+    /// The blocks used by the operation(s)
+    copy_staging::batch m_staged;
+    /// The object owning the blocks (if they are still in use)
+    std::shared_ptr<copy_staging> m_staging;
+
+};  // struct staged_event
+
+copy_staging::copy_staging() = default;
+
+copy_staging::~copy_staging() {
+
+    wait_for_deferred();
+}
+
+copy_staging::event_type copy_staging::attach(batch&& staged,
+                                              event_type event) {
+
+    // If nothing was staged, or the operation(s) already finished, there is
+    // nothing to keep alive.
+    if (staged.empty()) {
+        return event;
+    }
+    if (event->is_ready()) {
+        recycle(std::move(staged));
+        return event;
+    }
+
+    // Tie the lifetime of the blocks to the event.
+    return std::make_unique<staged_event>(std::move(event), std::move(staged),
+                                          shared_from_this());
+}
+
+void copy_staging::wait_for_deferred() {
+
+    // Take the deferred operations out of the object.
+    std::vector<std::pair<event_type, batch>> deferred;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        deferred.swap(m_deferred);
+    }
+
+    // Wait for all of them to finish.
+    for (auto& [event, staged] : deferred) {
+        event->wait();
+        recycle(std::move(staged));
+    }
+}
+
+const void* copy_staging::stage_bytes(batch& staged, const void* data,
+                                      std::size_t size) {
+
+    // Get a block, re-using a previously used one if possible. Do the same
+    // for the batch itself, if this is its first block.
+    block b;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        reap_deferred();
+        if (!m_free.empty()) {
+            b = std::move(m_free.back());
+            m_free.pop_back();
+        }
+        if ((staged.capacity() == 0u) && (!m_free_batches.empty())) {
+            staged = std::move(m_free_batches.back());
+            m_free_batches.pop_back();
+        }
+    }
+
+    // Copy the data into it. Note that a vector's buffer is not moved/copied
+    // when the vector itself is moved, so the returned pointer remains valid
+    // while the block is in the batch.
+    b.resize(size);
+    std::memcpy(b.data(), data, size);
+    staged.push_back(std::move(b));
+    VECMEM_DEBUG_MSG(5, "Staged %lu bytes at %p for a copy operation", size,
+                     static_cast<void*>(staged.back().data()));
+    return staged.back().data();
+}
+
+void copy_staging::recycle(batch&& staged) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::move(staged.begin(), staged.end(), std::back_inserter(m_free));
+    staged.clear();
+    if (staged.capacity() > 0u) {
+        m_free_batches.push_back(std::move(staged));
+    }
+}
+
+void copy_staging::defer(event_type event, batch&& staged) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_deferred.emplace_back(std::move(event), std::move(staged));
+}
+
+void copy_staging::reap_deferred() {
+
+    // Recycle the blocks of all deferred operations that finished already.
+    auto finished = std::partition(
+        m_deferred.begin(), m_deferred.end(),
+        [](const std::pair<event_type, batch>& d) {
+            return (!d.first->is_ready());
+        });
+    for (auto it = finished; it != m_deferred.end(); ++it) {
+        it->first->ignore();
+        std::move(it->second.begin(), it->second.end(),
+                  std::back_inserter(m_free));
+        it->second.clear();
+        m_free_batches.push_back(std::move(it->second));
+    }
+    m_deferred.erase(finished, m_deferred.end());
+}
+
+}  // namespace vecmem::details
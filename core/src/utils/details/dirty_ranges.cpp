@@ -0,0 +1,98 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/details/dirty_ranges.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+namespace vecmem::details {
+
+dirty_ranges::dirty_ranges(std::size_t size, std::size_t granularity)
+    : m_size(size), m_granularity(granularity) {
+
+    if (m_granularity == 0u) {
+        throw std::invalid_argument("The granularity must not be zero");
+    }
+}
+
+void dirty_ranges::add(std::size_t begin, std::size_t end) {
+
+    // Make sure that the range is valid.
+    if ((begin > end) || (end > m_size)) {
+        std::ostringstream msg;
+        msg << "Invalid range [" << begin << ", " << end << ") for size "
+            << m_size;
+        throw std::out_of_range(msg.str());
+    }
+    if (begin == end) {
+        return;
+    }
+
+    // Round the range outwards to the granularity.
+    begin -= (begin % m_granularity);
+    end = std::min(m_size, ((end + m_granularity - 1u) / m_granularity) *
+                               m_granularity);
+
+    // Find the ranges that the new one overlaps with, or touches.
+    auto first = std::lower_bound(
+        m_ranges.begin(), m_ranges.end(), begin,
+        [](const copy::slice& range, std::size_t value) {
+            return range.end < value;
+        });
+    auto last = std::upper_bound(
+        first, m_ranges.end(), end,
+        [](std::size_t value, const copy::slice& range) {
+            return value < range.begin;
+        });
+
+    // Merge them with the new range.
+    if (first != last) {
+        begin = std::min(begin, first->begin);
+        end = std::max(end, std::prev(last)->end);
+        first = m_ranges.erase(first, last);
+    }
+    m_ranges.insert(first, copy::slice{begin, end, begin});
+}
+
+void dirty_ranges::add_all() {
+
+    m_ranges.clear();
+    if (m_size > 0u) {
+        m_ranges.push_back({0u, m_size, 0u});
+    }
+}
+
+void dirty_ranges::clear() {
+
+    m_ranges.clear();
+}
+
+bool dirty_ranges::empty() const {
+
+    return m_ranges.empty();
+}
+
+std::size_t dirty_ranges::n_elements() const {
+
+    std::size_t result = 0u;
+    for (const copy::slice& range : m_ranges) {
+        result += range.end - range.begin;
+    }
+    return result;
+}
+
+const std::vector<copy::slice>& dirty_ranges::ranges() const {
+
+    return m_ranges;
+}
+
+}  // namespace vecmem::details
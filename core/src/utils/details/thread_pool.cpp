@@ -0,0 +1,127 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "thread_pool.hpp"
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem::details {
+
+thread_pool::thread_pool(std::size_t n_threads) {
+
+    // The calling thread always takes part in the execution of the tasks, so
+    // launch one fewer worker thread than requested.
+    if (n_threads > 1u) {
+        m_workers.reserve(n_threads - 1u);
+        for (std::size_t i = 0u; i < n_threads - 1u; ++i) {
+            m_workers.emplace_back([this]() { worker_loop(); });
+        }
+    }
+}
+
+thread_pool::~thread_pool() {
+
+    // Stop all worker threads.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_cv.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::size_t thread_pool::size() const {
+
+    return m_workers.size() + 1u;
+}
+
+bool thread_pool::try_parallel_for(std::size_t n_tasks,
+                                   const task_function& func) {
+
+    // Make sure that no other loop is running at the same time.
+    std::unique_lock<std::mutex> submit_lock(m_submit_mutex, std::try_to_lock);
+    if (!submit_lock.owns_lock()) {
+        return false;
+    }
+
+    // Publish the new loop for the worker threads.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_func = &func;
+        m_n_tasks = n_tasks;
+        m_n_done = 0u;
+        m_next.store(0u, std::memory_order_relaxed);
+        ++m_generation;
+    }
+    m_work_cv.notify_all();
+
+    // Take part in the execution of the tasks.
+    const std::size_t n_done = run_tasks(func, n_tasks);
+
+    // Wait for all tasks to finish.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_n_done += n_done;
+    m_done_cv.wait(lock, [this]() {
+        return (m_n_done == m_n_tasks) && (m_n_active == 0u);
+    });
+    m_func = nullptr;
+    return true;
+}
+
+std::size_t thread_pool::run_tasks(const task_function& func,
+                                   std::size_t n_tasks) {
+
+    std::size_t n_done = 0u;
+    for (std::size_t i = m_next.fetch_add(1u, std::memory_order_relaxed);
+         i < n_tasks; i = m_next.fetch_add(1u, std::memory_order_relaxed)) {
+        func(i);
+        ++n_done;
+    }
+    return n_done;
+}
+
+void thread_pool::worker_loop() {
+
+    std::size_t generation = 0u;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        // Wait for a new loop, or for the signal to stop.
+        m_work_cv.wait(lock, [this, &generation]() {
+            return m_stop || (m_generation != generation);
+        });
+        if (m_stop) {
+            return;
+        }
+        generation = m_generation;
+        if (m_func == nullptr) {
+            continue;
+        }
+
+        // Execute as many tasks as possible, without holding the lock.
+        const task_function& func = *m_func;
+        const std::size_t n_tasks = m_n_tasks;
+        ++m_n_active;
+        lock.unlock();
+        const std::size_t n_done = run_tasks(func, n_tasks);
+        lock.lock();
+
+        // Signal the submitting thread if all tasks finished, and no worker
+        // would look at the loop's state anymore.
+        m_n_done += n_done;
+        --m_n_active;
+        assert(m_n_done <= m_n_tasks);
+        if ((m_n_done == m_n_tasks) && (m_n_active == 0u)) {
+            m_done_cv.notify_one();
+        }
+    }
+}
+
+}  // namespace vecmem::details
@@ -0,0 +1,97 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vecmem::details {
+
+/// Simple, persistent pool of worker threads
+///
+/// The pool executes "parallel for" loops, with the calling thread taking
+/// part in the execution of the tasks. Only a single loop can be executed
+/// at any given time. Callers that find the pool busy are expected to do
+/// their work on their own thread instead.
+///
+class thread_pool {
+
+public:
+    /// Type of the function executed for every task index
+    using task_function = std::function<void(std::size_t)>;
+
+    /// Constructor with the number of threads to use
+    ///
+    /// @param n_threads The total number of threads to execute the tasks with,
+    ///                  including the calling thread
+    ///
+    explicit thread_pool(std::size_t n_threads);
+    /// Disallow copying the pool
+    thread_pool(const thread_pool&) = delete;
+    /// Destructor, stopping all worker threads
+    ~thread_pool();
+
+    /// Disallow copying the pool
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// The total number of threads executing tasks, including the caller
+    std::size_t size() const;
+
+    /// Execute @c func for all task indices in <tt>[0, n_tasks)</tt>
+    ///
+    /// The function only returns once all tasks finished. If the pool is
+    /// already busy executing another loop, the function does nothing, and
+    /// returns @c false.
+    ///
+    /// @param n_tasks The number of tasks to execute
+    /// @param func The function to execute for every task index
+    /// @return @c true if the tasks were executed, @c false otherwise
+    ///
+    bool try_parallel_for(std::size_t n_tasks, const task_function& func);
+
+private:
+    /// Execute tasks of the current loop, until there are none left
+    std::size_t run_tasks(const task_function& func, std::size_t n_tasks);
+    /// Function executed by the worker threads
+    void worker_loop();
+
+    /// Mutex making sure that only one loop would be executed at a time
+    std::mutex m_submit_mutex;
+    /// Mutex protecting the state of the current loop
+    std::mutex m_mutex;
+    /// Condition variable used for waking up the worker threads
+    std::condition_variable m_work_cv;
+    /// Condition variable used for signaling the end of a loop
+    std::condition_variable m_done_cv;
+
+    /// The function executed by the current loop
+    const task_function* m_func = nullptr;
+    /// The number of tasks in the current loop
+    std::size_t m_n_tasks = 0u;
+    /// The number of finished tasks in the current loop
+    std::size_t m_n_done = 0u;
+    /// The number of worker threads participating in the current loop
+    std::size_t m_n_active = 0u;
+    /// Index of the next task to execute in the current loop
+    std::atomic<std::size_t> m_next{0u};
+    /// Counter incremented for every new loop
+    std::size_t m_generation = 0u;
+    /// Flag telling the worker threads to stop
+    bool m_stop = false;
+
+    /// The worker threads
+    std::vector<std::thread> m_workers;
+
+};  // class thread_pool
+
+}  // namespace vecmem::details
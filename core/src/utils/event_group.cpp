@@ -0,0 +1,141 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/event_group.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <cassert>
+#include <stdexcept>
+#include <thread>
+
+namespace vecmem {
+
+event_group::event_group() = default;
+
+event_group::event_group(std::vector<event_type> events)
+    : m_events(std::move(events)) {
+
+    // Null events count as complete right away.
+    for (const event_type& event : m_events) {
+        if (!event) {
+            ++m_n_ready;
+        }
+    }
+}
+
+event_group::event_group(event_group&&) noexcept = default;
+
+event_group::~event_group() = default;
+
+event_group& event_group::operator=(event_group&&) noexcept = default;
+
+std::size_t event_group::add(event_type event) {
+
+    if (!event) {
+        ++m_n_ready;
+    }
+    m_events.push_back(std::move(event));
+    return m_events.size() - 1u;
+}
+
+std::size_t event_group::size() const {
+
+    return m_events.size();
+}
+
+std::size_t event_group::n_ready() const {
+
+    for (std::size_t i = m_first_pending; i < m_events.size(); ++i) {
+        poll(i);
+    }
+    return m_n_ready;
+}
+
+bool event_group::is_ready(std::size_t index) const {
+
+    assert(index < m_events.size());
+    return poll(index);
+}
+
+std::size_t event_group::wait_any() {
+
+    // Make sure that the call makes sense.
+    if (m_events.empty()) {
+        throw std::logic_error("Cannot wait for any event of an empty group");
+    }
+
+    // Keep polling the events until one of them is complete.
+    while (true) {
+        for (std::size_t i = 0; i < m_events.size(); ++i) {
+            if (poll(i)) {
+                return i;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void event_group::wait() {
+
+    // Wait for the events one by one.
+    for (std::size_t i = m_first_pending; i < m_events.size(); ++i) {
+        if (m_events[i]) {
+            m_events[i]->wait();
+            m_events[i].reset();
+            ++m_n_ready;
+        }
+    }
+    m_first_pending = m_events.size();
+    VECMEM_DEBUG_MSG(4, "Waited for a group of %lu event(s)", m_events.size());
+}
+
+bool event_group::is_ready() const {
+
+    // Poll the events in order, until the first incomplete one. Events before
+    // that one do not need to be looked at ever again.
+    while (m_first_pending < m_events.size()) {
+        if (poll(m_first_pending) == false) {
+            return false;
+        }
+        ++m_first_pending;
+    }
+    return true;
+}
+
+void event_group::ignore() {
+
+    for (event_type& event : m_events) {
+        if (event) {
+            event->ignore();
+            event.reset();
+            ++m_n_ready;
+        }
+    }
+    m_first_pending = m_events.size();
+}
+
+bool event_group::poll(std::size_t index) const {
+
+    // Events that were already seen to be complete, are not kept around.
+    event_type& event = m_events[index];
+    if (!event) {
+        return true;
+    }
+    if (event->is_ready() == false) {
+        return false;
+    }
+    // Release the completed event.
+    event->wait();
+    event.reset();
+    ++m_n_ready;
+    return true;
+}
+
+}  // namespace vecmem
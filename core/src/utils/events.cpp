@@ -0,0 +1,142 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/events.hpp"
+
+// Local include(s).
+#include "details/continuation_runner.hpp"
+
+// System include(s).
+#include <stdexcept>
+
+namespace {
+
+/// Event completing once any event of a group completes
+struct any_event final : public vecmem::abstract_event {
+
+    /// Constructor with the events to track
+    explicit any_event(vecmem::event_group&& group)
+        : m_group(std::move(group)) {}
+
+    /// Wait for the first event to complete
+    void wait() override {
+        if (m_group.size() > 0u) {
+            m_group.wait_any();
+        }
+    }
+    /// Check whether any of the events completed
+    bool is_ready() const override {
+        return ((m_group.size() == 0u) || (m_group.n_ready() > 0u));
+    }
+    /// Stop tracking all of the events
+    void ignore() override { m_group.ignore(); }
+
+    /// The tracked events
+    vecmem::event_group m_group;
+
+};  // struct any_event
+
+/// Event tracking the execution of a continuation
+struct continuation_event final : public vecmem::abstract_event {
+
+    /// Constructor with the state of the continuation
+    explicit continuation_event(
+        std::shared_ptr<vecmem::details::continuation_state> state)
+        : m_state(std::move(state)) {}
+    /// Copy constructor
+    continuation_event(const continuation_event&) = delete;
+    /// Destructor, waiting for the continuation (without re-throwing its
+    /// exception)
+    ///
+    /// When the event is dropped by another continuation, the continuation
+    /// could only run after the current one finished. So in that case it is
+    /// left to finish on its own, just like with @c ignore().
+    ///
+    ~continuation_event() override {
+        if (m_state &&
+            !vecmem::details::continuation_runner::is_runner_thread()) {
+            std::unique_lock<std::mutex> lock(m_state->m_mutex);
+            m_state->m_cv.wait(lock, [this]() { return m_state->m_done; });
+        }
+    }
+
+    /// Copy assignment
+    continuation_event& operator=(const continuation_event&) = delete;
+
+    /// Wait for the continuation to finish
+    void wait() override {
+        if (!m_state) {
+            return;
+        }
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(m_state->m_mutex);
+            // Continuations are executed one by one, so waiting for an
+            // unfinished one from inside of another would never return.
+            if ((m_state->m_done == false) &&
+                vecmem::details::continuation_runner::is_runner_thread()) {
+                throw std::logic_error(
+                    "Waiting for an unfinished continuation from inside of "
+                    "a continuation");
+            }
+            m_state->m_cv.wait(lock, [this]() { return m_state->m_done; });
+            error = m_state->m_error;
+        }
+        m_state.reset();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    /// Check whether the continuation finished
+    bool is_ready() const override {
+        if (!m_state) {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        return m_state->m_done;
+    }
+    /// Stop tracking the continuation
+    void ignore() override { m_state.reset(); }
+
+    /// The state of the continuation
+    std::shared_ptr<vecmem::details::continuation_state> m_state;
+
+};  // struct continuation_event
+
+}  // namespace
+
+namespace vecmem {
+
+std::unique_ptr<abstract_event> when_all(
+    std::vector<std::unique_ptr<abstract_event>> events) {
+
+    return std::make_unique<event_group>(std::move(events));
+}
+
+std::unique_ptr<abstract_event> when_any(
+    std::vector<std::unique_ptr<abstract_event>> events) {
+
+    return std::make_unique<any_event>(event_group{std::move(events)});
+}
+
+std::unique_ptr<abstract_event> then(std::unique_ptr<abstract_event> event,
+                                     std::function<void()> callback) {
+
+    // Null events are treated as complete ones.
+    auto state = std::make_shared<details::continuation_state>();
+    if (!event) {
+        event = when_all();
+    }
+
+    // Hand the continuation to the background thread.
+    details::continuation_runner::instance().submit(
+        std::move(event), std::move(callback), state);
+    return std::make_unique<continuation_event>(std::move(state));
+}
+
+}  // namespace vecmem
@@ -0,0 +1,314 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/host/async_copy.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/// Description of a single enqueued memory operation
+struct operation {
+    /// The possible operation types
+    enum class kind { copy, memset };
+    /// The type of the operation
+    kind m_kind = kind::copy;
+    /// The number of bytes to process
+    std::size_t m_size = 0u;
+    /// The source of a memory copy
+    const void* m_from = nullptr;
+    /// The destination of the operation
+    void* m_to = nullptr;
+    /// The value to set the destination's bytes to in a memory fill
+    int m_value = 0;
+};  // struct operation
+
+/// In-order queue of memory operations, executed by a worker thread
+class operation_queue {
+
+public:
+    /// Type used to identify enqueued operations
+    using ticket = std::uint64_t;
+
+    /// Default constructor, launching the worker thread
+    operation_queue() : m_thread([this]() { worker_loop(); }) {}
+    /// Destructor, finishing all enqueued operations
+    ~operation_queue() { shutdown(); }
+
+    /// Enqueue a new operation
+    ticket submit(const operation& op) {
+        ticket result = 0u;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_operations.push_back(op);
+            result = m_submitted.load() + 1u;
+            m_submitted.store(result);
+        }
+        m_work_cv.notify_one();
+        return result;
+    }
+
+    /// Get the ticket of the last enqueued operation
+    ticket last_ticket() const { return m_submitted.load(); }
+
+    /// Check whether all operations up to (and including) a ticket finished
+    bool is_done(ticket t) const { return m_completed.load() >= t; }
+
+    /// Wait for all operations up to (and including) a ticket to finish
+    void wait(ticket t) const {
+        if (is_done(t)) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this, t]() { return is_done(t); });
+    }
+
+    /// Finish all enqueued operations, and stop the worker thread
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stop) {
+                return;
+            }
+            m_stop = true;
+        }
+        m_work_cv.notify_one();
+        m_thread.join();
+    }
+
+private:
+    /// Function executed by the worker thread
+    void worker_loop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_work_cv.wait(lock, [this]() {
+                return m_stop || (!m_operations.empty());
+            });
+            if (m_operations.empty()) {
+                // This can only happen if the queue is being stopped.
+                return;
+            }
+            const operation op = m_operations.front();
+            m_operations.pop_front();
+            lock.unlock();
+            execute(op);
+            lock.lock();
+            m_completed.fetch_add(1u);
+            m_done_cv.notify_all();
+        }
+    }
+
+    /// Execute a single memory operation
+    static void execute(const operation& op) {
+        switch (op.m_kind) {
+            case operation::kind::copy:
+                ::memcpy(op.m_to, op.m_from, op.m_size);
+                VECMEM_DEBUG_MSG(3,
+                                 "Performed asynchronous memory copy of %lu "
+                                 "bytes from %p to %p",
+                                 op.m_size, op.m_from, op.m_to);
+                break;
+            case operation::kind::memset:
+                ::memset(op.m_to, op.m_value, op.m_size);
+                VECMEM_DEBUG_MSG(3,
+                                 "Asynchronously set %lu bytes to %i at %p",
+                                 op.m_size, op.m_value, op.m_to);
+                break;
+        }
+    }
+
+    /// Mutex protecting the queue
+    mutable std::mutex m_mutex;
+    /// Condition variable used to wake up the worker thread
+    std::condition_variable m_work_cv;
+    /// Condition variable used to signal finished operations
+    mutable std::condition_variable m_done_cv;
+    /// The operations waiting to be executed
+    std::deque<operation> m_operations;
+    /// The number of submitted operations
+    ///
+    /// Only modified while holding the mutex, but may be read without it.
+    ///
+    std::atomic<ticket> m_submitted{0u};
+    /// The number of finished operations
+    std::atomic<ticket> m_completed{0u};
+    /// Flag telling the worker thread to stop
+    bool m_stop = false;
+    /// The worker thread
+    std::thread m_thread;
+
+};  // class operation_queue
+
+/// Event tracking the completion of operations in an @c operation_queue
+struct host_event : public vecmem::abstract_event {
+
+    /// Constructor with the queue and the ticket to wait for
+    host_event(std::shared_ptr<const operation_queue> queue,
+               operation_queue::ticket t)
+        : m_queue(std::move(queue)), m_ticket(t) {}
+    /// Copy constructor
+    host_event(const host_event&) = delete;
+    /// Destructor
+    ~host_event() override {
+        // Check if the user forgot to wait on this asynchronous event.
+        if (m_queue) {
+            // If so, wait implicitly now.
+            VECMEM_DEBUG_MSG(1, "Asynchronous host event was not waited on!");
+            host_event::wait();
+#ifdef VECMEM_FAIL_ON_ASYNC_ERRORS
+            // If the user wants to fail on asynchronous errors, do so now.
+            std::terminate();
+#endif  // VECMEM_FAIL_ON_ASYNC_ERRORS
+        }
+    }
+
+    /// Copy assignment
+    host_event& operator=(const host_event&) = delete;
+
+    /// Wait for all operations tracked by the event to finish
+    void wait() override {
+        if (!m_queue) {
+            return;
+        }
+        m_queue->wait(m_ticket);
+        host_event::ignore();
+    }
+
+    /// Check whether all operations tracked by the event finished
+    bool is_ready() const override {
+        if (!m_queue) {
+            return true;
+        }
+        return m_queue->is_done(m_ticket);
+    }
+
+    /// Stop tracking the operations
+    void ignore() override { m_queue.reset(); }
+
+    /// The queue that the operations were enqueued into
+    std::shared_ptr<const operation_queue> m_queue;
+    /// The ticket of the last tracked operation
+    operation_queue::ticket m_ticket;
+
+};  // struct host_event
+
+}  // namespace
+
+namespace vecmem::host {
+
+struct async_copy::impl {
+
+    /// The queue that the operations are executed by
+    ///
+    /// It is shared with the events created by the object, so that they
+    /// would remain valid even after the copy object was destroyed.
+    ///
+    std::shared_ptr<operation_queue> m_queue =
+        std::make_shared<operation_queue>();
+
+};  // struct async_copy::impl
+
+async_copy::async_copy() : m_impl{std::make_unique<impl>()} {}
+
+async_copy::async_copy(async_copy&&) noexcept = default;
+
+async_copy::~async_copy() noexcept {
+
+    // Finish all outstanding operations, and stop the worker thread. Events
+    // that are still alive can just check the finished operation count.
+    if (m_impl) {
+        m_impl->m_queue->shutdown();
+    }
+}
+
+async_copy& async_copy::operator=(async_copy&& rhs) noexcept {
+
+    if (this != &rhs) {
+        if (m_impl) {
+            m_impl->m_queue->shutdown();
+        }
+        m_impl = std::move(rhs.m_impl);
+    }
+    return *this;
+}
+
+void async_copy::synchronize() const {
+
+    assert(m_impl);
+    m_impl->m_queue->wait(m_impl->m_queue->last_ticket());
+}
+
+void async_copy::do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
+                         type::copy_type) const {
+
+    // Check if anything needs to be done.
+    if (size == 0) {
+        VECMEM_DEBUG_MSG(5, "Skipping unnecessary memory copy");
+        return;
+    }
+
+    // Some sanity checks.
+    assert(m_impl);
+    assert(from_ptr != nullptr);
+    assert(to_ptr != nullptr);
+
+    // Enqueue the copy.
+    m_impl->m_queue->submit(
+        {operation::kind::copy, size, from_ptr, to_ptr, 0});
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(1,
+                     "Initiated asynchronous host memory copy of %lu bytes "
+                     "from %p to %p",
+                     size, from_ptr, to_ptr);
+}
+
+void async_copy::do_memset(std::size_t size, void* ptr, int value) const {
+
+    // Check if anything needs to be done.
+    if (size == 0) {
+        VECMEM_DEBUG_MSG(5, "Skipping unnecessary memory filling");
+        return;
+    }
+
+    // Some sanity checks.
+    assert(m_impl);
+    assert(ptr != nullptr);
+
+    // Enqueue the operation.
+    m_impl->m_queue->submit(
+        {operation::kind::memset, size, nullptr, ptr, value});
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(
+        2, "Initiated setting %lu bytes to %i at %p asynchronously on the host",
+        size, value, ptr);
+}
+
+async_copy::event_type async_copy::create_event() const {
+
+    // Create an event tracking all operations enqueued so far.
+    assert(m_impl);
+    return std::make_unique<host_event>(m_impl->m_queue,
+                                        m_impl->m_queue->last_ticket());
+}
+
+}  // namespace vecmem::host
@@ -0,0 +1,161 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/host/parallel_copy.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// Local include(s).
+#include "../details/thread_pool.hpp"
+#include "../integer_math.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+namespace vecmem::host {
+namespace {
+
+/// Get the number of threads to use, based on the user's options
+std::size_t thread_count(const parallel_copy::options& opts) {
+
+    if (!vecmem::details::is_power_of_2(opts.chunk_alignment)) {
+        throw std::invalid_argument(
+            "The chunk alignment must be a power of 2");
+    }
+    if (opts.n_threads != 0u) {
+        return opts.n_threads;
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+}  // namespace
+
+struct parallel_copy::impl {
+
+    /// Constructor from the user's options
+    explicit impl(const options& opts)
+        : m_options(opts), m_pool(thread_count(opts)) {}
+
+    /// Split a memory block into chunks, and process them in parallel
+    ///
+    /// @param size The size of the memory block
+    /// @param ptr The (destination) memory block to split up
+    /// @param func The function to process a single chunk with
+    /// @return @c true if the operation was performed, @c false otherwise
+    ///
+    template <typename FUNC>
+    bool process(std::size_t size, void* ptr, FUNC&& func) {
+
+        // Decide how many chunks to use.
+        if ((size < m_options.threshold) || (m_pool.size() < 2u)) {
+            return false;
+        }
+        const std::size_t alignment = m_options.chunk_alignment;
+        const std::size_t n_chunks = std::min(
+            m_pool.size(), std::max<std::size_t>(size / alignment, 1u));
+        if (n_chunks < 2u) {
+            return false;
+        }
+        const std::size_t chunk_size = size / n_chunks;
+
+        // Function calculating the (destination-aligned) chunk boundaries.
+        const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(ptr);
+        auto boundary = [&](std::size_t i) -> std::size_t {
+            if (i == 0u) {
+                return 0u;
+            }
+            if (i >= n_chunks) {
+                return size;
+            }
+            const std::uintptr_t aligned =
+                (begin + i * chunk_size + alignment - 1u) &
+                ~(static_cast<std::uintptr_t>(alignment) - 1u);
+            return std::min(size, static_cast<std::size_t>(aligned - begin));
+        };
+
+        // Process the chunks in parallel.
+        return m_pool.try_parallel_for(n_chunks, [&](std::size_t i) {
+            const std::size_t chunk_begin = boundary(i);
+            const std::size_t chunk_end = boundary(i + 1u);
+            assert(chunk_begin <= chunk_end);
+            if (chunk_end > chunk_begin) {
+                func(chunk_begin, chunk_end - chunk_begin);
+            }
+        });
+    }
+
+    /// The options used by the object
+    options m_options;
+    /// The thread pool to execute large operations with
+    vecmem::details::thread_pool m_pool;
+
+};  // struct parallel_copy::impl
+
+parallel_copy::options::options() = default;
+
+parallel_copy::parallel_copy(const options& opts)
+    : m_impl{std::make_unique<impl>(opts)} {}
+
+parallel_copy::parallel_copy(parallel_copy&&) noexcept = default;
+
+parallel_copy::~parallel_copy() noexcept = default;
+
+parallel_copy& parallel_copy::operator=(parallel_copy&&) noexcept = default;
+
+std::size_t parallel_copy::n_threads() const {
+
+    assert(m_impl);
+    return m_impl->m_pool.size();
+}
+
+void parallel_copy::do_copy(std::size_t size, const void* from_ptr,
+                            void* to_ptr, type::copy_type cptype) const {
+
+    // Try to perform the copy in parallel.
+    assert(m_impl);
+    const char* from = static_cast<const char*>(from_ptr);
+    char* to = static_cast<char*>(to_ptr);
+    if (m_impl->process(size, to_ptr,
+                        [from, to](std::size_t offset, std::size_t bytes) {
+                            ::memcpy(to + offset, from + offset, bytes);
+                        })) {
+        VECMEM_DEBUG_MSG(1,
+                         "Performed parallel memory copy of %lu bytes from "
+                         "%p to %p",
+                         size, from_ptr, to_ptr);
+        return;
+    }
+
+    // Fall back to the single-threaded implementation.
+    vecmem::copy::do_copy(size, from_ptr, to_ptr, cptype);
+}
+
+void parallel_copy::do_memset(std::size_t size, void* ptr, int value) const {
+
+    // Try to perform the operation in parallel.
+    assert(m_impl);
+    char* data = static_cast<char*>(ptr);
+    if (m_impl->process(size, ptr,
+                        [data, value](std::size_t offset, std::size_t bytes) {
+                            ::memset(data + offset, value, bytes);
+                        })) {
+        VECMEM_DEBUG_MSG(2, "Set %lu bytes to %i at %p with parallel memset",
+                         size, value, ptr);
+        return;
+    }
+
+    // Fall back to the single-threaded implementation.
+    vecmem::copy::do_memset(size, ptr, value);
+}
+
+}  // namespace vecmem::host
@@ -0,0 +1,186 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/simulated_device_copy.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace vecmem {
+
+/// Internal data for @c vecmem::simulated_device_copy
+///
+/// It is shared with the events created by the copy object, so that those
+/// could record synchronizations even after the copy object is gone.
+///
+struct simulated_device_copy::impl {
+
+    /// Constructor with the resource and the cost model
+    impl(const simulated_device_memory_resource& resource,
+         const cost_model& model)
+        : m_resource(resource), m_model(model) {}
+
+    /// The simulated device memory resource
+    const simulated_device_memory_resource& m_resource;
+    /// The cost model of the memory transfers
+    cost_model m_model;
+    /// The statistics collected so far
+    statistics m_statistics;
+    /// Mutex protecting the statistics
+    std::mutex m_mutex;
+
+    /// Event counting the synchronizations made with it
+    class event final : public abstract_event {
+
+    public:
+        /// Constructor with the internal data of the copy object
+        explicit event(std::shared_ptr<impl> data) : m_data(std::move(data)) {}
+
+        void wait() override {
+            assert(m_data);
+            std::lock_guard<std::mutex> lock(m_data->m_mutex);
+            ++(m_data->m_statistics.n_synchronizations);
+        }
+        bool is_ready() const override { return true; }
+        void ignore() override {}
+
+    private:
+        /// The internal data of the copy object
+        std::shared_ptr<impl> m_data;
+
+    };  // class event
+
+};  // struct simulated_device_copy::impl
+
+std::chrono::nanoseconds simulated_device_copy::statistics::total_time()
+    const {
+
+    std::chrono::nanoseconds result{0};
+    for (const transfer_statistics& stats : copies) {
+        result += stats.time;
+    }
+    return result;
+}
+
+simulated_device_copy::simulated_device_copy(
+    const simulated_device_memory_resource& resource)
+    : simulated_device_copy(resource, cost_model{}) {}
+
+simulated_device_copy::simulated_device_copy(
+    const simulated_device_memory_resource& resource, const cost_model& model)
+    : m_impl{std::make_shared<impl>(resource, model)} {}
+
+simulated_device_copy::simulated_device_copy(simulated_device_copy&&) noexcept =
+    default;
+
+simulated_device_copy::~simulated_device_copy() = default;
+
+simulated_device_copy& simulated_device_copy::operator=(
+    simulated_device_copy&&) noexcept = default;
+
+auto simulated_device_copy::get_statistics() const -> statistics {
+
+    assert(m_impl);
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_statistics;
+}
+
+void simulated_device_copy::reset_statistics() {
+
+    assert(m_impl);
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    m_impl->m_statistics = {};
+}
+
+void simulated_device_copy::do_copy(std::size_t size, const void* from_ptr,
+                                    void* to_ptr,
+                                    type::copy_type cptype) const {
+
+    assert(m_impl);
+    const simulated_device_memory_resource& resource = m_impl->m_resource;
+
+    // Determine the real direction of the copy.
+    const bool from_device = resource.owns(from_ptr);
+    const bool to_device = resource.owns(to_ptr);
+    const type::copy_type direction =
+        (from_device ? (to_device ? type::device_to_device
+                                  : type::device_to_host)
+                     : (to_device ? type::host_to_device
+                                  : type::host_to_host));
+
+    // Perform the copy, with the device memory made accessible.
+    {
+        simulated_device_memory_resource::access_guard from_guard(
+            resource, from_ptr, size);
+        simulated_device_memory_resource::access_guard to_guard(resource,
+                                                                to_ptr, size);
+        ::memmove(to_ptr, from_ptr, size);
+    }
+
+    // Calculate its simulated cost.
+    const link_model& link = m_impl->m_model.links[direction];
+    std::chrono::nanoseconds cost = link.latency;
+    if (link.bandwidth > 0.) {
+        cost += std::chrono::nanoseconds(static_cast<std::int64_t>(
+            1e9 * static_cast<double>(size) / link.bandwidth));
+    }
+
+    // Record it.
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        transfer_statistics& stats = m_impl->m_statistics.copies[direction];
+        ++(stats.n_copies);
+        stats.n_bytes += size;
+        stats.time += cost;
+        if ((cptype != type::unknown) && (cptype != direction)) {
+            ++(m_impl->m_statistics.n_mislabeled);
+        }
+    }
+    VECMEM_DEBUG_MSG(2,
+                     "Performed simulated memory copy of %lu bytes from %p "
+                     "to %p (type: %i, requested type: %i)",
+                     size, from_ptr, to_ptr, static_cast<int>(direction),
+                     static_cast<int>(cptype));
+
+    // Spend the simulated time, if requested.
+    if (m_impl->m_model.sleep && (cost.count() > 0)) {
+        std::this_thread::sleep_for(cost);
+    }
+}
+
+void simulated_device_copy::do_memset(std::size_t size, void* ptr,
+                                      int value) const {
+
+    assert(m_impl);
+
+    // Perform the operation, with the device memory made accessible.
+    {
+        simulated_device_memory_resource::access_guard guard(
+            m_impl->m_resource, ptr, size);
+        ::memset(ptr, value, size);
+    }
+
+    // Record it.
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    ++(m_impl->m_statistics.n_memsets);
+    m_impl->m_statistics.n_memset_bytes += size;
+}
+
+copy::event_type simulated_device_copy::create_event() const {
+
+    return std::make_unique<impl::event>(m_impl);
+}
+
+}  // namespace vecmem
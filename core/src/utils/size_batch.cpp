@@ -0,0 +1,54 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/size_batch.hpp"
+
+namespace vecmem {
+
+size_batch::size_batch() = default;
+
+std::size_t size_batch::size() const {
+
+    return m_values.size();
+}
+
+std::size_t size_batch::n_sources() const {
+
+    return m_sources.size();
+}
+
+void size_batch::clear() {
+
+    m_values.clear();
+    m_sources.clear();
+}
+
+std::size_t size_batch::reserve(std::size_t count) {
+
+    const std::size_t offset = m_values.size();
+    m_values.resize(offset + count, 0u);
+    return offset;
+}
+
+void size_batch::read(const size_type* ptr, std::size_t offset,
+                      std::size_t count) {
+
+    // Extend the previous region if the sizes happen to follow it directly
+    // in both memory and the batch.
+    if (m_sources.empty() == false) {
+        source& last = m_sources.back();
+        if ((last.m_ptr + last.m_count == ptr) &&
+            (last.m_offset + last.m_count == offset)) {
+            last.m_count += count;
+            return;
+        }
+    }
+    m_sources.push_back({ptr, offset, count});
+}
+
+}  // namespace vecmem
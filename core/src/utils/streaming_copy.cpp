@@ -0,0 +1,41 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/streaming_copy.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+
+namespace vecmem {
+
+streaming_copy::options::options() = default;
+
+streaming_copy::streaming_copy(const copy& cp, memory_resource& staging_mr,
+                               const options& opts)
+    : m_copy(cp), m_resource(staging_mr), m_options(opts) {
+
+    // Make sure that the options make sense.
+    if (m_options.chunk_size == 0u) {
+        throw std::invalid_argument("The chunk size must not be zero");
+    }
+    if (m_options.n_buffers == 0u) {
+        throw std::invalid_argument(
+            "The number of staging buffers must not be zero");
+    }
+}
+
+std::size_t streaming_copy::n_buffers(std::size_t size) const {
+
+    // Don't allocate more buffers than there are chunks.
+    const std::size_t n_chunks =
+        (size + m_options.chunk_size - 1u) / m_options.chunk_size;
+    return std::min(m_options.n_buffers, n_chunks);
+}
+
+}  // namespace vecmem
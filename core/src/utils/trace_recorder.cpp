@@ -0,0 +1,410 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/trace_recorder.hpp"
+
+#include "vecmem/utils/copy_observer.hpp"
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Counter providing a unique identifier for every recorder
+std::atomic<std::uint64_t> next_recorder_id{1u};
+
+/// The kinds of spans recorded
+enum class span_kind : unsigned char {
+    allocate = 0,
+    deallocate = 1,
+    copy = 2,
+    copy_batch = 3,
+    memset = 4,
+    event = 5,
+    wait = 6
+};  // enum class span_kind
+
+/// Name of a kind of span in the timeline
+const char* span_name(span_kind kind) {
+
+    static const char* const names[] = {
+        "allocate", "deallocate", "copy", "copy_batch",
+        "memset",   "event",      "wait"};
+    return names[static_cast<std::size_t>(kind)];
+}
+
+/// Name of a copy type in the timeline
+const char* copy_type_name(vecmem::copy::type::copy_type cptype) {
+
+    switch (cptype) {
+        case vecmem::copy::type::host_to_device:
+            return "host_to_device";
+        case vecmem::copy::type::device_to_host:
+            return "device_to_host";
+        case vecmem::copy::type::host_to_host:
+            return "host_to_host";
+        case vecmem::copy::type::device_to_device:
+            return "device_to_device";
+        default:
+            return "unknown";
+    }
+}
+
+/// Write a string into a JSON document, with the necessary escaping
+void write_json_string(std::ostream& out, const std::string& str) {
+
+    out << '"';
+    for (char c : str) {
+        if ((c == '"') || (c == '\\')) {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20u) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                          static_cast<unsigned int>(c));
+            out << buffer;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+namespace vecmem {
+
+struct trace_recorder::impl {
+
+    /// The clock used for the timeline
+    using clock = std::chrono::steady_clock;
+
+    /// A single recorded span
+    struct span {
+        /// The kind of the span
+        span_kind m_kind = span_kind::allocate;
+        /// Index of the name of the resource / copy object
+        std::size_t m_source = 0u;
+        /// The start of the span
+        clock::time_point m_start;
+        /// The duration of the span
+        std::chrono::nanoseconds m_duration{0};
+        /// The number of bytes allocated/copied/set
+        std::size_t m_size = 0u;
+        /// The alignment of allocations, number of regions for copies
+        std::size_t m_count = 0u;
+        /// The type of (batched) copies
+        copy::type::copy_type m_type = copy::type::unknown;
+        /// The pointer allocated/de-allocated
+        const void* m_ptr = nullptr;
+    };  // struct span
+
+    /// The spans recorded by a single thread
+    struct thread_buffer {
+        /// Mutex protecting the recorded spans
+        ///
+        /// It is only ever contended while the timeline is written/cleared.
+        ///
+        std::mutex m_mutex;
+        /// The identifier of the thread in the timeline
+        std::size_t m_tid = 0u;
+        /// The spans recorded by the thread
+        std::vector<span> m_spans;
+        /// Start times of the (nested) allocations in flight on the thread
+        std::vector<clock::time_point> m_starts;
+    };  // struct thread_buffer
+
+    /// Observer forwarding the operations of a copy object to the recorder
+    class copy_tracer : public copy_observer {
+
+    public:
+        copy_tracer(impl& parent, std::size_t source)
+            : m_parent(parent), m_source(source) {}
+
+        void observe(const record& rec) override {
+            const clock::time_point end = clock::now();
+            span s;
+            s.m_kind = kind(rec.m_operation);
+            s.m_source = m_source;
+            s.m_start = end - rec.m_duration;
+            s.m_duration = rec.m_duration;
+            s.m_size = rec.m_size;
+            s.m_count = rec.m_n_regions;
+            s.m_type = rec.m_type;
+            m_parent.record(s);
+        }
+
+    private:
+        /// The kind of span describing an operation
+        static span_kind kind(operation op) {
+            switch (op) {
+                case operation::copy:
+                    return span_kind::copy;
+                case operation::copy_batch:
+                    return span_kind::copy_batch;
+                case operation::memset:
+                    return span_kind::memset;
+                case operation::event:
+                    return span_kind::event;
+                default:
+                    return span_kind::wait;
+            }
+        }
+
+        /// The recorder to forward the operations to
+        impl& m_parent;
+        /// Index of the name of the copy object
+        std::size_t m_source;
+    };  // class copy_tracer
+
+    /// Get the buffer of the current thread
+    thread_buffer& local_buffer() {
+
+        // Look for the buffer in the thread's cache. The unique identifiers
+        // make sure that entries belonging to deleted recorders never match.
+        thread_local std::vector<std::pair<std::uint64_t, thread_buffer*>>
+            cache;
+        for (const auto& entry : cache) {
+            if (entry.first == m_id) {
+                return *(entry.second);
+            }
+        }
+
+        // Create a new buffer for this thread.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffers.push_back(std::make_unique<thread_buffer>());
+        thread_buffer& result = *(m_buffers.back());
+        result.m_tid = m_buffers.size();
+        cache.emplace_back(m_id, &result);
+        return result;
+    }
+
+    /// Record a span in the buffer of the current thread
+    void record(const span& s) {
+
+        thread_buffer& buffer = local_buffer();
+        std::lock_guard<std::mutex> lock(buffer.m_mutex);
+        buffer.m_spans.push_back(s);
+    }
+
+    /// Record a (de-)allocation started by a pre-hook on the current thread
+    void finish_allocation(span_kind kind, std::size_t source, std::size_t size,
+                           std::size_t align, const void* ptr) {
+
+        const clock::time_point end = clock::now();
+        thread_buffer& buffer = local_buffer();
+        if (buffer.m_starts.empty()) {
+            return;
+        }
+        span s;
+        s.m_kind = kind;
+        s.m_source = source;
+        s.m_start = buffer.m_starts.back();
+        buffer.m_starts.pop_back();
+        s.m_duration = end - s.m_start;
+        s.m_size = size;
+        s.m_count = align;
+        s.m_ptr = ptr;
+        std::lock_guard<std::mutex> lock(buffer.m_mutex);
+        buffer.m_spans.push_back(s);
+    }
+
+    /// Register the name of a resource / copy object
+    std::size_t add_source(const std::string& name) {
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sources.push_back(name);
+        return m_sources.size() - 1u;
+    }
+
+    /// Unique identifier of the recorder
+    const std::uint64_t m_id = next_recorder_id++;
+    /// The start of the timeline
+    const clock::time_point m_origin = clock::now();
+    /// The file to write the timeline into on destruction
+    std::string m_filename;
+
+    /// Mutex protecting the following members
+    mutable std::mutex m_mutex;
+    /// The buffers of all threads that recorded something
+    std::vector<std::unique_ptr<thread_buffer>> m_buffers;
+    /// The names of the resources / copy objects
+    std::vector<std::string> m_sources;
+    /// The observers attached to copy objects
+    std::vector<std::unique_ptr<copy_tracer>> m_tracers;
+
+};  // struct trace_recorder::impl
+
+trace_recorder::trace_recorder() : m_impl{std::make_unique<impl>()} {}
+
+trace_recorder::trace_recorder(const std::string& filename)
+    : trace_recorder() {
+
+    m_impl->m_filename = filename;
+}
+
+trace_recorder::~trace_recorder() {
+
+    // Write the timeline into the requested file, if there is one.
+    if (m_impl->m_filename.empty()) {
+        return;
+    }
+    std::ofstream file(m_impl->m_filename);
+    if (!file) {
+        VECMEM_DEBUG_MSG(1, "Could not open trace file \"%s\"",
+                         m_impl->m_filename.c_str());
+        return;
+    }
+    try {
+        write(file);
+    } catch (const std::exception& ex) {
+        VECMEM_DEBUG_MSG(1, "Could not write trace file \"%s\": %s",
+                         m_impl->m_filename.c_str(), ex.what());
+    }
+}
+
+void trace_recorder::attach(instrumenting_memory_resource& resource,
+                            const std::string& name) {
+
+    impl& i = *m_impl;
+    const std::size_t source = i.add_source(name);
+
+    // Allocations are timed from just before calling the upstream resource,
+    // to just after it returned.
+    resource.add_pre_allocate_hook([&i](std::size_t, std::size_t) {
+        i.local_buffer().m_starts.push_back(impl::clock::now());
+    });
+    resource.add_post_allocate_hook(
+        [&i, source](std::size_t size, std::size_t align, void* ptr) {
+            i.finish_allocation(span_kind::allocate, source, size, align, ptr);
+        });
+    // De-allocations are timed the same way.
+    resource.add_pre_deallocate_hook([&i](void*, std::size_t, std::size_t) {
+        i.local_buffer().m_starts.push_back(impl::clock::now());
+    });
+    resource.add_post_deallocate_hook(
+        [&i, source](void* ptr, std::size_t size, std::size_t align) {
+            i.finish_allocation(span_kind::deallocate, source, size, align,
+                                ptr);
+        });
+}
+
+void trace_recorder::attach(copy& cp, const std::string& name) {
+
+    const std::size_t source = m_impl->add_source(name);
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    m_impl->m_tracers.push_back(
+        std::make_unique<impl::copy_tracer>(*m_impl, source));
+    cp.set_observer(m_impl->m_tracers.back().get());
+}
+
+std::size_t trace_recorder::size() const {
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    std::size_t result = 0u;
+    for (const std::unique_ptr<impl::thread_buffer>& buffer :
+         m_impl->m_buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->m_mutex);
+        result += buffer->m_spans.size();
+    }
+    return result;
+}
+
+void trace_recorder::clear() {
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    for (const std::unique_ptr<impl::thread_buffer>& buffer :
+         m_impl->m_buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->m_mutex);
+        buffer->m_spans.clear();
+    }
+}
+
+void trace_recorder::write(std::ostream& out) const {
+
+    // Collect the spans of all threads, in chronological order.
+    std::vector<std::pair<std::size_t, impl::span>> spans;
+    std::vector<std::string> sources;
+    std::vector<std::size_t> tids;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        sources = m_impl->m_sources;
+        for (const std::unique_ptr<impl::thread_buffer>& buffer :
+             m_impl->m_buffers) {
+            tids.push_back(buffer->m_tid);
+            std::lock_guard<std::mutex> buffer_lock(buffer->m_mutex);
+            for (const impl::span& s : buffer->m_spans) {
+                spans.emplace_back(buffer->m_tid, s);
+            }
+        }
+    }
+    std::stable_sort(spans.begin(), spans.end(),
+                     [](const auto& a, const auto& b) {
+                         return a.second.m_start < b.second.m_start;
+                     });
+
+    // Times are written in microseconds, with nanosecond precision.
+    auto microseconds = [](std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::micro>(ns).count();
+    };
+
+    // Write the document into a local stream first, not to modify the
+    // formatting flags of the output stream.
+    std::ostringstream doc;
+    doc << std::fixed << std::setprecision(3);
+    doc << "{\"traceEvents\":[";
+    bool first = true;
+    for (std::size_t tid : tids) {
+        doc << (first ? "\n" : ",\n");
+        first = false;
+        doc << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << tid << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+    }
+    for (const auto& [tid, s] : spans) {
+        doc << (first ? "\n" : ",\n");
+        first = false;
+        const bool is_memory = ((s.m_kind == span_kind::allocate) ||
+                                (s.m_kind == span_kind::deallocate));
+        doc << "{\"name\":\"" << span_name(s.m_kind) << "\",\"cat\":\""
+            << (is_memory ? "memory" : "copy") << "\",\"ph\":\"X\",\"ts\":"
+            << microseconds(s.m_start - m_impl->m_origin)
+            << ",\"dur\":" << microseconds(s.m_duration)
+            << ",\"pid\":1,\"tid\":" << tid << ",\"args\":{";
+        doc << (is_memory ? "\"resource\":" : "\"copy\":");
+        write_json_string(doc, sources[s.m_source]);
+        doc << ",\"size\":" << s.m_size;
+        if (is_memory) {
+            doc << ",\"alignment\":" << s.m_count << ",\"ptr\":";
+            if (s.m_ptr == nullptr) {
+                doc << "null";
+            } else {
+                doc << "\"" << s.m_ptr << "\"";
+            }
+        } else {
+            doc << ",\"regions\":" << s.m_count << ",\"type\":\""
+                << copy_type_name(s.m_type) << "\"";
+        }
+        doc << "}}";
+    }
+    doc << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    out << doc.str();
+}
+
+}  // namespace vecmem
@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_cuda_export.hpp"
 
@@ -22,7 +23,9 @@ namespace vecmem::cuda {
  * allocates, it does not try to manage memory in a smart way) that works
  * for CUDA device memory. Each instance is bound to a specific device.
  */
-class device_memory_resource final : public memory_resource {
+class device_memory_resource final
+    : public memory_resource,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Invalid/default device identifier
@@ -63,6 +66,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CUDA_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// CUDA device identifier to use for the (de-)allocations
     const int m_device;
 
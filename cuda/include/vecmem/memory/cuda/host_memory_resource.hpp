@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_cuda_export.hpp"
 
@@ -21,7 +22,9 @@ namespace vecmem::cuda {
  * memory, which is page-locked by default to allow faster transfer to the
  * CUDA devices.
  */
-class host_memory_resource final : public memory_resource {
+class host_memory_resource final
+    : public memory_resource,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Default constructor
@@ -47,6 +50,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_CUDA_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // class host_memory_resource
 
 }  // namespace vecmem::cuda
@@ -79,4 +79,9 @@ bool device_memory_resource::do_is_equal(
     return c != nullptr && c->m_device == m_device;
 }
 
+memory_space device_memory_resource::do_space() const noexcept {
+
+    return memory_space::device;
+}
+
 }  // namespace vecmem::cuda
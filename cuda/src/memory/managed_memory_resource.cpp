@@ -58,4 +58,9 @@ bool managed_memory_resource::do_is_equal(
     return (dynamic_cast<const managed_memory_resource *>(&other) != nullptr);
 }
 
+memory_space managed_memory_resource::do_space() const noexcept {
+
+    return memory_space::shared;
+}
+
 }  // namespace vecmem::cuda
@@ -147,7 +147,12 @@ async_copy::async_copy(const stream_wrapper& stream, unsigned int event_flags)
 
 async_copy::async_copy(async_copy&&) noexcept = default;
 
-async_copy::~async_copy() noexcept = default;
+async_copy::~async_copy() noexcept {
+
+    // Wait for the operations whose events were ignored by the user, while
+    // the event pool that their events came from still exists.
+    wait_for_staged_operations();
+}
 
 async_copy& async_copy::operator=(async_copy&&) noexcept = default;
 
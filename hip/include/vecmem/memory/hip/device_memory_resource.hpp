@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_hip_export.hpp"
 
@@ -16,7 +17,9 @@
 namespace vecmem::hip {
 
 /// Memory resource for a specific HIP device
-class device_memory_resource final : public memory_resource {
+class device_memory_resource final
+    : public memory_resource,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Invalid/default device identifier
@@ -48,6 +51,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_HIP_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
     /// The HIP device used by this resource
     const int m_device;
 
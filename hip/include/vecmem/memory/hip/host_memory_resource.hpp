@@ -9,13 +9,16 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_hip_export.hpp"
 
 namespace vecmem::hip {
 
 /// Memory resource for HIP shared host/device memory
-class host_memory_resource final : public memory_resource {
+class host_memory_resource final
+    : public memory_resource,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Default constructor
@@ -44,6 +47,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_HIP_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // class host_memory_resource
 
 }  // namespace vecmem::hip
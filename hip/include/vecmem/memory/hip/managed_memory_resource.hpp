@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/vecmem_hip_export.hpp"
 
@@ -20,7 +21,9 @@ namespace vecmem::hip {
  * This is an allocator-type memory resource that allocates managed HIP
  * memory, which is accessible directly to devices as well as to the host.
  */
-class managed_memory_resource final : public memory_resource {
+class managed_memory_resource final
+    : public memory_resource,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Default constructor
@@ -46,6 +49,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_HIP_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // class managed_memory_resource
 
 }  // namespace vecmem::hip
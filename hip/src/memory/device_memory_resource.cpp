@@ -68,4 +68,9 @@ bool device_memory_resource::do_is_equal(
     return ((p != nullptr) && (p->m_device == m_device));
 }
 
+memory_space device_memory_resource::do_space() const noexcept {
+
+    return memory_space::device;
+}
+
 }  // namespace vecmem::hip
@@ -57,4 +57,9 @@ bool host_memory_resource::do_is_equal(
     return (dynamic_cast<const host_memory_resource*>(&other) != nullptr);
 }
 
+memory_space host_memory_resource::do_space() const noexcept {
+
+    return memory_space::pinned;
+}
+
 }  // namespace vecmem::hip
@@ -9,6 +9,7 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/sycl/details/memory_resource_base.hpp"
 #include "vecmem/vecmem_sycl_export.hpp"
 
@@ -16,7 +17,9 @@
 namespace vecmem::sycl {
 
 /// Memory resource for a specific SYCL device
-class device_memory_resource final : public details::memory_resource_base {
+class device_memory_resource final
+    : public details::memory_resource_base,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Inherit the base class's constructor(s)
@@ -32,6 +35,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_SYCL_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // device_memory_resource
 
 }  // namespace vecmem::sycl
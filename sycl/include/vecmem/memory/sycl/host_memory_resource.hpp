@@ -9,13 +9,16 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/memory/details/memory_space_provider.hpp"
 #include "vecmem/memory/sycl/details/memory_resource_base.hpp"
 #include "vecmem/vecmem_sycl_export.hpp"
 
 namespace vecmem::sycl {
 
 /// Host memory resource, connected to a specific SYCL device
-class host_memory_resource final : public details::memory_resource_base {
+class host_memory_resource final
+    : public details::memory_resource_base,
+      public vecmem::details::memory_space_provider {
 
 public:
     /// Inherit the base class's constructor(s)
@@ -31,6 +34,16 @@ private:
 
     /// @}
 
+    /// @name Function(s) implementing
+    ///       @c vecmem::details::memory_space_provider
+    /// @{
+
+    /// Get the kind of memory allocated by the memory resource
+    VECMEM_SYCL_EXPORT
+    memory_space do_space() const noexcept override;
+
+    /// @}
+
 };  // class host_memory_resource
 
 }  // namespace vecmem::sycl
@@ -0,0 +1,189 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+TEST(core_async_copy_test, in_order_execution) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Enqueue a chain of dependent operations, and only wait at the end.
+    vecmem::vector<int> source(100000, &resource);
+    std::iota(source.begin(), source.end(), 0);
+    vecmem::data::vector_buffer<int> buffer1(
+        static_cast<unsigned int>(source.size()), resource);
+    vecmem::data::vector_buffer<int> buffer2(
+        static_cast<unsigned int>(source.size()), resource);
+
+    copy.memset(buffer1, 0)->ignore();
+    copy(vecmem::get_data(source), buffer1)->ignore();
+    copy.memset(buffer2, 1)->ignore();
+    auto event = copy(buffer1, buffer2);
+    event->wait();
+    EXPECT_TRUE(event->is_ready());
+
+    vecmem::vector<int> result(&resource);
+    vecmem::copy{}(buffer2, result)->wait();
+    EXPECT_EQ(source, result);
+}
+
+TEST(core_async_copy_test, event_tracking) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Operations with nothing to do are ready right away.
+    auto empty_event = copy.memset(vecmem::data::vector_view<int>{}, 0);
+    EXPECT_TRUE(empty_event->is_ready());
+    empty_event->wait();
+
+    // Events track all operations enqueued before them.
+    vecmem::data::vector_buffer<char> buffer(10000000, resource);
+    auto event1 = copy.memset(buffer, 1);
+    auto event2 = copy.memset(buffer, 2);
+    event2->wait();
+    EXPECT_TRUE(event1->is_ready());
+    EXPECT_TRUE(event2->is_ready());
+    event1->wait();
+
+    vecmem::vector<char> result(&resource);
+    copy(buffer, result)->wait();
+    for (char c : result) {
+        EXPECT_EQ(c, 2);
+    }
+}
+
+TEST(core_async_copy_test, synchronize) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    vecmem::data::vector_buffer<int> buffer(1000, resource);
+    for (int i = 0; i < 10; ++i) {
+        copy.memset(buffer, i)->ignore();
+    }
+    copy.synchronize();
+
+    vecmem::vector<int> result(&resource);
+    vecmem::copy{}(buffer, result)->wait();
+    for (int value : result) {
+        EXPECT_EQ(value, 0x09090909);
+    }
+}
+
+TEST(core_async_copy_test, event_outlives_copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::data::vector_buffer<int> buffer(100000, resource);
+
+    // Events must stay usable after the copy object is gone.
+    vecmem::copy::event_type event;
+    {
+        vecmem::host::async_copy copy;
+        event = copy.memset(buffer, 0);
+    }
+    EXPECT_TRUE(event->is_ready());
+    event->wait();
+}
+
+TEST(core_async_copy_test, move) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::data::vector_buffer<int> buffer(1000, resource);
+
+    vecmem::host::async_copy copy1;
+    vecmem::host::async_copy copy2(std::move(copy1));
+    copy2.memset(buffer, 0)->wait();
+
+    vecmem::host::async_copy copy3;
+    copy3 = std::move(copy2);
+    copy3.memset(buffer, 1)->wait();
+
+    vecmem::vector<int> result(&resource);
+    copy3(buffer, result)->wait();
+    for (int value : result) {
+        EXPECT_EQ(value, 0x01010101);
+    }
+}
+
+TEST(core_async_copy_test, resizable_targets) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    vecmem::vector<int> source(100, &resource);
+    std::iota(source.begin(), source.end(), 0);
+
+    // Queue copies into resizable buffers back to back, without waiting for
+    // any of them. The sizes set on the targets are staged by the copy object.
+    std::vector<vecmem::data::vector_buffer<int>> targets;
+    for (unsigned int i = 0; i < 20; ++i) {
+        targets.emplace_back(100u, resource,
+                             vecmem::data::buffer_type::resizable);
+        copy.setup(targets.back())->ignore();
+        copy(vecmem::data::vector_view<const int>(i + 1u, source.data()),
+             targets.back())
+            ->ignore();
+    }
+    copy.synchronize();
+
+    for (unsigned int i = 0; i < 20; ++i) {
+        EXPECT_EQ(copy.get_size(targets[i]), i + 1u);
+        vecmem::vector<int> result(&resource);
+        copy(targets[i], result)->wait();
+        EXPECT_EQ(result, vecmem::vector<int>(source.begin(),
+                                              source.begin() + i + 1u));
+    }
+}
+
+TEST(core_async_copy_test, resizable_jagged_targets) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Create a (non-resizable) source jagged vector.
+    vecmem::jagged_vector<int> source(&resource);
+    source.resize(4);
+    source[0] = {1, 2, 3};
+    source[1] = {4};
+    source[3] = {5, 6};
+    const std::vector<unsigned int> capacities = {5, 5, 5, 5};
+    const std::vector<unsigned int> sizes = {3, 1, 0, 2};
+
+    // Copy it into a resizable buffer, and from there into another resizable
+    // buffer with the same layout, without waiting in between.
+    vecmem::data::jagged_vector_buffer<int> buffer1(
+        capacities, resource, nullptr, vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> buffer2(
+        capacities, resource, nullptr, vecmem::data::buffer_type::resizable);
+    copy.setup(buffer1)->ignore();
+    copy.setup(buffer2)->ignore();
+    copy(vecmem::get_data(source), buffer1)->ignore();
+    copy(buffer1, buffer2)->wait();
+
+    EXPECT_EQ(copy.get_sizes(buffer1), sizes);
+    EXPECT_EQ(copy.get_sizes(buffer2), sizes);
+    vecmem::jagged_vector<int> result(&resource);
+    copy(buffer2, result)->wait();
+    EXPECT_EQ(result, source);
+}
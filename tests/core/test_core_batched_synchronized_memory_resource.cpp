@@ -0,0 +1,212 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "vecmem/memory/batched_synchronized_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(core_batched_synchronized_memory_resource_test, invalid_options) {
+    vecmem::host_memory_resource ups;
+
+    vecmem::batched_synchronized_memory_resource::options opts;
+    opts.queue_capacity = 0;
+    EXPECT_THROW(vecmem::batched_synchronized_memory_resource(ups, opts),
+                 std::invalid_argument);
+    opts.queue_capacity = 1;
+    EXPECT_THROW(vecmem::batched_synchronized_memory_resource(ups, opts),
+                 std::invalid_argument);
+    opts.queue_capacity = 100;
+    EXPECT_THROW(vecmem::batched_synchronized_memory_resource(ups, opts),
+                 std::invalid_argument);
+    opts.queue_capacity = 128;
+    EXPECT_NO_THROW(vecmem::batched_synchronized_memory_resource(ups, opts));
+}
+
+TEST(core_batched_synchronized_memory_resource_test, deferred_deallocation) {
+    vecmem::host_memory_resource ups;
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void*, std::size_t, std::size_t) { ++deallocs; });
+
+    vecmem::batched_synchronized_memory_resource res(mon);
+
+    // De-allocations should only reach the upstream resource in batches.
+    std::vector<void*> ptrs;
+    for (std::size_t i = 0; i < 10; ++i) {
+        ptrs.push_back(res.allocate(128));
+    }
+    for (void* p : ptrs) {
+        res.deallocate(p, 128);
+    }
+    EXPECT_EQ(deallocs, 0u);
+
+    // The next allocation should drain the queue.
+    void* p = res.allocate(256);
+    EXPECT_EQ(deallocs, 10u);
+
+    // So should an explicit call to drain().
+    res.deallocate(p, 256);
+    EXPECT_EQ(deallocs, 10u);
+    res.drain();
+    EXPECT_EQ(deallocs, 11u);
+}
+
+TEST(core_batched_synchronized_memory_resource_test, queue_overflow) {
+    vecmem::host_memory_resource ups;
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    vecmem::batched_synchronized_memory_resource::options opts;
+    opts.queue_capacity = 4;
+    vecmem::batched_synchronized_memory_resource res(mon, opts);
+
+    std::vector<void*> ptrs;
+    for (std::size_t i = 0; i < 10; ++i) {
+        ptrs.push_back(res.allocate(64));
+    }
+
+    // Once the queue fills up, the de-allocating thread has to drain it.
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void*, std::size_t, std::size_t) { ++deallocs; });
+    for (std::size_t i = 0; i < 4; ++i) {
+        res.deallocate(ptrs[i], 64);
+    }
+    EXPECT_EQ(deallocs, 0u);
+    res.deallocate(ptrs[4], 64);
+    EXPECT_EQ(deallocs, 5u);
+    for (std::size_t i = 5; i < 10; ++i) {
+        res.deallocate(ptrs[i], 64);
+    }
+    res.drain();
+    EXPECT_EQ(deallocs, 10u);
+}
+
+TEST(core_batched_synchronized_memory_resource_test, destructor_drains) {
+    vecmem::host_memory_resource ups;
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void*, std::size_t, std::size_t) { ++deallocs; });
+
+    {
+        vecmem::batched_synchronized_memory_resource res(mon);
+        res.deallocate(res.allocate(32), 32);
+        res.deallocate(res.allocate(64), 64);
+        EXPECT_EQ(deallocs, 1u);
+    }
+    EXPECT_EQ(deallocs, 2u);
+}
+
+TEST(core_batched_synchronized_memory_resource_test, background_drain) {
+    vecmem::host_memory_resource ups;
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    std::atomic<std::size_t> deallocs{0u};
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void*, std::size_t, std::size_t) { ++deallocs; });
+
+    vecmem::batched_synchronized_memory_resource::options opts;
+    opts.background_drain = true;
+    opts.drain_interval = std::chrono::microseconds{10};
+    vecmem::batched_synchronized_memory_resource res(mon, opts);
+
+    res.deallocate(res.allocate(128), 128);
+
+    // Wait (with a generous timeout) for the background thread to do its job.
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while ((deallocs.load() == 0u) &&
+           (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(deallocs.load(), 1u);
+}
+
+TEST(core_batched_synchronized_memory_resource_test, producer_consumer) {
+    vecmem::host_memory_resource ups;
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    vecmem::batched_synchronized_memory_resource::options opts;
+    opts.queue_capacity = 64;
+    vecmem::batched_synchronized_memory_resource res(mon, opts);
+
+    // Allocate memory blocks on one thread, and free them on others.
+    static constexpr std::size_t N_PRODUCED = 10000;
+    static constexpr std::size_t N_CONSUMERS = 4;
+    std::vector<void*> handoff;
+    std::mutex handoff_mutex;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        for (std::size_t i = 0; i < N_PRODUCED; ++i) {
+            void* p = res.allocate(16 + (i % 256));
+            const std::lock_guard<std::mutex> lock(handoff_mutex);
+            handoff.push_back(p);
+        }
+        done = true;
+    });
+    std::atomic<std::size_t> consumed{0u};
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < N_CONSUMERS; ++i) {
+        consumers.emplace_back([&]() {
+            while (true) {
+                void* p = nullptr;
+                {
+                    const std::lock_guard<std::mutex> lock(handoff_mutex);
+                    if (!handoff.empty()) {
+                        p = handoff.back();
+                        handoff.pop_back();
+                    }
+                }
+                if (p != nullptr) {
+                    // The size is irrelevant for the host resource, as long as
+                    // it is not zero.
+                    res.deallocate(p, 16);
+                    ++consumed;
+                } else if (done) {
+                    const std::lock_guard<std::mutex> lock(handoff_mutex);
+                    if (handoff.empty()) {
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    producer.join();
+    for (std::thread& t : consumers) {
+        t.join();
+    }
+    res.drain();
+
+    EXPECT_EQ(consumed.load(), N_PRODUCED);
+    std::size_t allocs = 0, deallocs = 0;
+    for (const auto& event : mon.get_events()) {
+        if (event.m_type == vecmem::instrumenting_memory_resource::
+                                memory_event::type::ALLOCATION) {
+            ++allocs;
+        } else {
+            ++deallocs;
+        }
+    }
+    EXPECT_EQ(allocs, N_PRODUCED);
+    EXPECT_EQ(deallocs, N_PRODUCED);
+}
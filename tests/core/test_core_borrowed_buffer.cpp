@@ -0,0 +1,152 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/jagged_soa_container.hpp"
+#include "../common/jagged_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/borrowed_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/simulated_device_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <memory>
+#include <vector>
+
+TEST(core_borrowed_buffer_test, can_borrow) {
+
+    using space = vecmem::memory_space;
+    using type = vecmem::copy::type;
+
+    EXPECT_TRUE(vecmem::copy::can_borrow(space::host, space::host));
+    EXPECT_TRUE(vecmem::copy::can_borrow(space::pinned, space::host));
+    EXPECT_TRUE(vecmem::copy::can_borrow(space::shared, space::host));
+    EXPECT_TRUE(vecmem::copy::can_borrow(space::pinned, space::pinned));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::host, space::pinned));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::host, space::shared));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::device, space::device));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::host, space::device));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::unknown, space::host));
+    EXPECT_TRUE(vecmem::copy::can_borrow(space::unknown, space::host,
+                                         type::host_to_host));
+    EXPECT_FALSE(vecmem::copy::can_borrow(space::host, space::host,
+                                          type::host_to_device));
+}
+
+TEST(core_borrowed_buffer_test, vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Data in a buffer with a known memory space is borrowed.
+    auto source =
+        std::make_shared<vecmem::data::vector_buffer<int>>(100, resource);
+    copy.memset(vecmem::get_data(*source), 0)->wait();
+    auto borrowed =
+        copy.to_borrowed(vecmem::get_data(*source), source, resource);
+    EXPECT_TRUE(borrowed.is_borrowed());
+    EXPECT_EQ(borrowed.ptr(), source->ptr());
+    EXPECT_EQ(borrowed.owner(), source);
+
+    // Which keeps the source alive.
+    const int* const ptr = source->ptr();
+    source.reset();
+    EXPECT_EQ(borrowed.ptr(), ptr);
+    EXPECT_EQ(borrowed.ptr()[99], 0);
+
+    // Data in an unknown memory space is only borrowed on request.
+    vecmem::vector<int> vec(50, 2, &resource);
+    auto copied = copy.to_borrowed(vecmem::get_data(vec), nullptr, resource);
+    EXPECT_FALSE(copied.is_borrowed());
+    EXPECT_NE(copied.ptr(), vec.data());
+    EXPECT_NE(copied.owner(), nullptr);
+    EXPECT_EQ(copied.capacity(), 50u);
+    EXPECT_EQ(copied.ptr()[49], 2);
+    auto borrowed2 =
+        copy.to_borrowed(vecmem::get_data(vec), nullptr, resource,
+                         vecmem::copy::type::host_to_host);
+    EXPECT_TRUE(borrowed2.is_borrowed());
+    EXPECT_EQ(borrowed2.ptr(), vec.data());
+}
+
+TEST(core_borrowed_buffer_test, device) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+
+    // Data is always copied to a device.
+    auto source =
+        std::make_shared<vecmem::data::vector_buffer<int>>(100, host_resource);
+    copy.memset(vecmem::get_data(*source), 0)->wait();
+    auto copied =
+        copy.to_borrowed(vecmem::get_data(*source), source, device_resource);
+    EXPECT_FALSE(copied.is_borrowed());
+    EXPECT_TRUE(device_resource.owns(copied.ptr()));
+    EXPECT_EQ(
+        copy.get_statistics().copies[vecmem::copy::type::host_to_device]
+            .n_copies,
+        1u);
+    std::vector<int> result;
+    copy(copied, result)->wait();
+    EXPECT_EQ(result, std::vector<int>(100, 0));
+}
+
+TEST(core_borrowed_buffer_test, jagged_and_soa) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Borrow a jagged vector.
+    auto jagged = std::make_shared<vecmem::jagged_vector<int>>(
+        vecmem::jagged_vector<int>({{1, 2, 3}, {4, 5}, {}, {6}}, &resource));
+    auto jagged_data = std::make_shared<vecmem::data::jagged_vector_data<int>>(
+        vecmem::get_data(*jagged));
+    auto borrowed_jagged =
+        copy.to_borrowed(vecmem::get_data(*jagged_data), jagged_data,
+                         resource, nullptr, vecmem::copy::type::host_to_host);
+    EXPECT_TRUE(borrowed_jagged.is_borrowed());
+    EXPECT_EQ(borrowed_jagged.host_ptr()[0].ptr(), jagged->at(0).data());
+
+    // And copy it if needed.
+    auto copied_jagged =
+        copy.to_borrowed(vecmem::get_data(*jagged_data), jagged_data,
+                         resource);
+    EXPECT_FALSE(copied_jagged.is_borrowed());
+    vecmem::jagged_vector<int> jagged_result(&resource);
+    copy(copied_jagged, jagged_result)->wait();
+    EXPECT_EQ(jagged_result, *jagged);
+
+    // Borrow a SoA container.
+    auto soa = std::make_shared<vecmem::testing::jagged_soa_container::host>(
+        resource);
+    vecmem::testing::fill(*soa);
+    auto soa_data = std::make_shared<decltype(vecmem::get_data(*soa))>(
+        vecmem::get_data(*soa));
+    auto borrowed_soa =
+        copy.to_borrowed(vecmem::get_data(*soa_data), soa_data, resource,
+                         nullptr, vecmem::copy::type::host_to_host);
+    EXPECT_TRUE(borrowed_soa.is_borrowed());
+    vecmem::testing::compare(vecmem::get_data(*soa),
+                             vecmem::get_data(borrowed_soa));
+
+    // And copy it if needed.
+    auto copied_soa =
+        copy.to_borrowed(vecmem::get_data(*soa_data), soa_data, resource);
+    EXPECT_FALSE(copied_soa.is_borrowed());
+    vecmem::testing::compare(vecmem::get_data(*soa),
+                             vecmem::get_data(copied_soa));
+}
@@ -0,0 +1,217 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/jagged_soa_container.hpp"
+#include "../common/jagged_soa_container_helpers.hpp"
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/utils/buffer_cache.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/simulated_device_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+TEST(core_buffer_cache_test, to_into_1d) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    vecmem::vector<int> source(100, 1, &resource);
+    vecmem::vector<int> smaller(50, 2, &resource);
+
+    // An empty buffer is replaced by a fixed sized one.
+    vecmem::data::vector_buffer<int> target;
+    copy.to_into(vecmem::get_data(source), target, resource)->wait();
+    EXPECT_EQ(target.capacity(), 100u);
+    EXPECT_EQ(target.size_ptr(), nullptr);
+    int* const ptr = target.ptr();
+
+    // Which is re-used for a source of the same size.
+    copy.to_into(vecmem::get_data(source), target, resource)->wait();
+    EXPECT_EQ(target.ptr(), ptr);
+
+    // But not for one of a different size.
+    copy.to_into(vecmem::get_data(smaller), target, resource)->wait();
+    EXPECT_EQ(target.capacity(), 50u);
+    EXPECT_EQ(target.ptr()[49], 2);
+
+    // Resizable buffers are re-used for smaller sources.
+    vecmem::data::vector_buffer<int> resizable(
+        100, resource, vecmem::data::buffer_type::resizable);
+    int* const resizable_ptr = resizable.ptr();
+    copy.to_into(vecmem::get_data(smaller), resizable, resource)->wait();
+    EXPECT_EQ(resizable.ptr(), resizable_ptr);
+    EXPECT_EQ(resizable.capacity(), 100u);
+    EXPECT_EQ(copy.get_size(resizable), 50u);
+
+    // And re-created as resizable buffers for larger ones.
+    vecmem::vector<int> larger(150, 3, &resource);
+    copy.to_into(vecmem::get_data(larger), resizable, resource)->wait();
+    EXPECT_EQ(resizable.capacity(), 150u);
+    EXPECT_NE(resizable.size_ptr(), nullptr);
+    EXPECT_EQ(copy.get_size(resizable), 150u);
+}
+
+TEST(core_buffer_cache_test, to_into_jagged) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+
+    vecmem::jagged_vector<int> source(
+        {{1, 2, 3}, {4, 5}, {}, {6, 7, 8, 9}}, &host_resource);
+
+    // Copy into an empty buffer, which needs to be set up.
+    vecmem::data::jagged_vector_buffer<int> target;
+    copy.to_into(vecmem::get_data(source), target, device_resource,
+                 &host_resource)
+        ->wait();
+    ASSERT_EQ(target.size(), 4u);
+    const auto* const ptr = target.ptr();
+    const std::size_t h2d_copies =
+        copy.get_statistics().copies[vecmem::copy::type::host_to_device]
+            .n_copies;
+
+    // Copying again re-uses the buffer, without setting it up again.
+    copy.reset_statistics();
+    copy.to_into(vecmem::get_data(source), target, device_resource,
+                 &host_resource)
+        ->wait();
+    EXPECT_EQ(target.ptr(), ptr);
+    EXPECT_LT(copy.get_statistics()
+                  .copies[vecmem::copy::type::host_to_device]
+                  .n_copies,
+              h2d_copies);
+
+    // Check the copied data.
+    vecmem::jagged_vector<int> result(&host_resource);
+    copy(target, result)->wait();
+    EXPECT_EQ(result, source);
+}
+
+TEST(core_buffer_cache_test, to_into_soa) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+
+    // Copy a simple container twice into the same buffer.
+    vecmem::testing::simple_soa_container::host simple{host_resource};
+    vecmem::testing::fill(simple);
+    vecmem::testing::simple_soa_container::buffer simple_buffer;
+    copy.to_into(vecmem::get_data(simple), simple_buffer, device_resource)
+        ->wait();
+    const auto* const simple_ptr = simple_buffer.payload().ptr();
+    copy.to_into(vecmem::get_data(simple), simple_buffer, device_resource)
+        ->wait();
+    EXPECT_EQ(simple_buffer.payload().ptr(), simple_ptr);
+    vecmem::testing::simple_soa_container::host simple_result{host_resource};
+    copy(simple_buffer, simple_result)->wait();
+    vecmem::testing::compare(vecmem::get_data(simple),
+                             vecmem::get_data(simple_result));
+
+    // Copy a jagged container twice into the same buffer.
+    vecmem::testing::jagged_soa_container::host jagged{host_resource};
+    vecmem::testing::fill(jagged);
+    vecmem::testing::jagged_soa_container::buffer jagged_buffer;
+    copy.to_into(vecmem::get_data(jagged), jagged_buffer, device_resource,
+                 &host_resource)
+        ->wait();
+    const auto* const jagged_ptr = jagged_buffer.payload().ptr();
+    copy.to_into(vecmem::get_data(jagged), jagged_buffer, device_resource,
+                 &host_resource)
+        ->wait();
+    EXPECT_EQ(jagged_buffer.payload().ptr(), jagged_ptr);
+    vecmem::testing::jagged_soa_container::host jagged_result{host_resource};
+    copy(jagged_buffer, jagged_result)->wait();
+    vecmem::testing::compare(vecmem::get_data(jagged),
+                             vecmem::get_data(jagged_result));
+}
+
+TEST(core_buffer_cache_test, cache) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+    vecmem::buffer_cache cache{device_resource, &host_resource};
+
+    vecmem::vector<int> source(100, 1, &host_resource);
+    vecmem::jagged_vector<int> jagged_source(
+        {{1, 2, 3}, {4, 5}, {}, {6, 7, 8, 9}}, &host_resource);
+    vecmem::testing::jagged_soa_container::host soa_source{host_resource};
+    vecmem::testing::fill(soa_source);
+
+    // Create buffers through the cache, and give them back to it.
+    vecmem::data::vector_buffer<int> buffer1 =
+        copy.to(vecmem::get_data(source), cache);
+    const auto* const ptr1 = buffer1.ptr();
+    vecmem::data::jagged_vector_buffer<int> buffer2 =
+        copy.to(vecmem::get_data(jagged_source), cache);
+    const auto* const ptr2 = buffer2.ptr();
+    vecmem::testing::jagged_soa_container::buffer buffer3 =
+        copy.to(vecmem::get_data(soa_source), cache);
+    const auto* const ptr3 = buffer3.payload().ptr();
+    EXPECT_EQ(cache.size(), 0u);
+    cache.release(std::move(buffer1));
+    cache.release(std::move(buffer2));
+    cache.release(std::move(buffer3));
+    EXPECT_EQ(cache.size(), 3u);
+
+    // Buffers of different shapes are not taken from the cache.
+    vecmem::vector<int> smaller(50, 2, &host_resource);
+    vecmem::data::vector_buffer<int> buffer4 =
+        copy.to(vecmem::get_data(smaller), cache);
+    EXPECT_EQ(buffer4.capacity(), 50u);
+    EXPECT_EQ(cache.size(), 3u);
+
+    // But the ones of the same shape are.
+    copy.reset_statistics();
+    vecmem::data::vector_buffer<int> buffer5 =
+        copy.to(vecmem::get_data(source), cache);
+    EXPECT_EQ(buffer5.ptr(), ptr1);
+    vecmem::data::jagged_vector_buffer<int> buffer6 =
+        copy.to(vecmem::get_data(jagged_source), cache);
+    EXPECT_EQ(buffer6.ptr(), ptr2);
+    vecmem::testing::jagged_soa_container::buffer buffer7 =
+        copy.to(vecmem::get_data(soa_source), cache);
+    EXPECT_EQ(buffer7.payload().ptr(), ptr3);
+    EXPECT_EQ(cache.size(), 0u);
+
+    // No setup was performed for the re-used buffers.
+    EXPECT_EQ(copy.get_statistics().n_memsets, 0u);
+
+    // Check the data in them.
+    std::vector<int> result;
+    copy(buffer5, result)->wait();
+    EXPECT_EQ(result, std::vector<int>(100, 1));
+    vecmem::jagged_vector<int> jagged_result(&host_resource);
+    copy(buffer6, jagged_result)->wait();
+    EXPECT_EQ(jagged_result, jagged_source);
+    vecmem::testing::jagged_soa_container::host soa_result{host_resource};
+    copy(buffer7, soa_result)->wait();
+    vecmem::testing::compare(vecmem::get_data(soa_source),
+                             vecmem::get_data(soa_result));
+
+    // Clear the cache.
+    cache.release(std::move(buffer5));
+    EXPECT_EQ(cache.size(), 1u);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
@@ -0,0 +1,208 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "vecmem/containers/details/resize_jagged_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/memory/arena_memory_resource.hpp"
+#include "vecmem/memory/bulk_allocation.hpp"
+#include "vecmem/memory/contiguous_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/memory/pool_memory_resource.hpp"
+#include "vecmem/memory/synchronized_memory_resource.hpp"
+#include "vecmem/memory/terminal_memory_resource.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace {
+
+/// Helper function exercising the bulk allocation functions on a resource
+void test_bulk_allocation(vecmem::memory_resource& resource) {
+
+    const std::vector<std::size_t> sizes = {16, 0, 128, 4, 1024, 333, 2048};
+    std::vector<void*> ptrs(sizes.size(), nullptr);
+
+    vecmem::allocate_bulk(resource, sizes.size(), sizes.data(), 16,
+                          ptrs.data());
+
+    // Check the allocated blocks.
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        if (sizes[i] == 0) {
+            EXPECT_EQ(ptrs[i], nullptr);
+            continue;
+        }
+        ASSERT_NE(ptrs[i], nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptrs[i]) % 16, 0u);
+        // Write into all of them, to catch any overlaps with UBSAN/ASAN.
+        std::memset(ptrs[i], static_cast<int>(i), sizes[i]);
+    }
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        for (std::size_t j = 0; j < sizes[i]; ++j) {
+            ASSERT_EQ(static_cast<unsigned char*>(ptrs[i])[j], i);
+        }
+    }
+
+    vecmem::deallocate_bulk(resource, sizes.size(), ptrs.data(), sizes.data(),
+                            16);
+}
+
+}  // namespace
+
+TEST(core_bulk_allocation_test, fallback) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon(host);
+    test_bulk_allocation(mon);
+
+    // The fallback should have performed one allocation per non-empty block.
+    EXPECT_EQ(mon.get_events().size(), 12u);
+}
+
+TEST(core_bulk_allocation_test, fallback_failure) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon(host);
+    vecmem::contiguous_memory_resource cont(mon, 1024);
+    vecmem::synchronized_memory_resource sync(cont);
+
+    // None of the blocks must remain allocated after a failure.
+    const std::vector<std::size_t> sizes = {256, 256, 1024};
+    std::vector<void*> ptrs(sizes.size(), nullptr);
+    EXPECT_THROW(vecmem::allocate_bulk(sync, sizes.size(), sizes.data(), 16,
+                                       ptrs.data()),
+                 std::bad_alloc);
+
+    // The contiguous resource should not have lost any of its memory.
+    const std::vector<std::size_t> sizes2 = {512, 512};
+    EXPECT_NO_THROW(vecmem::allocate_bulk(sync, sizes2.size(), sizes2.data(),
+                                          16, ptrs.data()));
+    EXPECT_EQ(static_cast<char*>(ptrs[1]) - static_cast<char*>(ptrs[0]), 512);
+}
+
+TEST(core_bulk_allocation_test, native) {
+
+    vecmem::host_memory_resource host;
+    vecmem::pool_memory_resource pool(host);
+    vecmem::arena_memory_resource arena(host, 1u << 16, 1u << 24);
+    vecmem::contiguous_memory_resource cont(host, 1u << 16);
+    vecmem::synchronized_memory_resource sync(pool);
+
+    test_bulk_allocation(pool);
+    test_bulk_allocation(arena);
+    test_bulk_allocation(cont);
+    test_bulk_allocation(sync);
+}
+
+TEST(core_bulk_allocation_test, pool_reserve) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon(host);
+    vecmem::pool_memory_resource::options opts;
+    opts.min_blocks_per_chunk = 4;
+    vecmem::pool_memory_resource pool(mon, opts);
+
+    // Allocate many blocks of the same size. The pool should set up the
+    // memory for them with a single upstream allocation.
+    const std::vector<std::size_t> sizes(1000, 64);
+    std::vector<void*> ptrs(sizes.size(), nullptr);
+    vecmem::allocate_bulk(pool, sizes.size(), sizes.data(), 16, ptrs.data());
+    EXPECT_EQ(mon.get_events().size(), 1u);
+    vecmem::deallocate_bulk(pool, sizes.size(), ptrs.data(), sizes.data(), 16);
+}
+
+TEST(core_bulk_allocation_test, arena) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon(host);
+    vecmem::arena_memory_resource arena(mon, 1u << 12, 1u << 24);
+    ASSERT_EQ(mon.get_events().size(), 1u);
+
+    // The blocks should be carved out of one free block, back to back.
+    const std::vector<std::size_t> sizes = {100, 0, 256, 1000, 1};
+    std::vector<void*> ptrs(sizes.size(), nullptr);
+    vecmem::allocate_bulk(arena, sizes.size(), sizes.data(), 16, ptrs.data());
+    EXPECT_EQ(ptrs[1], nullptr);
+    char* const begin = static_cast<char*>(ptrs[0]);
+    EXPECT_EQ(static_cast<char*>(ptrs[2]) - begin, 256);
+    EXPECT_EQ(static_cast<char*>(ptrs[3]) - begin, 512);
+    EXPECT_EQ(static_cast<char*>(ptrs[4]) - begin, 1536);
+
+    // The blocks can be de-allocated one by one, or all together. In either
+    // case the memory must be given back in one piece.
+    arena.deallocate(ptrs[2], sizes[2]);
+    ptrs[2] = nullptr;
+    vecmem::deallocate_bulk(arena, sizes.size(), ptrs.data(), sizes.data(),
+                            16);
+    void* big = arena.allocate(1792);
+    EXPECT_EQ(big, begin);
+    arena.deallocate(big, 1792);
+
+    // Reserving the memory for many small blocks should add one superblock
+    // for all of them.
+    const std::vector<std::size_t> sizes2(100, 256);
+    vecmem::reserve_bulk(arena, sizes2.size(), sizes2.data(), 16);
+    EXPECT_EQ(mon.get_events().size(), 2u);
+    std::vector<void*> ptrs2;
+    for (std::size_t size : sizes2) {
+        ptrs2.push_back(arena.allocate(size));
+    }
+    EXPECT_EQ(mon.get_events().size(), 2u);
+    for (void* p : ptrs2) {
+        arena.deallocate(p, 256);
+    }
+}
+
+TEST(core_bulk_allocation_test, arena_large_batch) {
+
+    vecmem::host_memory_resource host;
+    vecmem::arena_memory_resource arena(host, 1u << 20, 1u << 30);
+
+    // Allocate more memory in one batch than the size of the superblocks.
+    const std::vector<std::size_t> sizes(8192, 256);
+    std::vector<void*> ptrs(sizes.size(), nullptr);
+    ASSERT_NO_THROW(vecmem::allocate_bulk(arena, sizes.size(), sizes.data(),
+                                          16, ptrs.data()));
+    for (std::size_t i = 0; i < ptrs.size(); ++i) {
+        ASSERT_NE(ptrs[i], nullptr);
+        std::memset(ptrs[i], 1, sizes[i]);
+    }
+    vecmem::deallocate_bulk(arena, sizes.size(), ptrs.data(), sizes.data(),
+                            16);
+
+    // The memory must be re-usable afterwards.
+    ASSERT_NO_THROW(vecmem::allocate_bulk(arena, sizes.size(), sizes.data(),
+                                          16, ptrs.data()));
+    vecmem::deallocate_bulk(arena, sizes.size(), ptrs.data(), sizes.data(),
+                            16);
+}
+
+TEST(core_bulk_allocation_test, resize_jagged_vector) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon(host);
+    vecmem::pool_memory_resource::options opts;
+    opts.min_blocks_per_chunk = 4;
+    vecmem::pool_memory_resource pool(mon, opts);
+
+    vecmem::jagged_vector<int> vec(&pool);
+    const std::vector<unsigned int> sizes(1000, 10);
+    vecmem::details::resize_jagged_vector(vec, sizes);
+
+    ASSERT_EQ(vec.size(), sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        EXPECT_EQ(vec[i].size(), sizes[i]);
+    }
+    // One chunk for the outer, and one for all of the inner vectors.
+    EXPECT_EQ(mon.get_events().size(), 2u);
+}
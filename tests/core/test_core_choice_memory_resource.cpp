@@ -1,17 +1,22 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #include <gtest/gtest.h>
 
+#include "vecmem/memory/arena_memory_resource.hpp"
 #include "vecmem/memory/choice_memory_resource.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
 #include "vecmem/memory/instrumenting_memory_resource.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/pool_memory_resource.hpp"
+
+#include <utility>
+#include <vector>
 
 TEST(core_choice_memory_resource_test, allocate) {
     vecmem::host_memory_resource ups;
@@ -65,3 +70,58 @@ TEST(core_choice_memory_resource_test, allocate) {
 
     EXPECT_THROW(p = res.allocate(512, 32), std::bad_alloc);
 }
+
+TEST(core_choice_memory_resource_test, range_providers) {
+    vecmem::host_memory_resource ups;
+
+    vecmem::instrumenting_memory_resource pool_ups(ups);
+    vecmem::pool_memory_resource pool(pool_ups);
+    vecmem::arena_memory_resource arena(ups, 1u << 16, 1u << 24);
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    vecmem::choice_memory_resource res(
+        [&](std::size_t s, std::size_t) -> vecmem::memory_resource& {
+            if (s < 256) {
+                return pool;
+            } else if (s < 4096) {
+                return arena;
+            } else {
+                return mon;
+            }
+        });
+
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void*, std::size_t, std::size_t) { ++deallocs; });
+    std::size_t pool_deallocs = 0;
+    pool_ups.add_pre_deallocate_hook(
+        [&pool_deallocs](void*, std::size_t, std::size_t) {
+            ++pool_deallocs;
+        });
+
+    // Allocate a mixture of memory blocks from all resources.
+    std::vector<std::pair<void*, std::size_t>> ptrs;
+    for (std::size_t i = 0; i < 100; ++i) {
+        const std::size_t size = 64 + (i * 97) % 8192;
+        ptrs.emplace_back(res.allocate(size), size);
+    }
+    std::size_t big_allocs = 0;
+    for (const auto& [p, size] : ptrs) {
+        if (size >= 4096) {
+            ++big_allocs;
+        }
+    }
+
+    // De-allocate them in reverse order.
+    for (auto it = ptrs.rbegin(); it != ptrs.rend(); ++it) {
+        res.deallocate(it->first, it->second);
+    }
+    EXPECT_EQ(deallocs, big_allocs);
+    EXPECT_EQ(pool_deallocs, 0u);
+
+    // A small block should be handed out by the pool again, from its cache.
+    const std::size_t pool_events = pool_ups.get_events().size();
+    void* p = res.allocate(64);
+    EXPECT_EQ(pool_ups.get_events().size(), pool_events);
+    res.deallocate(p, 64);
+}
@@ -1,7 +1,7 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,11 +10,15 @@
 
 #include "vecmem/memory/coalescing_memory_resource.hpp"
 #include "vecmem/memory/conditional_memory_resource.hpp"
+#include "vecmem/memory/contiguous_memory_resource.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
 #include "vecmem/memory/instrumenting_memory_resource.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/pool_memory_resource.hpp"
 #include "vecmem/memory/terminal_memory_resource.hpp"
 
+#include <vector>
+
 TEST(core_coalescing_memory_resource_test, allocate_terminal) {
     vecmem::terminal_memory_resource ter;
     vecmem::coalescing_memory_resource res({ter, ter, ter, ter});
@@ -104,3 +108,72 @@ TEST(core_coalescing_memory_resource_test, allocate_complex) {
 
     EXPECT_THROW(p = res.allocate(131072), std::bad_alloc);
 }
+
+TEST(core_coalescing_memory_resource_test, range_providers) {
+    vecmem::terminal_memory_resource ter;
+    vecmem::host_memory_resource ups;
+
+    vecmem::contiguous_memory_resource con(ups, 1024);
+    vecmem::pool_memory_resource pool(ups);
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void *, std::size_t, std::size_t) { ++deallocs; });
+
+    vecmem::coalescing_memory_resource res({ter, con, pool, mon});
+
+    // Fill up the contiguous resource, and then some.
+    std::vector<void *> ptrs;
+    for (std::size_t i = 0; i < 32; ++i) {
+        ptrs.push_back(res.allocate(64));
+    }
+    const char *con_begin = static_cast<const char *>(ptrs.front());
+    const char *con_end = con_begin + 1024;
+
+    // Allocate an oversized block, that the pool would hand out as well.
+    void *big = res.allocate(1u << 21);
+
+    // De-allocate everything. This must route all the pointers to the pool
+    // and the contiguous resource.
+    for (void *p : ptrs) {
+        res.deallocate(p, 64);
+    }
+    res.deallocate(big, 1u << 21);
+    EXPECT_EQ(deallocs, 0u);
+
+    // New allocations must all come from the pool, which must not have
+    // received the blocks of the contiguous resource.
+    for (std::size_t i = 0; i < 32; ++i) {
+        const char *p = static_cast<const char *>(res.allocate(64));
+        EXPECT_FALSE((p >= con_begin) && (p < con_end));
+        res.deallocate(const_cast<char *>(p), 64);
+    }
+    EXPECT_EQ(deallocs, 0u);
+}
+
+TEST(core_coalescing_memory_resource_test, mixed_providers) {
+    vecmem::host_memory_resource ups;
+
+    vecmem::pool_memory_resource pool(ups);
+    vecmem::conditional_memory_resource con(
+        pool, [](std::size_t s, std::size_t) { return s < 1024; });
+    vecmem::instrumenting_memory_resource mon(ups);
+
+    std::size_t deallocs = 0;
+    mon.add_pre_deallocate_hook(
+        [&deallocs](void *, std::size_t, std::size_t) { ++deallocs; });
+
+    // The conditional resource does not provide range information, but it
+    // allocates from the pool, which does.
+    vecmem::coalescing_memory_resource res({con, mon, pool});
+
+    void *p1 = res.allocate(64);
+    void *p2 = res.allocate(4096);
+    void *p3 = res.allocate(128);
+    res.deallocate(p2, 4096);
+    EXPECT_EQ(deallocs, 1u);
+    res.deallocate(p1, 64);
+    res.deallocate(p3, 128);
+    EXPECT_EQ(deallocs, 1u);
+}
@@ -12,7 +12,11 @@
 
 // VecMem include(s).
 #include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
 #include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+#include "vecmem/utils/host/parallel_copy.hpp"
+#include "vecmem/utils/simulated_device_copy.hpp"
 
 // GoogleTest include(s).
 #include <gtest/gtest.h>
@@ -25,11 +29,36 @@ static vecmem::host_memory_resource core_host_resource;
 static vecmem::memory_resource* core_host_resource_ptr = &core_host_resource;
 static vecmem::copy core_copy;
 static vecmem::copy* core_copy_ptr = &core_copy;
+/// Options making @c vecmem::host::parallel_copy split up even small copies
+static vecmem::host::parallel_copy::options parallel_copy_options() {
+    vecmem::host::parallel_copy::options opts;
+    opts.n_threads = 4;
+    opts.threshold = 0;
+    opts.chunk_alignment = 8;
+    return opts;
+}
+static vecmem::host::parallel_copy core_parallel_copy{parallel_copy_options()};
+static vecmem::copy* core_parallel_copy_ptr = &core_parallel_copy;
+static vecmem::host::async_copy core_async_copy;
+static vecmem::copy* core_async_copy_ptr = &core_async_copy;
+static vecmem::simulated_device_memory_resource core_simulated_resource;
+static vecmem::memory_resource* core_simulated_resource_ptr =
+    &core_simulated_resource;
+static vecmem::simulated_device_copy core_simulated_copy{
+    core_simulated_resource};
+static vecmem::copy* core_simulated_copy_ptr = &core_simulated_copy;
 
 /// The configurations to run the tests with.
 static const auto core_copy_configs =
     testing::Values(std::tie(core_copy_ptr, core_copy_ptr,
-                             core_host_resource_ptr, core_host_resource_ptr));
+                             core_host_resource_ptr, core_host_resource_ptr),
+                    std::tie(core_parallel_copy_ptr, core_parallel_copy_ptr,
+                             core_host_resource_ptr, core_host_resource_ptr),
+                    std::tie(core_async_copy_ptr, core_copy_ptr,
+                             core_host_resource_ptr, core_host_resource_ptr),
+                    std::tie(core_simulated_copy_ptr, core_copy_ptr,
+                             core_simulated_resource_ptr,
+                             core_host_resource_ptr));
 
 // Instantiate the test suite(s).
 INSTANTIATE_TEST_SUITE_P(core_copy_tests, copy_tests, core_copy_configs);
@@ -0,0 +1,190 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+
+/// Flag turning the counting of heap allocations on and off
+std::atomic<bool> count_allocations{false};
+/// The number of heap allocations performed while counting
+std::atomic<std::size_t> n_allocations{0u};
+
+/// Allocate memory from the heap, counting the allocation if needed
+void* counted_allocate(std::size_t size) {
+    if (count_allocations) {
+        ++n_allocations;
+    }
+    void* result = std::malloc(size == 0u ? 1u : size);
+    if (result == nullptr) {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+/// Count the heap allocations made by a function
+template <typename FUNC>
+std::size_t heap_allocations(FUNC&& func) {
+    n_allocations = 0u;
+    count_allocations = true;
+    func();
+    count_allocations = false;
+    return n_allocations;
+}
+
+}  // namespace
+
+// Replace the global allocation functions of the test executable, to be able
+// to see all heap allocations made by the copy operations.
+void* operator new(std::size_t size) {
+    return counted_allocate(size);
+}
+void* operator new[](std::size_t size) {
+    return counted_allocate(size);
+}
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+TEST(core_copy_allocations_test, vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Set up the containers used in the test.
+    vecmem::vector<int> source(100, 1, &resource);
+    vecmem::data::vector_buffer<int> fixed(100, resource);
+    vecmem::data::vector_buffer<int> resizable1(
+        100, resource, vecmem::data::buffer_type::resizable);
+    vecmem::data::vector_buffer<int> resizable2(
+        100, resource, vecmem::data::buffer_type::resizable);
+    auto source_data = vecmem::get_data(source);
+
+    // The operations to test.
+    auto operations = [&]() {
+        copy.setup(resizable1)->wait();
+        copy(source_data, fixed)->wait();
+        copy(source_data, resizable1)->wait();
+        copy(resizable1, resizable2)->wait();
+        copy.memset(fixed, 0)->wait();
+        EXPECT_EQ(copy.get_size(resizable2), 100u);
+    };
+
+    // After a warm-up, the operations should not allocate anything anymore.
+    operations();
+    EXPECT_EQ(heap_allocations(operations), 0u);
+}
+
+TEST(core_copy_allocations_test, jagged_vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Set up the containers used in the test.
+    vecmem::jagged_vector<int> source(&resource);
+    source.resize(4);
+    source[0] = {1, 2, 3};
+    source[1] = {4, 5};
+    source[3] = {6};
+    auto source_data = vecmem::get_data(source);
+    vecmem::data::jagged_vector_buffer<int> resizable1(
+        std::vector<unsigned int>{5, 5, 5, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> resizable2(
+        std::vector<unsigned int>{5, 5, 5, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> resizable3(
+        std::vector<unsigned int>{3, 10, 1, 8}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(resizable1)->wait();
+    copy.setup(resizable2)->wait();
+    copy.setup(resizable3)->wait();
+
+    // The operations to test.
+    auto operations = [&]() {
+        copy(source_data, resizable1)->wait();
+        copy(resizable1, resizable2)->wait();
+        copy(resizable2, resizable3)->wait();
+    };
+
+    // After a warm-up, the operations should not allocate anything anymore.
+    operations();
+    EXPECT_EQ(heap_allocations(operations), 0u);
+
+    // Functions returning a new std::vector do of course need to allocate
+    // memory. Which also makes sure that the counting works.
+    EXPECT_GT(heap_allocations([&]() {
+                  EXPECT_EQ(copy.get_sizes(resizable3).size(), 4u);
+              }),
+              0u);
+
+    // Make sure that the copies did what they should have.
+    vecmem::jagged_vector<int> result(&resource);
+    copy(resizable3, result)->wait();
+    EXPECT_EQ(result, source);
+}
+
+TEST(core_copy_allocations_test, soa) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Set up the containers used in the test.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    auto source_data = vecmem::get_data(source);
+    const auto size =
+        static_cast<vecmem::testing::simple_soa_container::buffer::size_type>(
+            source.size());
+    vecmem::testing::simple_soa_container::buffer resizable1(
+        size, resource, vecmem::data::buffer_type::resizable);
+    vecmem::testing::simple_soa_container::buffer resizable2(
+        size, resource, vecmem::data::buffer_type::resizable);
+    copy.setup(resizable1)->wait();
+    copy.setup(resizable2)->wait();
+
+    // The operations to test.
+    auto operations = [&]() {
+        copy(source_data, resizable1)->wait();
+        copy(resizable1, resizable2)->wait();
+        copy(std::index_sequence<1>{}, resizable2, resizable1)->wait();
+    };
+
+    // After a warm-up, the operations should not allocate anything anymore.
+    operations();
+    EXPECT_EQ(heap_allocations(operations), 0u);
+}
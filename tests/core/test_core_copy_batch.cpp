@@ -0,0 +1,136 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// Copy type recording the batches that it receives
+class recording_copy : public vecmem::copy {
+
+public:
+    /// The number of regions in every batch received
+    mutable std::vector<std::size_t> m_batches;
+
+protected:
+    void do_copy_batch(std::size_t n, const vecmem::copy_region* regions,
+                       type::copy_type cptype) const override {
+        m_batches.push_back(n);
+        vecmem::copy::do_copy_batch(n, regions, cptype);
+    }
+
+};  // class recording_copy
+
+}  // namespace
+
+TEST(core_copy_batch_test, jagged_padding) {
+
+    vecmem::host_memory_resource resource;
+    recording_copy copy;
+
+    // Create two contiguous jagged buffers, with slightly different layouts,
+    // so that the optimised, single-copy code path could not be taken.
+    const std::vector<unsigned int> capacities1 = {10, 10, 10, 10};
+    const std::vector<unsigned int> capacities2 = {10, 10, 10, 12};
+    const std::vector<unsigned int> sizes = {3, 5, 0, 7};
+    vecmem::data::jagged_vector_buffer<int> source(
+        capacities1, resource, nullptr, vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> dest(
+        capacities2, resource, nullptr, vecmem::data::buffer_type::resizable);
+    copy.setup(source)->wait();
+    copy.setup(dest)->wait();
+    copy.set_sizes(sizes, source)->wait();
+    vecmem::jagged_device_vector<int> source_vec(source);
+    for (unsigned int i = 0; i < source_vec.size(); ++i) {
+        for (unsigned int j = 0; j < source_vec[i].size(); ++j) {
+            source_vec[i][j] = static_cast<int>(i * 100 + j);
+        }
+    }
+
+    // The small gaps between the inner vectors should be copied along.
+    copy.m_batches.clear();
+    copy(source, dest)->wait();
+    ASSERT_EQ(copy.m_batches.size(), 1u);
+    EXPECT_EQ(copy.m_batches[0], 1u);
+
+    // Check the results.
+    EXPECT_EQ(copy.get_sizes(dest), sizes);
+    vecmem::jagged_device_vector<const int> dest_vec(dest);
+    for (unsigned int i = 0; i < sizes.size(); ++i) {
+        ASSERT_EQ(dest_vec[i].size(), sizes[i]);
+        for (unsigned int j = 0; j < sizes[i]; ++j) {
+            EXPECT_EQ(dest_vec[i][j], static_cast<int>(i * 100 + j));
+        }
+    }
+}
+
+TEST(core_copy_batch_test, jagged_no_padding) {
+
+    vecmem::host_memory_resource resource;
+    recording_copy copy;
+
+    // Create a (non-contiguous) host jagged vector.
+    vecmem::jagged_vector<int> source(&resource);
+    source.resize(4);
+    source[0] = {1, 2, 3};
+    source[1] = {4, 5};
+    source[3] = {6};
+
+    // Copy it into a contiguous buffer. Since the source is not a single
+    // memory block, the regions may not be padded.
+    vecmem::data::jagged_vector_buffer<int> dest(
+        std::vector<unsigned int>{5, 5, 5, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest)->wait();
+    copy.m_batches.clear();
+    copy(vecmem::get_data(source), dest)->wait();
+    ASSERT_EQ(copy.m_batches.size(), 1u);
+    EXPECT_LE(copy.m_batches[0], 3u);
+
+    // Check the results.
+    vecmem::jagged_vector<int> result(&resource);
+    copy(dest, result)->wait();
+    EXPECT_EQ(result, source);
+}
+
+TEST(core_copy_batch_test, soa) {
+
+    vecmem::host_memory_resource resource;
+    recording_copy copy;
+
+    // Copy a host container into a buffer, which has to happen variable by
+    // variable.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    vecmem::testing::simple_soa_container::buffer dest(
+        static_cast<unsigned int>(source.size()), resource);
+    copy.setup(dest)->wait();
+    copy.m_batches.clear();
+    copy(vecmem::get_data(source), dest)->wait();
+
+    // All variables should have been copied in a single batch.
+    ASSERT_EQ(copy.m_batches.size(), 1u);
+    EXPECT_LE(copy.m_batches[0], 4u);
+    vecmem::testing::compare(vecmem::get_data(source), vecmem::get_data(dest));
+}
@@ -0,0 +1,114 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/jagged_soa_container.hpp"
+#include "../common/jagged_soa_container_helpers.hpp"
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <bitset>
+#include <utility>
+
+TEST(core_copy_columns_test, simple_compile_time) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a filled source, and a zeroed target.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    vecmem::testing::simple_soa_container::buffer dest(
+        static_cast<unsigned int>(source.size()), resource);
+    copy.memset(dest.payload(), 0)->wait();
+
+    // Copy only the "measurement" and "average" variables.
+    copy(std::index_sequence<1, 2>{}, vecmem::get_data(source), dest)->wait();
+    vecmem::testing::simple_soa_container::device result{dest};
+    EXPECT_EQ(result.count(), 0);
+    EXPECT_FLOAT_EQ(result.average(), source.average());
+    for (unsigned int i = 0; i < result.size(); ++i) {
+        EXPECT_FLOAT_EQ(result.measurement()[i], source.measurement()[i]);
+        EXPECT_EQ(result.index()[i], 0);
+    }
+}
+
+TEST(core_copy_columns_test, simple_runtime) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a filled buffer, and a zeroed one with the same layout.
+    vecmem::testing::simple_soa_container::host host{resource};
+    vecmem::testing::fill(host);
+    vecmem::testing::simple_soa_container::buffer source(
+        static_cast<unsigned int>(host.size()), resource);
+    copy(vecmem::get_data(host), source)->wait();
+    vecmem::testing::simple_soa_container::buffer dest(
+        static_cast<unsigned int>(host.size()), resource);
+    copy.memset(dest.payload(), 0)->wait();
+
+    // Copy only the "count" and "index" variables.
+    std::bitset<4> columns;
+    columns.set(0).set(3);
+    copy(columns, source, dest)->wait();
+    vecmem::testing::simple_soa_container::device result{dest};
+    EXPECT_EQ(result.count(), host.count());
+    EXPECT_FLOAT_EQ(result.average(), 0.f);
+    for (unsigned int i = 0; i < result.size(); ++i) {
+        EXPECT_FLOAT_EQ(result.measurement()[i], 0.f);
+        EXPECT_EQ(result.index()[i], host.index()[i]);
+    }
+
+    // Copying all of the variables should give a full copy.
+    copy(columns.set(), source, dest)->wait();
+    vecmem::testing::compare(vecmem::get_data(source), vecmem::get_data(dest));
+}
+
+TEST(core_copy_columns_test, jagged_to) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a filled source.
+    vecmem::testing::jagged_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    auto source_data = vecmem::get_data(source);
+
+    // Copy the "measurements" jagged vector and the "count" scalar.
+    auto jagged = copy.to(std::index_sequence<2, 0>{}, source_data, resource,
+                          &resource);
+    EXPECT_EQ(jagged.capacity(), source.size());
+    const auto& measurements = jagged.get<0>();
+    ASSERT_EQ(measurements.size(), source.measurements().size());
+    for (std::size_t i = 0; i < source.measurements().size(); ++i) {
+        ASSERT_EQ(measurements.host_ptr()[i].size(),
+                  source.measurements()[i].size());
+        for (unsigned int j = 0; j < measurements.host_ptr()[i].size(); ++j) {
+            EXPECT_DOUBLE_EQ(measurements.host_ptr()[i].ptr()[j],
+                             source.measurements()[i][j]);
+        }
+    }
+    EXPECT_EQ(*(jagged.get<1>()), source.count());
+
+    // Copy only a 1D vector variable.
+    auto flat = copy.to(std::index_sequence<1>{}, source_data, resource);
+    EXPECT_EQ(flat.capacity(), source.size());
+    ASSERT_EQ(flat.get<0>().size(), source.measurement().size());
+    for (unsigned int i = 0; i < flat.get<0>().size(); ++i) {
+        EXPECT_FLOAT_EQ(flat.get<0>().ptr()[i], source.measurement()[i]);
+    }
+}
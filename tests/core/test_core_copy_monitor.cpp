@@ -0,0 +1,151 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/copy_monitor.hpp"
+#include "vecmem/utils/copy_observer.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+namespace {
+
+/// Observer simply recording all of the operations
+class recording_observer : public vecmem::copy_observer {
+
+public:
+    void observe(const record& rec) override { m_records.push_back(rec); }
+    std::vector<record> m_records;
+
+};  // class recording_observer
+
+}  // namespace
+
+TEST(core_copy_monitor_test, bin) {
+
+    EXPECT_EQ(vecmem::copy_monitor::bin(0u), 0u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(1u), 1u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(2u), 2u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(3u), 2u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(4095u), 12u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(4096u), 13u);
+    EXPECT_EQ(vecmem::copy_monitor::bin(~std::size_t{0}), 64u);
+}
+
+TEST(core_copy_monitor_test, observer) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+    EXPECT_EQ(copy.observer(), nullptr);
+    recording_observer observer;
+    copy.set_observer(&observer);
+    EXPECT_EQ(copy.observer(), &observer);
+
+    // Perform a simple copy, and a memset.
+    vecmem::vector<int> source(100, 1, &resource);
+    vecmem::data::vector_buffer<int> target(100, resource);
+    copy(vecmem::get_data(source), target, vecmem::copy::type::host_to_host)
+        ->wait();
+    copy.memset(target, 0)->wait();
+    ASSERT_EQ(observer.m_records.size(), 6u);
+    using operation = vecmem::copy_observer::operation;
+    EXPECT_EQ(observer.m_records[0].m_operation, operation::copy);
+    EXPECT_EQ(observer.m_records[0].m_type, vecmem::copy::type::host_to_host);
+    EXPECT_EQ(observer.m_records[0].m_size, 100 * sizeof(int));
+    EXPECT_EQ(observer.m_records[0].m_n_regions, 1u);
+    EXPECT_EQ(observer.m_records[1].m_operation, operation::event);
+    EXPECT_EQ(observer.m_records[2].m_operation, operation::wait);
+    EXPECT_EQ(observer.m_records[3].m_operation, operation::memset);
+    EXPECT_EQ(observer.m_records[3].m_size, 100 * sizeof(int));
+    EXPECT_EQ(observer.m_records[4].m_operation, operation::event);
+    EXPECT_EQ(observer.m_records[5].m_operation, operation::wait);
+
+    // Batched copies are reported as such.
+    observer.m_records.clear();
+    vecmem::testing::simple_soa_container::host soa{resource};
+    vecmem::testing::fill(soa);
+    vecmem::testing::simple_soa_container::buffer soa_buffer(
+        static_cast<unsigned int>(soa.size()), resource);
+    copy(vecmem::get_data(soa), soa_buffer, vecmem::copy::type::host_to_host)
+        ->wait();
+    bool found_batch = false;
+    for (const auto& rec : observer.m_records) {
+        if (rec.m_operation == operation::copy_batch) {
+            found_batch = true;
+            EXPECT_GT(rec.m_n_regions, 0u);
+            EXPECT_GT(rec.m_size, 0u);
+        }
+    }
+    EXPECT_TRUE(found_batch);
+
+    // Nothing is reported after detaching the observer.
+    observer.m_records.clear();
+    copy.set_observer(nullptr);
+    copy(vecmem::get_data(source), target)->wait();
+    EXPECT_TRUE(observer.m_records.empty());
+}
+
+TEST(core_copy_monitor_test, monitor) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+    vecmem::copy_monitor monitor;
+    copy.set_observer(&monitor);
+
+    // Perform a few copies of different sizes.
+    vecmem::vector<char> small(100, 1, &resource);
+    vecmem::vector<char> large(10000, 2, &resource);
+    vecmem::data::vector_buffer<char> small_target(100, resource);
+    vecmem::data::vector_buffer<char> large_target(10000, resource);
+    for (int i = 0; i < 3; ++i) {
+        copy(vecmem::get_data(small), small_target,
+             vecmem::copy::type::host_to_host)
+            ->wait();
+    }
+    copy(vecmem::get_data(large), large_target,
+         vecmem::copy::type::host_to_device)
+        ->wait();
+    copy.memset(large_target, 0)->wait();
+
+    // Check the collected statistics.
+    const vecmem::copy_monitor::statistics stats = monitor.get_statistics();
+    const auto& h2h = stats.copies[vecmem::copy::type::host_to_host];
+    EXPECT_EQ(h2h.n_calls, 3u);
+    EXPECT_EQ(h2h.n_bytes, 300u);
+    EXPECT_EQ(h2h.histogram[vecmem::copy_monitor::bin(100u)], 3u);
+    EXPECT_EQ(h2h.n_calls_below(4096u), 3u);
+    const auto& h2d = stats.copies[vecmem::copy::type::host_to_device];
+    EXPECT_EQ(h2d.n_calls, 1u);
+    EXPECT_EQ(h2d.n_bytes, 10000u);
+    EXPECT_EQ(h2d.n_calls_below(4096u), 0u);
+    EXPECT_EQ(h2d.n_calls_below(16384u), 1u);
+    EXPECT_EQ(stats.copies[vecmem::copy::type::device_to_host].n_calls, 0u);
+    EXPECT_EQ(stats.memsets.n_calls, 1u);
+    EXPECT_EQ(stats.memsets.n_bytes, 10000u);
+    EXPECT_EQ(stats.n_events, 5u);
+    EXPECT_EQ(stats.n_waits, 5u);
+    EXPECT_GE(h2d.throughput(), 0.);
+
+    // Reset the statistics.
+    monitor.reset();
+    EXPECT_EQ(monitor.get_statistics().n_events, 0u);
+    EXPECT_EQ(
+        monitor.get_statistics().copies[vecmem::copy::type::host_to_host]
+            .n_calls,
+        0u);
+}
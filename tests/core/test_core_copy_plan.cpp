@@ -0,0 +1,209 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/copy_plan.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Fill a resizable jagged vector buffer with some values
+void fill(vecmem::data::jagged_vector_view<int> view, int offset) {
+    vecmem::jagged_device_vector<int> vec(view);
+    for (unsigned int i = 0; i < vec.size(); ++i) {
+        for (unsigned int j = 0; j < vec[i].size(); ++j) {
+            vec[i][j] = static_cast<int>(i * 100 + j) + offset;
+        }
+    }
+}
+
+/// Check the contents of a jagged vector filled with @c ::fill
+void check(vecmem::data::jagged_vector_view<const int> view,
+           const std::vector<unsigned int>& sizes, int offset) {
+    vecmem::jagged_device_vector<const int> vec(view);
+    ASSERT_EQ(vec.size(), sizes.size());
+    for (unsigned int i = 0; i < vec.size(); ++i) {
+        ASSERT_EQ(vec[i].size(), sizes[i]);
+        for (unsigned int j = 0; j < vec[i].size(); ++j) {
+            EXPECT_EQ(vec[i][j], static_cast<int>(i * 100 + j) + offset);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(core_copy_plan_test, invalid) {
+
+    vecmem::copy copy;
+
+    // Default constructed plans can not be executed.
+    vecmem::copy_plan plan;
+    EXPECT_FALSE(plan.valid());
+    EXPECT_THROW(copy(plan)->wait(), std::invalid_argument);
+}
+
+TEST(core_copy_plan_test, jagged_fixed) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Copy a (non-resizable) host jagged vector into a resizable buffer.
+    vecmem::jagged_vector<int> source(&resource);
+    source.resize(4);
+    source[0] = {1, 2, 3};
+    source[1] = {4, 5};
+    source[3] = {6};
+    auto source_data = vecmem::get_data(source);
+    vecmem::data::jagged_vector_buffer<int> dest(
+        std::vector<unsigned int>{5, 5, 5, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest)->wait();
+
+    // Everything about this copy is known up front.
+    vecmem::copy_plan plan = copy.make_plan(source_data, dest);
+    EXPECT_TRUE(plan.valid());
+    EXPECT_EQ(plan.n_dynamic_parts(), 0u);
+    EXPECT_LE(plan.n_fixed_copies(), 4u);
+
+    // Execute the plan a couple of times.
+    for (int i = 0; i < 3; ++i) {
+        source[1][0] = i;
+        copy(plan)->wait();
+        vecmem::jagged_vector<int> result(&resource);
+        copy(dest, result)->wait();
+        EXPECT_EQ(result, source);
+    }
+
+    // Once invalidated, the plan may not be used anymore.
+    plan.invalidate();
+    EXPECT_FALSE(plan.valid());
+    EXPECT_THROW(copy(plan)->wait(), std::invalid_argument);
+}
+
+TEST(core_copy_plan_test, jagged_identical_layout) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create two resizable buffers with the same layout.
+    const std::vector<unsigned int> capacities = {10, 0, 5, 20};
+    vecmem::data::jagged_vector_buffer<int> source(
+        capacities, resource, nullptr, vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> dest(
+        capacities, resource, nullptr, vecmem::data::buffer_type::resizable);
+    copy.setup(source)->wait();
+    copy.setup(dest)->wait();
+
+    // The sizes can be copied directly between these buffers.
+    const vecmem::copy_plan plan = copy.make_plan(source, dest);
+    EXPECT_EQ(plan.n_dynamic_parts(), 0u);
+    EXPECT_LE(plan.n_fixed_copies(), 2u);
+
+    // Make sure that changing sizes are picked up.
+    const std::vector<std::vector<unsigned int>> all_sizes = {
+        {10, 0, 5, 20}, {3, 0, 1, 0}, {0, 0, 0, 7}};
+    for (std::size_t i = 0; i < all_sizes.size(); ++i) {
+        copy.set_sizes(all_sizes[i], source)->wait();
+        fill(source, static_cast<int>(i));
+        copy(plan)->wait();
+        check(dest, all_sizes[i], static_cast<int>(i));
+    }
+}
+
+TEST(core_copy_plan_test, jagged_dynamic) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create two resizable buffers with different layouts.
+    vecmem::data::jagged_vector_buffer<int> source(
+        std::vector<unsigned int>{10, 10, 10, 10}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    vecmem::data::jagged_vector_buffer<int> dest(
+        std::vector<unsigned int>{10, 10, 10, 12}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(source)->wait();
+    copy.setup(dest)->wait();
+
+    // The sizes of the source need to be read during every execution.
+    const vecmem::copy_plan plan = copy.make_plan(source, dest);
+    EXPECT_EQ(plan.n_dynamic_parts(), 1u);
+    EXPECT_EQ(plan.n_fixed_copies(), 0u);
+
+    // Make sure that changing sizes are picked up.
+    const std::vector<std::vector<unsigned int>> all_sizes = {
+        {3, 5, 0, 7}, {10, 10, 10, 10}, {0, 1, 2, 0}};
+    for (std::size_t i = 0; i < all_sizes.size(); ++i) {
+        copy.set_sizes(all_sizes[i], source)->wait();
+        fill(source, static_cast<int>(i));
+        copy(plan)->wait();
+        check(dest, all_sizes[i], static_cast<int>(i));
+    }
+
+    // The target's capacities are checked during the execution.
+    vecmem::data::jagged_vector_buffer<int> small(
+        std::vector<unsigned int>{2, 2, 2, 2}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(small)->wait();
+    copy.set_sizes(std::vector<unsigned int>{3, 3, 3, 3}, source)->wait();
+    const vecmem::copy_plan small_plan = copy.make_plan(source, small);
+    EXPECT_THROW(copy(small_plan)->wait(), std::length_error);
+}
+
+TEST(core_copy_plan_test, soa) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Copy a host container into a buffer, variable by variable.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    vecmem::testing::simple_soa_container::buffer dest1(
+        static_cast<unsigned int>(source.size()), resource,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest1)->wait();
+    const vecmem::copy_plan plan1 =
+        copy.make_plan(vecmem::get_data(source), dest1);
+    EXPECT_EQ(plan1.n_dynamic_parts(), 0u);
+    copy(plan1)->wait();
+    vecmem::testing::compare(vecmem::get_data(source), vecmem::get_data(dest1));
+
+    // Copy the buffer into another one with the same layout.
+    vecmem::testing::simple_soa_container::buffer dest2(
+        static_cast<unsigned int>(source.size()), resource,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest2)->wait();
+    const vecmem::copy_plan plan2 = copy.make_plan(dest1, dest2);
+    EXPECT_EQ(plan2.n_dynamic_parts(), 0u);
+    EXPECT_LE(plan2.n_fixed_copies(), 2u);
+    copy(plan2)->wait();
+    vecmem::testing::compare(vecmem::get_data(dest1), vecmem::get_data(dest2));
+
+    // Make sure that a changed source is copied correctly.
+    vecmem::testing::simple_soa_container::device device1(dest1);
+    for (unsigned int i = 0; i < device1.size(); ++i) {
+        vecmem::testing::modify(i, device1);
+    }
+    copy(plan2)->wait();
+    vecmem::testing::compare(vecmem::get_data(dest1), vecmem::get_data(dest2));
+}
@@ -0,0 +1,151 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(core_copy_slice_test, vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a source vector, and a resizable target buffer.
+    vecmem::vector<int> source(100, &resource);
+    std::iota(source.begin(), source.end(), 0);
+    auto source_data = vecmem::get_data(source);
+    vecmem::data::vector_buffer<int> dest(
+        100, resource, vecmem::data::buffer_type::resizable);
+    copy.setup(dest)->wait();
+
+    // Append the source to the target in chunks.
+    for (std::size_t i = 0; i < source.size(); i += 30) {
+        const std::size_t end = std::min(source.size(), i + 30);
+        copy(source_data, dest, {i, end, i})->wait();
+        EXPECT_EQ(copy.get_size(dest), end);
+    }
+    vecmem::vector<int> result(&resource);
+    copy(dest, result)->wait();
+    EXPECT_EQ(result, source);
+
+    // Copy a slice into the middle of the target.
+    copy(source_data, dest, {0, 10, 50})->wait();
+    EXPECT_EQ(copy.get_size(dest), 60u);
+    vecmem::device_vector<int> dest_vec(dest);
+    for (unsigned int i = 0; i < 10u; ++i) {
+        EXPECT_EQ(dest_vec[50 + i], static_cast<int>(i));
+    }
+
+    // Check the error handling.
+    EXPECT_THROW(copy(source_data, dest, {10, 5, 0})->wait(),
+                 std::out_of_range);
+    EXPECT_THROW(copy(source_data, dest, {90, 101, 0})->wait(),
+                 std::out_of_range);
+    EXPECT_THROW(copy(source_data, dest, {0, 20, 90})->wait(),
+                 std::length_error);
+
+    // Resizable sources may only be sliced within their current size.
+    vecmem::data::vector_buffer<int> dest2(100, resource);
+    EXPECT_THROW(copy(dest, dest2, {50, 70, 0})->wait(), std::out_of_range);
+    EXPECT_THROW(
+        copy(dest, dest2,
+             std::vector<vecmem::copy::slice>{{0, 10, 0}, {55, 61, 10}})
+            ->wait(),
+        std::out_of_range);
+    EXPECT_NO_THROW(copy(dest, dest2, {50, 60, 0})->wait());
+}
+
+TEST(core_copy_slice_test, jagged_vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a source jagged vector.
+    vecmem::jagged_vector<int> source(&resource);
+    source.resize(6);
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        source[i].resize(i);
+        std::iota(source[i].begin(), source[i].end(), static_cast<int>(i));
+    }
+    auto source_data = vecmem::get_data(source);
+
+    // Copy a slice of it into a resizable buffer.
+    vecmem::data::jagged_vector_buffer<int> dest(
+        std::vector<unsigned int>(6, 10), resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest)->wait();
+    copy(source_data, dest, {2, 5, 1})->wait();
+    const auto sizes = copy.get_sizes(dest);
+    EXPECT_EQ(sizes, std::vector<unsigned int>({0, 2, 3, 4, 0, 0}));
+    vecmem::jagged_vector<int> result(&resource);
+    copy(dest, result)->wait();
+    for (std::size_t i = 1; i < 4; ++i) {
+        EXPECT_EQ(result[i], source[i + 1]);
+    }
+
+    // Copy slices between two resizable buffers.
+    vecmem::data::jagged_vector_buffer<int> dest2(
+        std::vector<unsigned int>(6, 10), resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(dest2)->wait();
+    copy(dest, dest2, {1, 3, 4})->wait();
+    EXPECT_EQ(copy.get_sizes(dest2),
+              std::vector<unsigned int>({0, 0, 0, 0, 2, 3}));
+
+    // Check the error handling.
+    EXPECT_THROW(copy(source_data, dest, {0, 7, 0})->wait(),
+                 std::out_of_range);
+    EXPECT_THROW(copy(source_data, dest, {0, 3, 4})->wait(),
+                 std::length_error);
+}
+
+TEST(core_copy_slice_test, soa) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a source container, and a resizable target buffer.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    auto source_data = vecmem::get_data(source);
+    const unsigned int size = static_cast<unsigned int>(source.size());
+    ASSERT_GT(size, 2u);
+    vecmem::testing::simple_soa_container::buffer dest(
+        size, resource, vecmem::data::buffer_type::resizable);
+    copy.setup(dest)->wait();
+
+    // Copy the container in two pieces.
+    copy(source_data, dest, {0, size / 2, 0})->wait();
+    EXPECT_EQ(copy.get_size(dest), size / 2);
+    copy(source_data, dest, {size / 2, size, size / 2})->wait();
+    EXPECT_EQ(copy.get_size(dest), size);
+
+    // Scalars are not copied by slice copies.
+    vecmem::testing::simple_soa_container::device dest_vec(dest);
+    for (unsigned int i = 0; i < size; ++i) {
+        EXPECT_FLOAT_EQ(dest_vec.measurement()[i], source.measurement()[i]);
+        EXPECT_EQ(dest_vec.index()[i], source.index()[i]);
+    }
+}
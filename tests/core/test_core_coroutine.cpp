@@ -0,0 +1,280 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/coroutine.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Minimal, eagerly started coroutine type used in the tests
+class task {
+
+public:
+    /// The promise type of the coroutine
+    struct promise_type {
+
+        /// Awaiter signalling the completion of the coroutine
+        struct final_awaiter {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(
+                std::coroutine_handle<promise_type> handle) noexcept {
+                handle.promise().m_done = true;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        task get_return_object() {
+            return task{
+                std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        final_awaiter final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+
+        /// Flag signalling that the coroutine finished
+        std::atomic<bool> m_done{false};
+    };
+
+    /// Constructor with the coroutine handle
+    explicit task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle) {}
+    /// Copy constructor
+    task(const task&) = delete;
+    /// Destructor
+    ~task() {
+        wait();
+        m_handle.destroy();
+    }
+
+    /// Copy assignment
+    task& operator=(const task&) = delete;
+
+    /// Wait for the coroutine to finish
+    void wait() const {
+        while (!m_handle.promise().m_done) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    /// The handle of the coroutine
+    std::coroutine_handle<promise_type> m_handle;
+
+};  // class task
+
+/// Event completed explicitly by the test
+class manual_event final : public vecmem::abstract_event {
+
+public:
+    /// Constructor with the flag signalling completion
+    explicit manual_event(const std::atomic<bool>& flag) : m_flag(flag) {}
+
+    void wait() override {
+        while (!is_ready()) {
+            std::this_thread::yield();
+        }
+    }
+    bool is_ready() const override { return m_flag.load(); }
+    void ignore() override {}
+
+private:
+    /// The flag signalling completion
+    const std::atomic<bool>& m_flag;
+
+};  // class manual_event
+
+}  // namespace
+
+TEST(core_coroutine_test, copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    vecmem::vector<int> source(1000, 1, &resource);
+    vecmem::vector<int> target(1000, 0, &resource);
+
+    // Copy the vector in a coroutine, and sum up its elements.
+    int sum = 0;
+    auto coro = [&]() -> task {
+        co_await vecmem::co_copy(copy, vecmem::get_data(source),
+                                 vecmem::get_data(target));
+        for (int value : target) {
+            sum += value;
+        }
+    };
+    coro().wait();
+    EXPECT_EQ(sum, 1000);
+}
+
+TEST(core_coroutine_test, to) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    vecmem::vector<int> source = {1, 2, 3, 4, 5};
+    vecmem::jagged_vector<int> jagged_source = {{1, 2}, {}, {3, 4, 5}};
+
+    // Create new buffers in a coroutine.
+    std::vector<int> result;
+    std::vector<int> jagged_result;
+    auto coro = [&]() -> task {
+        vecmem::data::vector_buffer<int> buffer =
+            co_await vecmem::co_to(copy, vecmem::get_data(source), resource);
+        vecmem::device_vector<int> device(buffer);
+        result.assign(device.begin(), device.end());
+
+        vecmem::data::jagged_vector_buffer<int> jagged_buffer =
+            co_await vecmem::co_to(copy, vecmem::get_data(jagged_source),
+                                   resource, &resource);
+        vecmem::device_vector<int> inner(jagged_buffer.host_ptr()[2u]);
+        jagged_result.assign(inner.begin(), inner.end());
+    };
+    coro().wait();
+    EXPECT_EQ(result, std::vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(jagged_result, std::vector<int>({3, 4, 5}));
+}
+
+TEST(core_coroutine_test, sizes) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Set up resizable buffers with some sizes.
+    vecmem::data::vector_buffer<int> vec(
+        10, resource, vecmem::data::buffer_type::resizable);
+    copy.setup(vec)->wait();
+    vecmem::device_vector<int>(vec).resize(7);
+    vecmem::data::jagged_vector_buffer<int> jagged(
+        std::vector<unsigned int>{5, 5, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(jagged)->wait();
+    copy.set_sizes(std::vector<unsigned int>{1, 2, 3}, jagged)->wait();
+
+    // Await the sizes in a coroutine.
+    unsigned int size = 0u;
+    std::vector<unsigned int> sizes;
+    auto coro = [&]() -> task {
+        auto async_size = copy.get_size(vec, resource);
+        size = co_await async_size;
+        auto async_sizes = copy.get_sizes(jagged, resource);
+        const auto& result = co_await async_sizes;
+        sizes.assign(result.begin(), result.end());
+    };
+    coro().wait();
+    EXPECT_EQ(size, 7u);
+    EXPECT_EQ(sizes, std::vector<unsigned int>({1, 2, 3}));
+}
+
+TEST(core_coroutine_test, resume_function) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    vecmem::vector<int> source(1000, 2, &resource);
+    vecmem::vector<int> target(1000, 0, &resource);
+
+    // Resume the coroutine on the main thread of the test.
+    std::mutex mutex;
+    std::vector<std::coroutine_handle<>> to_resume;
+    auto resume = [&](std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        to_resume.push_back(handle);
+    };
+
+    const std::thread::id main_id = std::this_thread::get_id();
+    std::thread::id resumed_id;
+    auto coro = [&]() -> task {
+        auto event = copy(vecmem::get_data(source), vecmem::get_data(target));
+        co_await vecmem::awaitable(*event, resume);
+        resumed_id = std::this_thread::get_id();
+    };
+    task t = coro();
+
+    // Resume the coroutine once it was handed over.
+    while (true) {
+        std::coroutine_handle<> handle;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!to_resume.empty()) {
+                handle = to_resume.back();
+                to_resume.pop_back();
+            }
+        }
+        if (handle) {
+            handle.resume();
+            break;
+        }
+        // The copy may have finished before the coroutine suspended.
+        if (resumed_id == main_id) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    t.wait();
+    EXPECT_EQ(resumed_id, main_id);
+    EXPECT_EQ(target[999], 2);
+}
+
+TEST(core_coroutine_test, blocking_on_runner_thread) {
+
+    std::atomic<bool> first_done{false};
+    std::atomic<bool> second_done{false};
+    std::atomic<bool> second_ran{false};
+
+    // Without a resume function, the coroutine continues on the background
+    // thread of vecmem::then. Waiting for an unfinished continuation from
+    // there must fail, instead of blocking the thread forever.
+    const std::thread::id main_id = std::this_thread::get_id();
+    std::thread::id resumed_id;
+    bool wait_threw = false;
+    auto coro = [&]() -> task {
+        manual_event first(first_done);
+        co_await first;
+        resumed_id = std::this_thread::get_id();
+        auto second = vecmem::then(std::make_unique<manual_event>(second_done),
+                                   [&second_ran]() { second_ran = true; });
+        try {
+            second->wait();
+        } catch (const std::logic_error&) {
+            wait_threw = true;
+        }
+    };
+    task t = coro();
+    first_done = true;
+    t.wait();
+    EXPECT_NE(resumed_id, main_id);
+    EXPECT_TRUE(wait_threw);
+
+    // The continuation must still run, once its event completes.
+    second_done = true;
+    while (!second_ran) {
+        std::this_thread::yield();
+    }
+}
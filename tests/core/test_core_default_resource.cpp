@@ -1,18 +1,51 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2021 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Local include(s).
+#include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/get_default_resource.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/scoped_default_resource.hpp"
 
 // GoogleTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/// Number of allocations and de-allocations
+using event_counts = std::pair<std::size_t, std::size_t>;
+
+/// Count the allocations and de-allocations of an instrumenting resource
+event_counts count_events(
+    const vecmem::instrumenting_memory_resource& res) {
+
+    std::size_t allocs = 0, deallocs = 0;
+    for (const auto& event : res.get_events()) {
+        if (event.m_type == vecmem::instrumenting_memory_resource::
+                                memory_event::type::ALLOCATION) {
+            ++allocs;
+        } else {
+            ++deallocs;
+        }
+    }
+    return {allocs, deallocs};
+}
+
+}  // namespace
+
 TEST(core_default_resource_test, vector_default_resource) {
     vecmem::vector<float> v;
     v.emplace_back(1.f);
@@ -20,3 +53,65 @@ TEST(core_default_resource_test, vector_default_resource) {
     v.emplace_back(2.f);
     EXPECT_EQ(v.back(), 2.f);
 }
+
+TEST(core_default_resource_test, scoped_override) {
+
+    vecmem::host_memory_resource host;
+    vecmem::instrumenting_memory_resource mon1(host), mon2(host);
+
+    EXPECT_EQ(vecmem::scoped_default_resource::current(), nullptr);
+
+    std::optional<vecmem::vector<int>> v1, v2;
+    {
+        vecmem::scoped_default_resource guard1(mon1);
+        EXPECT_EQ(vecmem::scoped_default_resource::current(), &mon1);
+
+        // A default constructed vector should use the override.
+        v1.emplace();
+        v1->resize(100);
+        EXPECT_EQ(count_events(mon1).first, 1u);
+        {
+            // Overrides can be nested.
+            vecmem::scoped_default_resource guard2(mon2);
+            v2.emplace();
+            v2->resize(100);
+            EXPECT_EQ(count_events(mon2).first, 1u);
+            EXPECT_EQ(count_events(mon1).first, 1u);
+
+            // Jagged vectors should use the override for their inner vectors
+            // as well.
+            vecmem::jagged_vector<int> jv;
+            jv.resize(10, vecmem::vector<int>(10));
+            EXPECT_EQ(count_events(mon2).first, 13u);
+        }
+        EXPECT_EQ(vecmem::scoped_default_resource::current(), &mon1);
+        EXPECT_EQ(count_events(mon2).second, 12u);
+
+        // The override is thread-local.
+        std::thread t([&mon1]() {
+            EXPECT_EQ(vecmem::scoped_default_resource::current(), nullptr);
+            vecmem::vector<int> v3(100);
+            EXPECT_EQ(count_events(mon1).first, 1u);
+        });
+        t.join();
+    }
+    EXPECT_EQ(vecmem::scoped_default_resource::current(), nullptr);
+
+    // Vectors created under an override can outlive it, and they need to
+    // return their memory to the resource that allocated it. While new
+    // allocations follow the current thread's override.
+    v1->resize(1000);
+    EXPECT_EQ(count_events(mon1), (event_counts{1u, 1u}));
+    v1.reset();
+    EXPECT_EQ(count_events(mon1), (event_counts{1u, 1u}));
+
+    // Even when they are destroyed on another thread.
+    std::thread t([&v2]() { v2.reset(); });
+    t.join();
+    EXPECT_EQ(count_events(mon2), (event_counts{13u, 13u}));
+
+    // Without an override, the default resource must still work.
+    vecmem::vector<float> v4(1000, 1.f);
+    EXPECT_EQ(v4.back(), 1.f);
+    EXPECT_EQ(v4.get_allocator().resource(), vecmem::get_default_resource());
+}
@@ -1,6 +1,6 @@
 /* VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -60,3 +60,30 @@ TEST(core_edm_view_test, members) {
     EXPECT_EQ(view.get<1>().size(), value2.size());
     EXPECT_EQ(view.get<1>().ptr(), value2.data());
 }
+
+TEST(core_edm_view_test, select) {
+
+    int value1 = 1;
+    std::vector<float> value2{2.0f, 3.0f};
+    double value3 = 4.0;
+
+    vecmem::edm::view<vecmem::edm::schema<vecmem::edm::type::scalar<int>,
+                                          vecmem::edm::type::vector<float>,
+                                          vecmem::edm::type::scalar<double>>>
+        view{2};
+    view.get<0>() = &value1;
+    view.get<1>() = {static_cast<unsigned int>(value2.size()), value2.data()};
+    view.get<2>() = &value3;
+
+    auto selected = vecmem::edm::select<2, 1>(view);
+    constexpr bool helper =
+        std::is_same_v<decltype(selected),
+                       vecmem::edm::view<vecmem::edm::schema<
+                           vecmem::edm::type::scalar<double>,
+                           vecmem::edm::type::vector<float>>>>;
+    EXPECT_TRUE(helper);
+    EXPECT_EQ(selected.capacity(), view.capacity());
+    EXPECT_EQ(selected.get<0>(), &value3);
+    EXPECT_EQ(selected.get<1>().ptr(), value2.data());
+    EXPECT_EQ(selected.payload().ptr(), nullptr);
+}
@@ -0,0 +1,221 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/event_group.hpp"
+#include "vecmem/utils/events.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// Event completed explicitly by the test
+struct manual_event : public vecmem::abstract_event {
+
+    /// Constructor with the flag signalling completion
+    explicit manual_event(std::shared_ptr<std::atomic<bool>> flag)
+        : m_flag(std::move(flag)) {}
+
+    void wait() override {
+        while (!is_ready()) {
+            std::this_thread::yield();
+        }
+    }
+    bool is_ready() const override { return m_flag->load(); }
+    void ignore() override {}
+
+    /// The flag signalling completion
+    std::shared_ptr<std::atomic<bool>> m_flag;
+
+};  // struct manual_event
+
+/// Helper function creating a manual event, with its flag
+std::unique_ptr<vecmem::abstract_event> make_event(
+    std::shared_ptr<std::atomic<bool>>& flag) {
+
+    flag = std::make_shared<std::atomic<bool>>(false);
+    return std::make_unique<manual_event>(flag);
+}
+
+}  // namespace
+
+TEST(core_events_test, event_group) {
+
+    std::shared_ptr<std::atomic<bool>> flag1, flag2, flag3;
+    vecmem::event_group group;
+    EXPECT_TRUE(group.is_ready());
+    EXPECT_EQ(group.add(make_event(flag1)), 0u);
+    EXPECT_EQ(group.add(make_event(flag2)), 1u);
+    EXPECT_EQ(group.add(make_event(flag3)), 2u);
+    EXPECT_EQ(group.size(), 3u);
+
+    // Complete the events one by one.
+    EXPECT_FALSE(group.is_ready());
+    EXPECT_EQ(group.n_ready(), 0u);
+    *flag2 = true;
+    EXPECT_FALSE(group.is_ready());
+    EXPECT_EQ(group.n_ready(), 1u);
+    EXPECT_TRUE(group.is_ready(1u));
+    EXPECT_EQ(group.wait_any(), 1u);
+    *flag1 = true;
+    EXPECT_FALSE(group.is_ready());
+    EXPECT_EQ(group.n_ready(), 2u);
+    *flag3 = true;
+    EXPECT_TRUE(group.is_ready());
+    EXPECT_EQ(group.n_ready(), 3u);
+    group.wait();
+
+    // Waiting for any event of an empty group is not possible.
+    vecmem::event_group empty;
+    EXPECT_THROW(empty.wait_any(), std::logic_error);
+}
+
+TEST(core_events_test, when_all) {
+
+    std::shared_ptr<std::atomic<bool>> flag1, flag2;
+    auto event = vecmem::when_all(make_event(flag1), make_event(flag2));
+    EXPECT_FALSE(event->is_ready());
+    *flag1 = true;
+    EXPECT_FALSE(event->is_ready());
+    *flag2 = true;
+    EXPECT_TRUE(event->is_ready());
+    event->wait();
+
+    // An empty set of events is complete right away.
+    EXPECT_TRUE(vecmem::when_all()->is_ready());
+}
+
+TEST(core_events_test, when_any) {
+
+    std::shared_ptr<std::atomic<bool>> flag1, flag2;
+    auto event = vecmem::when_any(make_event(flag1), make_event(flag2));
+    EXPECT_FALSE(event->is_ready());
+    *flag2 = true;
+    EXPECT_TRUE(event->is_ready());
+    event->wait();
+    *flag1 = true;
+}
+
+TEST(core_events_test, then) {
+
+    // Set up a continuation for an unfinished event.
+    std::shared_ptr<std::atomic<bool>> flag;
+    std::atomic<int> value{0};
+    auto event = vecmem::then(make_event(flag), [&value]() { value = 1; });
+
+    // Make sure that it does not get executed too early.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(event->is_ready());
+    EXPECT_EQ(value.load(), 0);
+
+    // Complete the event, and wait for the continuation.
+    *flag = true;
+    event->wait();
+    EXPECT_EQ(value.load(), 1);
+
+    // Chain a few continuations.
+    auto chained = vecmem::then(
+        vecmem::then(make_event(flag), [&value]() { value = 2; }),
+        [&value]() { value = value * 10; });
+    *flag = true;
+    chained->wait();
+    EXPECT_EQ(value.load(), 20);
+
+    // Exceptions are propagated to the waiting thread.
+    auto failed = vecmem::then(
+        make_event(flag), []() { throw std::runtime_error("Failure"); });
+    *flag = true;
+    EXPECT_THROW(failed->wait(), std::runtime_error);
+}
+
+TEST(core_events_test, then_destructor) {
+
+    // Dropping the event of a continuation must wait for the continuation.
+    std::shared_ptr<std::atomic<bool>> flag;
+    std::atomic<int> value{0};
+    {
+        auto event = vecmem::then(make_event(flag), [&value]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            value = 1;
+        });
+        *flag = true;
+    }
+    EXPECT_EQ(value.load(), 1);
+}
+
+TEST(core_events_test, nested_then) {
+
+    // Set up a continuation from inside of another one, and drop its event
+    // there. This must not wait for the inner continuation, which could only
+    // be executed after the outer one finished.
+    std::shared_ptr<std::atomic<bool>> outer_flag, inner_flag;
+    std::atomic<bool> wait_threw{false};
+    std::atomic<bool> inner_done{false};
+    auto outer_event = make_event(outer_flag);
+    auto inner_event = make_event(inner_flag);
+    auto outer = vecmem::then(std::move(outer_event), [&]() {
+        auto inner = vecmem::then(std::move(inner_event),
+                                  [&inner_done]() { inner_done = true; });
+        // Waiting for the inner continuation must fail instead of hanging.
+        try {
+            inner->wait();
+        } catch (const std::logic_error&) {
+            wait_threw = true;
+        }
+    });
+    *outer_flag = true;
+    outer->wait();
+    EXPECT_TRUE(wait_threw.load());
+
+    // The inner continuation must still be executed, once its event
+    // completes.
+    *inner_flag = true;
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!inner_done.load() &&
+           (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(inner_done.load());
+}
+
+TEST(core_events_test, async_copies) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Issue a couple of asynchronous copies.
+    vecmem::vector<int> source(1000, 1, &resource);
+    vecmem::vector<int> target1(1000, 0, &resource);
+    vecmem::vector<int> target2(1000, 0, &resource);
+
+    // Sum up the results in a continuation, once both copies finished.
+    int sum = 0;
+    auto event = vecmem::then(
+        vecmem::when_all(
+            copy(vecmem::get_data(source), vecmem::get_data(target1)),
+            copy(vecmem::get_data(source), vecmem::get_data(target2))),
+        [&]() {
+            for (std::size_t i = 0; i < source.size(); ++i) {
+                sum += target1[i] + target2[i];
+            }
+        });
+    event->wait();
+    EXPECT_EQ(sum, 2000);
+}
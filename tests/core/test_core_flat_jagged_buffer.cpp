@@ -0,0 +1,121 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/flat_jagged_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST(core_flat_jagged_buffer_test, jagged_vector) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Flatten a jagged vector with separately allocated inner vectors.
+    vecmem::jagged_vector<int> source(
+        {vecmem::vector<int>({1, 2, 3}, &resource),
+         vecmem::vector<int>(&resource), vecmem::vector<int>({4}, &resource),
+         vecmem::vector<int>({5, 6}, &resource)},
+        &resource);
+    const vecmem::data::flat_jagged_buffer<int> flat =
+        copy.flatten(vecmem::get_data(source), resource);
+
+    // Check the layout of the result.
+    EXPECT_EQ(flat.size(), 4u);
+    EXPECT_EQ(flat.n_elements(), 6u);
+    EXPECT_EQ(flat.host_offsets(), (std::vector<unsigned int>{0, 3, 3, 4, 6}));
+    const vecmem::device_vector<const unsigned int> offsets(flat.offsets());
+    ASSERT_EQ(offsets.size(), 5u);
+    for (unsigned int i = 0; i < offsets.size(); ++i) {
+        EXPECT_EQ(offsets[i], flat.host_offsets()[i]);
+    }
+
+    // Check the payload.
+    const vecmem::device_vector<const int> values(flat.values());
+    ASSERT_EQ(values.size(), 6u);
+    for (unsigned int i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], static_cast<int>(i + 1));
+    }
+    for (unsigned int i = 0; i < flat.size(); ++i) {
+        const vecmem::device_vector<const int> inner(flat.inner(i));
+        ASSERT_EQ(inner.size(), source[i].size());
+        for (unsigned int j = 0; j < inner.size(); ++j) {
+            EXPECT_EQ(inner[j], source[i][j]);
+        }
+    }
+}
+
+TEST(core_flat_jagged_buffer_test, resizable_buffer) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Create a resizable jagged buffer, and only fill part of it.
+    vecmem::data::jagged_vector_buffer<int> buffer(
+        {10, 20, 30}, resource, nullptr, vecmem::data::buffer_type::resizable);
+    copy.setup(buffer)->wait();
+    vecmem::jagged_device_vector<int> device(buffer);
+    device[0].push_back(1);
+    device[2].push_back(2);
+    device[2].push_back(3);
+
+    // Only the used elements should end up in the result.
+    const vecmem::data::flat_jagged_buffer<int> flat =
+        copy.flatten(vecmem::get_data(buffer), resource);
+    EXPECT_EQ(flat.size(), 3u);
+    EXPECT_EQ(flat.n_elements(), 3u);
+    EXPECT_EQ(flat.host_offsets(), (std::vector<unsigned int>{0, 1, 1, 3}));
+    const vecmem::device_vector<const int> values(flat.values());
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(values[2], 3);
+}
+
+TEST(core_flat_jagged_buffer_test, empty) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    vecmem::jagged_vector<int> source(&resource);
+    const vecmem::data::flat_jagged_buffer<int> flat =
+        copy.flatten(vecmem::get_data(source), resource);
+    EXPECT_EQ(flat.size(), 0u);
+    EXPECT_EQ(flat.n_elements(), 0u);
+    EXPECT_EQ(flat.host_offsets(), (std::vector<unsigned int>{0}));
+}
+
+TEST(core_flat_jagged_buffer_test, offset_overflow) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    // Describe inner vectors that would not fit into a single buffer
+    // together. They do not need any memory behind them, as the total size
+    // must be checked before anything would be allocated or copied.
+    using size_type = vecmem::data::vector_view<int>::size_type;
+    const size_type half = std::numeric_limits<size_type>::max() / 2u + 1u;
+    std::vector<vecmem::data::vector_view<int>> inner(
+        2u, vecmem::data::vector_view<int>(half, nullptr));
+    const vecmem::data::jagged_vector_view<int> data(
+        static_cast<vecmem::data::jagged_vector_view<int>::size_type>(
+            inner.size()),
+        inner.data(), inner.data());
+    EXPECT_THROW(copy.flatten(data, resource), std::length_error);
+}
@@ -137,6 +137,32 @@ TEST_F(core_instrumenting_memory_resource_test, pre_deallocate_hook) {
     EXPECT_EQ(total_size, 152);
 }
 
+TEST_F(core_instrumenting_memory_resource_test, post_deallocate_hook) {
+    vecmem::instrumenting_memory_resource res(m_upstream);
+
+    std::size_t total_size = 0;
+    std::size_t n_events = 0;
+
+    res.add_post_deallocate_hook(
+        [&](void*, std::size_t size, std::size_t) {
+            total_size += size;
+            n_events = res.get_events().size();
+        });
+
+    void* ptr1 = res.allocate(100);
+    void* ptr2 = res.allocate(50);
+
+    res.deallocate(ptr1, 100);
+
+    EXPECT_EQ(total_size, 100);
+    EXPECT_EQ(n_events, 3);
+
+    res.deallocate(ptr2, 50);
+
+    EXPECT_EQ(total_size, 150);
+    EXPECT_EQ(n_events, 4);
+}
+
 TEST_F(core_instrumenting_memory_resource_test, events) {
     vecmem::instrumenting_memory_resource res(m_upstream);
 
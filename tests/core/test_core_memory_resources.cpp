@@ -12,6 +12,7 @@
 #include "../common/memory_resource_test_host_accessible.hpp"
 #include "../common/memory_resource_test_stress.hpp"
 #include "vecmem/memory/arena_memory_resource.hpp"
+#include "vecmem/memory/batched_synchronized_memory_resource.hpp"
 #include "vecmem/memory/binary_page_memory_resource.hpp"
 #include "vecmem/memory/choice_memory_resource.hpp"
 #include "vecmem/memory/coalescing_memory_resource.hpp"
@@ -23,6 +24,7 @@
 #include "vecmem/memory/instrumenting_memory_resource.hpp"
 #include "vecmem/memory/pool_memory_resource.hpp"
 #include "vecmem/memory/synchronized_memory_resource.hpp"
+#include "vecmem/memory/tagging_memory_resource.hpp"
 #include "vecmem/memory/terminal_memory_resource.hpp"
 
 // GoogleTest include(s).
@@ -43,6 +45,17 @@ static vecmem::instrumenting_memory_resource instrumenting_resource(
     host_resource);
 static vecmem::synchronized_memory_resource synchronized_resource(
     host_resource);
+static vecmem::batched_synchronized_memory_resource
+    batched_synchronized_resource(host_resource);
+static vecmem::batched_synchronized_memory_resource
+    batched_synchronized_resource_bg(host_resource, []() {
+        vecmem::batched_synchronized_memory_resource::options opts;
+        opts.queue_capacity = 16;
+        opts.background_drain = true;
+        return opts;
+    }());
+
+static vecmem::tagging_memory_resource tagging_resource(host_resource);
 
 static vecmem::identity_memory_resource identity_resource(host_resource);
 static vecmem::conditional_memory_resource conditional_resource(
@@ -72,6 +85,9 @@ static vecmem::testing::memory_resource_name_gen name_gen(
      {&arena_resource, "arena_resource"},
      {&instrumenting_resource, "instrumenting_resource"},
      {&synchronized_resource, "synchronized_resource"},
+     {&batched_synchronized_resource, "batched_synchronized_resource"},
+     {&batched_synchronized_resource_bg, "batched_synchronized_resource_bg"},
+     {&tagging_resource, "tagging_resource"},
      {&identity_resource, "identity_resource"},
      {&conditional_resource, "conditional_resource"},
      {&coalescing_resource_1, "coalescing_resource_1"},
@@ -88,44 +104,48 @@ INSTANTIATE_TEST_SUITE_P(
     core_memory_resource_tests, memory_resource_test_basic,
     testing::Values(&host_resource, &binary_resource, &pool_resource,
                     &arena_resource, &instrumenting_resource,
-                    &synchronized_resource, &identity_resource,
-                    &conditional_resource, &coalescing_resource_1,
-                    &coalescing_resource_2, &choice_resource,
-                    &debug_host_resource, &debug_binary_resource,
-                    &debug_pool_resource, &debug_arena_resource,
-                    &debug_synchronized_resource),
+                    &synchronized_resource, &batched_synchronized_resource,
+                    &batched_synchronized_resource_bg, &tagging_resource,
+                    &identity_resource, &conditional_resource,
+                    &coalescing_resource_1, &coalescing_resource_2,
+                    &choice_resource, &debug_host_resource,
+                    &debug_binary_resource, &debug_pool_resource,
+                    &debug_arena_resource, &debug_synchronized_resource),
     name_gen);
 
 INSTANTIATE_TEST_SUITE_P(
     core_memory_resource_tests, memory_resource_test_host_accessible,
     testing::Values(&host_resource, &binary_resource, &pool_resource,
                     &arena_resource, &instrumenting_resource,
-                    &synchronized_resource, &identity_resource,
-                    &conditional_resource, &coalescing_resource_1,
-                    &coalescing_resource_2, &choice_resource,
-                    &debug_host_resource, &debug_binary_resource,
-                    &debug_pool_resource, &debug_arena_resource,
-                    &debug_synchronized_resource),
+                    &synchronized_resource, &batched_synchronized_resource,
+                    &batched_synchronized_resource_bg, &tagging_resource,
+                    &identity_resource, &conditional_resource,
+                    &coalescing_resource_1, &coalescing_resource_2,
+                    &choice_resource, &debug_host_resource,
+                    &debug_binary_resource, &debug_pool_resource,
+                    &debug_arena_resource, &debug_synchronized_resource),
     name_gen);
 
 INSTANTIATE_TEST_SUITE_P(
     core_memory_resource_tests, memory_resource_test_stress,
     testing::Values(&host_resource, &binary_resource, &pool_resource,
                     &arena_resource, &instrumenting_resource,
-                    &synchronized_resource, &identity_resource,
-                    &conditional_resource, &coalescing_resource_1,
-                    &coalescing_resource_2, &choice_resource,
-                    &debug_host_resource, &debug_binary_resource,
-                    &debug_pool_resource, &debug_arena_resource,
-                    &debug_synchronized_resource),
+                    &synchronized_resource, &batched_synchronized_resource,
+                    &batched_synchronized_resource_bg, &tagging_resource,
+                    &identity_resource, &conditional_resource,
+                    &coalescing_resource_1, &coalescing_resource_2,
+                    &choice_resource, &debug_host_resource,
+                    &debug_binary_resource, &debug_pool_resource,
+                    &debug_arena_resource, &debug_synchronized_resource),
     name_gen);
 
 INSTANTIATE_TEST_SUITE_P(
     core_memory_resource_tests, memory_resource_test_alignment,
     testing::Values(&host_resource, &instrumenting_resource, &pool_resource,
-                    &synchronized_resource, &identity_resource,
-                    &conditional_resource, &coalescing_resource_1,
-                    &coalescing_resource_2, &choice_resource,
-                    &debug_host_resource, &debug_pool_resource,
-                    &debug_synchronized_resource),
+                    &synchronized_resource, &batched_synchronized_resource,
+                    &batched_synchronized_resource_bg, &tagging_resource,
+                    &identity_resource, &conditional_resource,
+                    &coalescing_resource_1, &coalescing_resource_2,
+                    &choice_resource, &debug_host_resource,
+                    &debug_pool_resource, &debug_synchronized_resource),
     name_gen);
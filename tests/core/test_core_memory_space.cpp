@@ -0,0 +1,174 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/details/memory_space_provider.hpp"
+#include "vecmem/memory/get_default_resource.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/identity_memory_resource.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/pool_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+namespace {
+
+/// Host memory resource pretending to allocate device memory
+class fake_device_memory_resource
+    : public vecmem::memory_resource,
+      public vecmem::details::memory_space_provider {
+
+private:
+    void* do_allocate(std::size_t size, std::size_t alignment) override {
+        return m_upstream.allocate(size, alignment);
+    }
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override {
+        m_upstream.deallocate(ptr, size, alignment);
+    }
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return (&other == this);
+    }
+    vecmem::memory_space do_space() const noexcept override {
+        return vecmem::memory_space::device;
+    }
+
+    /// The resource performing the allocations
+    vecmem::host_memory_resource m_upstream;
+
+};  // class fake_device_memory_resource
+
+/// Copy type recording the copy types of its copy operations
+class recording_copy : public vecmem::copy {
+
+public:
+    /// The copy types used by the copy operations
+    mutable std::vector<type::copy_type> m_types;
+
+protected:
+    void do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
+                 type::copy_type cptype) const override {
+        m_types.push_back(cptype);
+        vecmem::copy::do_copy(size, from_ptr, to_ptr, cptype);
+    }
+    void do_copy_batch(std::size_t n, const vecmem::copy_region* regions,
+                       type::copy_type cptype) const override {
+        m_types.push_back(cptype);
+        vecmem::copy::do_copy_batch(n, regions, cptype);
+    }
+
+};  // class recording_copy
+
+}  // namespace
+
+TEST(core_memory_space_test, resources) {
+
+    vecmem::host_memory_resource host;
+    fake_device_memory_resource device;
+    vecmem::identity_memory_resource identity{device};
+    vecmem::pool_memory_resource pool{host};
+
+    EXPECT_EQ(vecmem::get_memory_space(host), vecmem::memory_space::host);
+    EXPECT_EQ(vecmem::get_memory_space(device), vecmem::memory_space::device);
+    EXPECT_EQ(vecmem::get_memory_space(identity),
+              vecmem::memory_space::device);
+    EXPECT_EQ(vecmem::get_memory_space(pool), vecmem::memory_space::host);
+    EXPECT_EQ(vecmem::get_memory_space(*(vecmem::get_default_resource())),
+              vecmem::memory_space::unknown);
+}
+
+TEST(core_memory_space_test, buffers) {
+
+    vecmem::host_memory_resource host;
+    fake_device_memory_resource device;
+
+    // 1D buffers, and their views.
+    vecmem::data::vector_buffer<int> vec(10, device);
+    EXPECT_EQ(vec.space(), vecmem::memory_space::device);
+    const vecmem::data::vector_view<const int> const_vec = vec;
+    EXPECT_EQ(const_vec.space(), vecmem::memory_space::device);
+    vecmem::vector<int> host_vec(10, &host);
+    EXPECT_EQ(vecmem::get_data(host_vec).space(),
+              vecmem::memory_space::unknown);
+
+    // Jagged buffers.
+    vecmem::data::jagged_vector_buffer<int> jagged(
+        std::vector<unsigned int>{1, 2, 3}, device, &host,
+        vecmem::data::buffer_type::resizable);
+    EXPECT_EQ(jagged.space(), vecmem::memory_space::device);
+    EXPECT_EQ(jagged.host_ptr()[1].space(), vecmem::memory_space::device);
+
+    // SoA buffers.
+    vecmem::testing::simple_soa_container::buffer soa(10, device);
+    EXPECT_EQ(soa.payload().space(), vecmem::memory_space::device);
+}
+
+TEST(core_memory_space_test, deduce_copy_type) {
+
+    using space = vecmem::memory_space;
+    using type = vecmem::copy::type;
+
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::host, space::device),
+              type::host_to_device);
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::device, space::pinned),
+              type::device_to_host);
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::pinned, space::host),
+              type::host_to_host);
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::device, space::shared),
+              type::device_to_device);
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::unknown, space::device),
+              type::unknown);
+    EXPECT_EQ(vecmem::copy::deduce_copy_type(space::host, space::host,
+                                             type::host_to_device),
+              type::host_to_device);
+}
+
+TEST(core_memory_space_test, copy) {
+
+    vecmem::host_memory_resource host;
+    fake_device_memory_resource device;
+    recording_copy copy;
+
+    // Copy between buffers in different memory spaces, without specifying the
+    // copy types.
+    vecmem::data::vector_buffer<int> host_buffer(10, host);
+    vecmem::data::vector_buffer<int> device_buffer(
+        10, device, vecmem::data::buffer_type::resizable);
+    copy.setup(device_buffer)->wait();
+    copy.memset(host_buffer, 0)->wait();
+
+    copy.m_types.clear();
+    copy(host_buffer, device_buffer)->wait();
+    ASSERT_FALSE(copy.m_types.empty());
+    EXPECT_EQ(copy.m_types.back(), vecmem::copy::type::host_to_device);
+
+    copy.m_types.clear();
+    EXPECT_EQ(copy.get_size(device_buffer), 10u);
+    ASSERT_EQ(copy.m_types.size(), 1u);
+    EXPECT_EQ(copy.m_types.back(), vecmem::copy::type::device_to_host);
+
+    // Explicit copy types are used as they are.
+    copy.m_types.clear();
+    copy(device_buffer, host_buffer, vecmem::copy::type::host_to_host)
+        ->wait();
+    ASSERT_FALSE(copy.m_types.empty());
+    EXPECT_EQ(copy.m_types.back(), vecmem::copy::type::host_to_host);
+}
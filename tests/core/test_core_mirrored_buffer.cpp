@@ -0,0 +1,190 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/details/dirty_ranges.hpp"
+#include "vecmem/utils/mirrored_buffer.hpp"
+#include "vecmem/utils/simulated_device_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Helper turning dirty ranges into (begin, end) pairs
+std::vector<std::pair<std::size_t, std::size_t>> to_pairs(
+    const std::vector<vecmem::copy::slice>& ranges) {
+
+    std::vector<std::pair<std::size_t, std::size_t>> result;
+    for (const vecmem::copy::slice& range : ranges) {
+        EXPECT_EQ(range.offset, range.begin);
+        result.emplace_back(range.begin, range.end);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(core_mirrored_buffer_test, dirty_ranges) {
+
+    using pairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    // Exact tracking.
+    vecmem::details::dirty_ranges ranges(100u);
+    EXPECT_TRUE(ranges.empty());
+    ranges.add(10u, 20u);
+    ranges.add(50u, 60u);
+    ranges.add(30u, 30u);
+    EXPECT_EQ(to_pairs(ranges.ranges()), (pairs{{10u, 20u}, {50u, 60u}}));
+    ranges.add(20u, 25u);
+    EXPECT_EQ(to_pairs(ranges.ranges()), (pairs{{10u, 25u}, {50u, 60u}}));
+    ranges.add(5u, 8u);
+    ranges.add(90u, 100u);
+    EXPECT_EQ(to_pairs(ranges.ranges()),
+              (pairs{{5u, 8u}, {10u, 25u}, {50u, 60u}, {90u, 100u}}));
+    ranges.add(15u, 55u);
+    EXPECT_EQ(to_pairs(ranges.ranges()),
+              (pairs{{5u, 8u}, {10u, 60u}, {90u, 100u}}));
+    EXPECT_EQ(ranges.n_elements(), 63u);
+    EXPECT_THROW(ranges.add(90u, 101u), std::out_of_range);
+    EXPECT_THROW(ranges.add(20u, 10u), std::out_of_range);
+    ranges.clear();
+    EXPECT_TRUE(ranges.empty());
+    ranges.add_all();
+    EXPECT_EQ(to_pairs(ranges.ranges()), (pairs{{0u, 100u}}));
+
+    // Tracking with a coarser granularity.
+    vecmem::details::dirty_ranges coarse(100u, 16u);
+    coarse.add(3u, 4u);
+    coarse.add(40u, 50u);
+    coarse.add(98u, 99u);
+    EXPECT_EQ(to_pairs(coarse.ranges()),
+              (pairs{{0u, 16u}, {32u, 64u}, {96u, 100u}}));
+    coarse.add(17u, 18u);
+    EXPECT_EQ(to_pairs(coarse.ranges()), (pairs{{0u, 64u}, {96u, 100u}}));
+    EXPECT_THROW(vecmem::details::dirty_ranges(10u, 0u),
+                 std::invalid_argument);
+}
+
+TEST(core_mirrored_buffer_test, multi_slice_copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    std::vector<int> source(20);
+    std::iota(source.begin(), source.end(), 0);
+    vecmem::data::vector_buffer<int> target(20, resource);
+    copy.memset(target, 0)->wait();
+
+    // Copy a few ranges.
+    copy(vecmem::get_data(source), target,
+         std::vector<vecmem::copy::slice>{{1u, 3u, 1u}, {10u, 12u, 15u}})
+        ->wait();
+    std::vector<int> result;
+    copy(target, result)->wait();
+    std::vector<int> expected(20, 0);
+    expected[1] = 1;
+    expected[2] = 2;
+    expected[15] = 10;
+    expected[16] = 11;
+    EXPECT_EQ(result, expected);
+
+    // Invalid ranges are caught.
+    EXPECT_THROW(copy(vecmem::get_data(source), target,
+                      std::vector<vecmem::copy::slice>{{0u, 21u, 0u}})
+                     ->wait(),
+                 std::out_of_range);
+    EXPECT_THROW(copy(vecmem::get_data(source), target,
+                      std::vector<vecmem::copy::slice>{{0u, 5u, 16u}})
+                     ->wait(),
+                 std::length_error);
+}
+
+TEST(core_mirrored_buffer_test, sync) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+
+    // Set up the buffer, and synchronize it for the first time.
+    vecmem::mirrored_buffer<int> buffer(1000u, host_resource,
+                                        device_resource);
+    EXPECT_EQ(buffer.size(), 1000u);
+    EXPECT_TRUE(buffer.is_dirty());
+    std::iota(buffer.host().ptr(), buffer.host().ptr() + buffer.size(), 0);
+    buffer.sync(copy)->wait();
+    EXPECT_FALSE(buffer.is_dirty());
+    const vecmem::simulated_device_copy::transfer_statistics h2d =
+        copy.get_statistics().copies[vecmem::copy::type::host_to_device];
+    EXPECT_EQ(h2d.n_bytes, 1000u * sizeof(int));
+
+    // Modify a few elements, and synchronize again.
+    copy.reset_statistics();
+    buffer.host().ptr()[10] = -10;
+    buffer.host().ptr()[500] = -500;
+    buffer.host().ptr()[501] = -501;
+    buffer.mark_dirty(10u, 11u);
+    buffer.mark_dirty(500u, 502u);
+    EXPECT_EQ(buffer.n_dirty(), 3u);
+    buffer.sync(copy)->wait();
+    const auto stats = copy.get_statistics();
+    EXPECT_EQ(stats.copies[vecmem::copy::type::host_to_device].n_bytes,
+              3u * sizeof(int));
+    EXPECT_EQ(stats.copies[vecmem::copy::type::host_to_device].n_copies, 2u);
+
+    // Synchronizing without modifications does not copy anything.
+    copy.reset_statistics();
+    buffer.sync(copy)->wait();
+    EXPECT_EQ(copy.get_statistics()
+                  .copies[vecmem::copy::type::host_to_device]
+                  .n_copies,
+              0u);
+
+    // Check the device array.
+    std::vector<int> result;
+    copy(buffer.device(), result)->wait();
+    std::vector<int> expected(1000u);
+    std::iota(expected.begin(), expected.end(), 0);
+    expected[10] = -10;
+    expected[500] = -500;
+    expected[501] = -501;
+    EXPECT_EQ(result, expected);
+}
+
+TEST(core_mirrored_buffer_test, granularity) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+    vecmem::simulated_device_copy copy{device_resource};
+
+    // Track modifications with a 64 element granularity.
+    vecmem::mirrored_buffer<int> buffer(1000u, host_resource,
+                                        device_resource, 64u);
+    buffer.sync(copy)->wait();
+    copy.reset_statistics();
+    for (unsigned int i = 0u; i < 64u; i += 4u) {
+        buffer.host().ptr()[i] = 1;
+        buffer.mark_dirty(i, i + 1u);
+    }
+    buffer.mark_dirty(999u, 1000u);
+    EXPECT_EQ(buffer.dirty_ranges().size(), 2u);
+    EXPECT_EQ(buffer.n_dirty(), 64u + 40u);
+    buffer.sync(copy)->wait();
+    EXPECT_EQ(copy.get_statistics()
+                  .copies[vecmem::copy::type::host_to_device]
+                  .n_copies,
+              2u);
+}
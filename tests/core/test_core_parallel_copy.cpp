@@ -0,0 +1,136 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/host/parallel_copy.hpp"
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Options splitting up copies of a few kilobytes already
+vecmem::host::parallel_copy::options small_threshold(std::size_t n_threads) {
+    vecmem::host::parallel_copy::options opts;
+    opts.n_threads = n_threads;
+    opts.threshold = 1024;
+    opts.chunk_alignment = 64;
+    return opts;
+}
+
+}  // namespace
+
+TEST(core_parallel_copy_test, invalid_options) {
+
+    vecmem::host::parallel_copy::options opts;
+    opts.chunk_alignment = 100;
+    EXPECT_THROW(vecmem::host::parallel_copy{opts}, std::invalid_argument);
+    opts.chunk_alignment = 128;
+    EXPECT_NO_THROW(vecmem::host::parallel_copy{opts});
+}
+
+TEST(core_parallel_copy_test, n_threads) {
+
+    EXPECT_EQ(vecmem::host::parallel_copy{small_threshold(3)}.n_threads(), 3u);
+    EXPECT_EQ(vecmem::host::parallel_copy{small_threshold(1)}.n_threads(), 1u);
+    EXPECT_GE(vecmem::host::parallel_copy{}.n_threads(), 1u);
+}
+
+TEST(core_parallel_copy_test, large_copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::parallel_copy copy{small_threshold(4)};
+
+    // Test sizes that do not divide evenly between the threads.
+    for (std::size_t size : {100u, 1000u, 12345u, 100001u}) {
+        vecmem::vector<int> source(size, &resource);
+        std::iota(source.begin(), source.end(), 0);
+        vecmem::vector<int> dest(&resource);
+
+        copy(vecmem::get_data(source), dest)->wait();
+        EXPECT_EQ(source, dest);
+    }
+}
+
+TEST(core_parallel_copy_test, unaligned_copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::parallel_copy copy{small_threshold(4)};
+
+    // Copy between memory blocks at different (odd) offsets.
+    vecmem::vector<char> source(50000, &resource);
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<char>(i % 127);
+    }
+    vecmem::vector<char> dest(50000, 0, &resource);
+    vecmem::data::vector_view<const char> from(40001, source.data() + 3);
+    vecmem::data::vector_view<char> to(40001, dest.data() + 7);
+
+    copy(from, to)->wait();
+    for (std::size_t i = 0; i < dest.size(); ++i) {
+        if ((i < 7) || (i >= 40008)) {
+            EXPECT_EQ(dest[i], 0);
+        } else {
+            EXPECT_EQ(dest[i], source[i - 4]);
+        }
+    }
+}
+
+TEST(core_parallel_copy_test, large_memset) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::parallel_copy copy{small_threshold(4)};
+
+    vecmem::data::vector_buffer<unsigned char> buffer(54321, resource);
+    copy.memset(buffer, 0x5a)->wait();
+
+    vecmem::vector<unsigned char> result(&resource);
+    copy(buffer, result)->wait();
+    ASSERT_EQ(result.size(), 54321u);
+    for (unsigned char value : result) {
+        EXPECT_EQ(value, 0x5a);
+    }
+}
+
+TEST(core_parallel_copy_test, concurrent_use) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::parallel_copy copy{small_threshold(2)};
+
+    // Use the same copy object from multiple threads at the same time.
+    static constexpr std::size_t N_THREADS = 4;
+    static constexpr std::size_t N_ITERATIONS = 50;
+    std::vector<std::thread> threads;
+    std::atomic<bool> success{true};
+    for (std::size_t t = 0; t < N_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            vecmem::vector<int> source(20000, &resource);
+            std::iota(source.begin(), source.end(), static_cast<int>(t));
+            for (std::size_t i = 0; i < N_ITERATIONS; ++i) {
+                vecmem::vector<int> dest(&resource);
+                copy(vecmem::get_data(source), dest)->wait();
+                if (dest != source) {
+                    success = false;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(success.load());
+}
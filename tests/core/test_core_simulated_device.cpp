@@ -0,0 +1,107 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/get_memory_space.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/utils/simulated_device_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+TEST(core_simulated_device_test, memory_resource) {
+
+    vecmem::simulated_device_memory_resource resource;
+    EXPECT_EQ(vecmem::get_memory_space(resource),
+              vecmem::memory_space::device);
+
+    // Make an allocation.
+    int* ptr = static_cast<int*>(resource.allocate(100 * sizeof(int), 64u));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64u, 0u);
+    EXPECT_TRUE(resource.owns(ptr));
+    EXPECT_TRUE(resource.owns(ptr + 99));
+    EXPECT_FALSE(resource.owns(ptr + 100));
+    int value = 0;
+    EXPECT_FALSE(resource.owns(&value));
+
+    // The memory can be used while it is made accessible.
+    {
+        vecmem::simulated_device_memory_resource::access_guard guard(
+            resource, ptr, 100 * sizeof(int));
+        ptr[10] = 10;
+        EXPECT_EQ(ptr[10], 10);
+    }
+
+    // But it can not be accessed otherwise.
+#ifndef _WIN32
+    EXPECT_TRUE(resource.is_protected());
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+    EXPECT_DEATH(ptr[10] = 20, "");
+#endif  // not _WIN32
+
+    resource.deallocate(ptr, 100 * sizeof(int), 64u);
+    EXPECT_FALSE(resource.owns(ptr));
+}
+
+TEST(core_simulated_device_test, copy) {
+
+    vecmem::host_memory_resource host_resource;
+    vecmem::simulated_device_memory_resource device_resource;
+
+    // Set up a cost model with simple numbers.
+    vecmem::simulated_device_copy::cost_model model;
+    model.links[vecmem::copy::type::host_to_device] = {
+        std::chrono::nanoseconds{1000}, 1e9};
+    model.links[vecmem::copy::type::device_to_host] = {
+        std::chrono::nanoseconds{2000}, 0.};
+    vecmem::simulated_device_copy copy{device_resource, model};
+
+    // Copy a vector to the "device" and back.
+    vecmem::vector<int> source(250, 5, &host_resource);
+    vecmem::data::vector_buffer<int> device_buffer =
+        copy.to(vecmem::get_data(source), device_resource);
+    EXPECT_EQ(device_buffer.space(), vecmem::memory_space::device);
+    std::vector<int> result;
+    copy(device_buffer, result)->wait();
+    EXPECT_EQ(result, std::vector<int>(250, 5));
+
+    // Check the collected statistics.
+    const vecmem::simulated_device_copy::statistics stats =
+        copy.get_statistics();
+    const auto& h2d = stats.copies[vecmem::copy::type::host_to_device];
+    EXPECT_EQ(h2d.n_copies, 1u);
+    EXPECT_EQ(h2d.n_bytes, 250 * sizeof(int));
+    EXPECT_EQ(h2d.time, std::chrono::nanoseconds{2000});
+    const auto& d2h = stats.copies[vecmem::copy::type::device_to_host];
+    EXPECT_EQ(d2h.n_copies, 1u);
+    EXPECT_EQ(d2h.n_bytes, 250 * sizeof(int));
+    EXPECT_EQ(d2h.time, std::chrono::nanoseconds{2000});
+    EXPECT_EQ(stats.total_time(), std::chrono::nanoseconds{4000});
+    EXPECT_EQ(stats.n_mislabeled, 0u);
+    EXPECT_EQ(stats.n_synchronizations, 2u);
+
+    // Copies with the wrong copy type are recorded according to their real
+    // direction.
+    copy.reset_statistics();
+    copy(vecmem::get_data(source), device_buffer,
+         vecmem::copy::type::host_to_host)
+        ->ignore();
+    const vecmem::simulated_device_copy::statistics stats2 =
+        copy.get_statistics();
+    EXPECT_EQ(stats2.copies[vecmem::copy::type::host_to_device].n_copies, 1u);
+    EXPECT_EQ(stats2.n_mislabeled, 1u);
+    EXPECT_EQ(stats2.n_synchronizations, 0u);
+}
@@ -0,0 +1,161 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/jagged_soa_container.hpp"
+#include "../common/simple_soa_container.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/size_batch.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+namespace {
+
+/// Copy type counting the copy operations that it performs
+class counting_copy : public vecmem::copy {
+
+public:
+    /// The number of batched copies performed
+    mutable std::size_t m_n_batches = 0u;
+    /// The number of individual copies performed
+    mutable std::size_t m_n_copies = 0u;
+
+protected:
+    void do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
+                 type::copy_type cptype) const override {
+        ++m_n_copies;
+        vecmem::copy::do_copy(size, from_ptr, to_ptr, cptype);
+    }
+    void do_copy_batch(std::size_t n, const vecmem::copy_region* regions,
+                       type::copy_type cptype) const override {
+        ++m_n_batches;
+        vecmem::copy::do_copy_batch(n, regions, cptype);
+    }
+
+};  // class counting_copy
+
+}  // namespace
+
+TEST(core_size_batch_test, mixed) {
+
+    vecmem::host_memory_resource resource;
+    counting_copy copy;
+
+    // Set up a number of resizable and fixed sized buffers.
+    vecmem::data::vector_buffer<int> vec1(
+        10, resource, vecmem::data::buffer_type::resizable);
+    vecmem::data::vector_buffer<int> vec2(
+        20, resource, vecmem::data::buffer_type::resizable);
+    vecmem::data::vector_buffer<int> vec3(30, resource);
+    vecmem::data::jagged_vector_buffer<int> jagged(
+        std::vector<unsigned int>{0, 5, 10, 5}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    vecmem::testing::simple_soa_container::buffer soa(
+        15, resource, vecmem::data::buffer_type::resizable);
+    vecmem::testing::jagged_soa_container::buffer jagged_soa(
+        std::vector<unsigned int>{2, 4, 6}, resource, nullptr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(vec1)->wait();
+    copy.setup(vec2)->wait();
+    copy.setup(jagged)->wait();
+    copy.setup(soa)->wait();
+    copy.setup(jagged_soa)->wait();
+
+    // Give them some sizes.
+    vecmem::device_vector<int>(vec1).resize(3);
+    vecmem::device_vector<int>(vec2).resize(17);
+    copy.set_sizes(std::vector<unsigned int>{0, 2, 7, 5}, jagged)->wait();
+    vecmem::testing::simple_soa_container::device soa_device{soa};
+    for (int i = 0; i < 6; ++i) {
+        soa_device.push_back_default();
+    }
+    copy.set_sizes(std::vector<unsigned int>{1, 3, 5},
+                   jagged_soa.get<2>())
+        ->wait();
+
+    // Register all of their sizes in a batch.
+    vecmem::size_batch batch;
+    const vecmem::size_batch::size_handle vec1_handle = batch.add(vec1);
+    const vecmem::size_batch::size_handle vec2_handle = batch.add(vec2);
+    const vecmem::size_batch::size_handle vec3_handle = batch.add(vec3);
+    const vecmem::size_batch::sizes_handle jagged_handle = batch.add(jagged);
+    const vecmem::size_batch::size_handle soa_handle = batch.add(soa);
+    const vecmem::size_batch::size_handle jagged_soa_handle =
+        batch.add(jagged_soa);
+    const vecmem::size_batch::sizes_handle jagged_soa_sizes_handle =
+        batch.add(jagged_soa.get<2>());
+    EXPECT_EQ(batch.size(), 12u);
+
+    // Read them back with a single operation.
+    copy.m_n_batches = 0u;
+    copy.m_n_copies = 0u;
+    vecmem::async_size_batch sizes = copy.get_sizes(batch, resource);
+    EXPECT_EQ(copy.m_n_batches, 1u);
+    EXPECT_EQ(copy.m_n_copies, batch.n_sources());
+
+    // Check the sizes.
+    EXPECT_EQ(sizes.get(vec1_handle), 3u);
+    EXPECT_EQ(sizes.get(vec2_handle), 17u);
+    EXPECT_EQ(sizes.get(vec3_handle), 30u);
+    const vecmem::data::vector_view<const unsigned int> jagged_sizes =
+        sizes.get(jagged_handle);
+    ASSERT_EQ(jagged_sizes.size(), 4u);
+    EXPECT_EQ(jagged_sizes.ptr()[0], 0u);
+    EXPECT_EQ(jagged_sizes.ptr()[1], 2u);
+    EXPECT_EQ(jagged_sizes.ptr()[2], 7u);
+    EXPECT_EQ(jagged_sizes.ptr()[3], 5u);
+    EXPECT_EQ(sizes.get(soa_handle), 6u);
+    EXPECT_EQ(sizes.get(jagged_soa_handle), 3u);
+    const vecmem::data::vector_view<const unsigned int> jagged_soa_sizes =
+        sizes.get(jagged_soa_sizes_handle);
+    ASSERT_EQ(jagged_soa_sizes.size(), 3u);
+    EXPECT_EQ(jagged_soa_sizes.ptr()[0], 1u);
+    EXPECT_EQ(jagged_soa_sizes.ptr()[1], 3u);
+    EXPECT_EQ(jagged_soa_sizes.ptr()[2], 5u);
+}
+
+TEST(core_size_batch_test, fixed_size) {
+
+    vecmem::host_memory_resource resource;
+    counting_copy copy;
+
+    // Fixed sized buffers do not need any memory copies.
+    vecmem::data::vector_buffer<int> vec(30, resource);
+    vecmem::data::jagged_vector_buffer<int> jagged(
+        std::vector<unsigned int>{1, 2, 3}, resource);
+    vecmem::size_batch batch;
+    const vecmem::size_batch::size_handle vec_handle = batch.add(vec);
+    const vecmem::size_batch::sizes_handle jagged_handle = batch.add(jagged);
+    EXPECT_EQ(batch.n_sources(), 0u);
+
+    vecmem::async_size_batch sizes = copy.get_sizes(batch, resource);
+    EXPECT_EQ(copy.m_n_batches, 0u);
+    EXPECT_EQ(copy.m_n_copies, 0u);
+    EXPECT_TRUE(sizes.is_ready());
+    EXPECT_EQ(sizes.get(vec_handle), 30u);
+    const vecmem::data::vector_view<const unsigned int> jagged_sizes =
+        sizes.get(jagged_handle);
+    ASSERT_EQ(jagged_sizes.size(), 3u);
+    EXPECT_EQ(jagged_sizes.ptr()[0], 1u);
+    EXPECT_EQ(jagged_sizes.ptr()[1], 2u);
+    EXPECT_EQ(jagged_sizes.ptr()[2], 3u);
+
+    // Clearing the batch removes all sizes.
+    batch.clear();
+    EXPECT_EQ(batch.size(), 0u);
+}
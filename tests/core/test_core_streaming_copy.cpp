@@ -0,0 +1,131 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Test include(s).
+#include "../common/simple_soa_container.hpp"
+#include "../common/simple_soa_container_helpers.hpp"
+
+// VecMem include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+#include "vecmem/utils/streaming_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+/// Stream a vector, and check the chunks received by the callback
+void test_vector_stream(const vecmem::copy& copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::instrumenting_memory_resource staging_mr(resource);
+
+    // Create the source vector.
+    vecmem::vector<int> source(1000, &resource);
+    std::iota(source.begin(), source.end(), 0);
+
+    // Stream it through 3 buffers with 64 elements each.
+    vecmem::streaming_copy::options opts;
+    opts.chunk_size = 64u;
+    opts.n_buffers = 3u;
+    vecmem::streaming_copy streamer(copy, staging_mr, opts);
+    std::size_t n_chunks = 0u, n_elements = 0u;
+    streamer(vecmem::get_data(source),
+             [&](vecmem::data::vector_view<int> chunk, std::size_t offset) {
+                 EXPECT_EQ(offset, n_elements);
+                 EXPECT_LE(chunk.size(), opts.chunk_size);
+                 for (unsigned int i = 0; i < chunk.size(); ++i) {
+                     EXPECT_EQ(chunk.ptr()[i], static_cast<int>(offset + i));
+                 }
+                 n_elements += chunk.size();
+                 ++n_chunks;
+             });
+    EXPECT_EQ(n_elements, source.size());
+    EXPECT_EQ(n_chunks,
+              (source.size() + opts.chunk_size - 1u) / opts.chunk_size);
+
+    // Only the requested staging buffers should have been allocated. (With
+    // some alignment padding allowed for them.)
+    std::size_t n_allocations = 0u;
+    for (const auto& event : staging_mr.get_events()) {
+        if (event.m_type ==
+            vecmem::instrumenting_memory_resource::memory_event::type::
+                ALLOCATION) {
+            EXPECT_LE(event.m_size, opts.chunk_size * sizeof(int) +
+                                        alignof(std::max_align_t));
+            ++n_allocations;
+        }
+    }
+    EXPECT_EQ(n_allocations, opts.n_buffers);
+}
+
+}  // namespace
+
+TEST(core_streaming_copy_test, vector) {
+
+    test_vector_stream(vecmem::copy{});
+}
+
+TEST(core_streaming_copy_test, vector_async) {
+
+    test_vector_stream(vecmem::host::async_copy{});
+}
+
+TEST(core_streaming_copy_test, soa) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::host::async_copy copy;
+
+    // Create the source container.
+    vecmem::testing::simple_soa_container::host source{resource};
+    vecmem::testing::fill(source);
+    ASSERT_GT(source.size(), 3u);
+
+    // Stream it in small chunks.
+    vecmem::streaming_copy::options opts;
+    opts.chunk_size = 3u;
+    vecmem::streaming_copy streamer(copy, resource, opts);
+    std::size_t n_elements = 0u;
+    streamer(vecmem::get_data(source),
+             [&](vecmem::testing::simple_soa_container::view chunk,
+                 std::size_t offset, std::size_t size) {
+                 EXPECT_EQ(offset, n_elements);
+                 vecmem::testing::simple_soa_container::device device{chunk};
+                 for (unsigned int i = 0; i < size; ++i) {
+                     EXPECT_FLOAT_EQ(device.measurement()[i],
+                                     source.measurement()[offset + i]);
+                     EXPECT_EQ(device.index()[i], source.index()[offset + i]);
+                 }
+                 n_elements += size;
+             });
+    EXPECT_EQ(n_elements, source.size());
+}
+
+TEST(core_streaming_copy_test, invalid_options) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+
+    vecmem::streaming_copy::options opts;
+    opts.chunk_size = 0u;
+    EXPECT_THROW(vecmem::streaming_copy(copy, resource, opts),
+                 std::invalid_argument);
+    opts.chunk_size = 10u;
+    opts.n_buffers = 0u;
+    EXPECT_THROW(vecmem::streaming_copy(copy, resource, opts),
+                 std::invalid_argument);
+}
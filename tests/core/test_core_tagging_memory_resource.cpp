@@ -0,0 +1,189 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/scoped_allocation_tag.hpp"
+#include "vecmem/memory/simulated_device_memory_resource.hpp"
+#include "vecmem/memory/tagging_memory_resource.hpp"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Helper function finding the statistics of one tag
+vecmem::tagging_memory_resource::tag_statistics find_tag(
+    const vecmem::tagging_memory_resource& res, const std::string& tag) {
+
+    for (const auto& stat : res.statistics()) {
+        if (stat.tag == tag) {
+            return stat;
+        }
+    }
+    ADD_FAILURE() << "Tag \"" << tag << "\" not found";
+    return {};
+}
+
+}  // namespace
+
+TEST(core_tagging_memory_resource_test, scoped_tag) {
+
+    EXPECT_EQ(vecmem::scoped_allocation_tag::current(), nullptr);
+    {
+        vecmem::scoped_allocation_tag tag1("outer");
+        EXPECT_STREQ(vecmem::scoped_allocation_tag::current(), "outer");
+        {
+            vecmem::scoped_allocation_tag tag2("inner");
+            EXPECT_STREQ(vecmem::scoped_allocation_tag::current(), "inner");
+        }
+        EXPECT_STREQ(vecmem::scoped_allocation_tag::current(), "outer");
+
+        // Tags are per-thread.
+        std::thread t([]() {
+            EXPECT_EQ(vecmem::scoped_allocation_tag::current(), nullptr);
+        });
+        t.join();
+    }
+    EXPECT_EQ(vecmem::scoped_allocation_tag::current(), nullptr);
+}
+
+TEST(core_tagging_memory_resource_test, accounting) {
+
+    vecmem::host_memory_resource ups;
+    vecmem::tagging_memory_resource res(ups);
+
+    void* p1 = res.allocate(100);
+    void* p2 = nullptr;
+    void* p3 = nullptr;
+    {
+        vecmem::scoped_allocation_tag tag("tracking");
+        p2 = res.allocate(1000);
+        p3 = res.allocate(2000);
+    }
+    // De-allocations must be accounted to the allocation's tag.
+    res.deallocate(p3, 2000);
+    {
+        vecmem::scoped_allocation_tag tag("clustering");
+        void* p4 = res.allocate(500);
+        res.deallocate(p4, 500);
+        res.deallocate(p1, 100);
+    }
+
+    const auto stats = res.statistics();
+    ASSERT_EQ(stats.size(), 3u);
+    // The statistics should be ordered by peak memory usage.
+    EXPECT_EQ(stats[0].tag, "tracking");
+    EXPECT_EQ(stats[1].tag, "clustering");
+    EXPECT_EQ(stats[2].tag, vecmem::tagging_memory_resource::untagged);
+
+    const auto tracking = find_tag(res, "tracking");
+    EXPECT_EQ(tracking.n_allocations, 2u);
+    EXPECT_EQ(tracking.n_deallocations, 1u);
+    EXPECT_EQ(tracking.total_bytes, 3000u);
+    EXPECT_EQ(tracking.current_bytes, 1000u);
+    EXPECT_EQ(tracking.peak_bytes, 3000u);
+
+    const auto untagged =
+        find_tag(res, vecmem::tagging_memory_resource::untagged);
+    EXPECT_EQ(untagged.n_allocations, 1u);
+    EXPECT_EQ(untagged.n_deallocations, 1u);
+    EXPECT_EQ(untagged.current_bytes, 0u);
+    EXPECT_EQ(untagged.peak_bytes, 100u);
+
+    // Check that the report mentions all of the tags.
+    std::ostringstream report;
+    res.report(report);
+    EXPECT_NE(report.str().find("tracking"), std::string::npos);
+    EXPECT_NE(report.str().find("clustering"), std::string::npos);
+    EXPECT_NE(report.str().find(vecmem::tagging_memory_resource::untagged),
+              std::string::npos);
+
+    res.deallocate(p2, 1000);
+    EXPECT_EQ(find_tag(res, "tracking").current_bytes, 0u);
+}
+
+TEST(core_tagging_memory_resource_test, multi_threaded) {
+
+    vecmem::host_memory_resource ups;
+    vecmem::tagging_memory_resource res(ups);
+
+    // Use the resource from multiple threads, with different tags.
+    static constexpr std::size_t N_THREADS = 4;
+    static constexpr std::size_t N_ALLOCS = 1000;
+    const std::vector<std::string> tags = {"a", "b", "c", "d"};
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < N_THREADS; ++i) {
+        threads.emplace_back([&res, &tags, i]() {
+            vecmem::scoped_allocation_tag tag(tags[i].c_str());
+            for (std::size_t j = 0; j < N_ALLOCS; ++j) {
+                vecmem::vector<int> vec(&res);
+                vec.resize(10 + j % 10);
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    for (const std::string& tag : tags) {
+        const auto stat = find_tag(res, tag);
+        EXPECT_EQ(stat.n_allocations, N_ALLOCS);
+        EXPECT_EQ(stat.n_deallocations, N_ALLOCS);
+        EXPECT_EQ(stat.current_bytes, 0u);
+        EXPECT_EQ(stat.peak_bytes, 19 * sizeof(int));
+    }
+}
+
+TEST(core_tagging_memory_resource_test, reused_tag_string) {
+
+    vecmem::host_memory_resource ups;
+    vecmem::tagging_memory_resource res(ups);
+
+    // Re-use the same memory for different tags.
+    char name[16] = "first";
+    {
+        vecmem::scoped_allocation_tag tag(name);
+        res.deallocate(res.allocate(100), 100);
+    }
+    std::snprintf(name, sizeof(name), "second");
+    {
+        vecmem::scoped_allocation_tag tag(name);
+        res.deallocate(res.allocate(200), 200);
+    }
+
+    EXPECT_EQ(find_tag(res, "first").total_bytes, 100u);
+    EXPECT_EQ(find_tag(res, "second").total_bytes, 200u);
+}
+
+TEST(core_tagging_memory_resource_test, device_upstream) {
+
+    // The memory of the upstream resource is not accessible from the host,
+    // so the resource must not put anything into it.
+    vecmem::simulated_device_memory_resource ups;
+    vecmem::tagging_memory_resource res(ups);
+
+    void* p1 = nullptr;
+    {
+        vecmem::scoped_allocation_tag tag("device");
+        p1 = res.allocate(1000);
+        res.deallocate(res.allocate(500), 500);
+    }
+    res.deallocate(p1, 1000);
+
+    const auto device = find_tag(res, "device");
+    EXPECT_EQ(device.n_allocations, 2u);
+    EXPECT_EQ(device.n_deallocations, 2u);
+    EXPECT_EQ(device.total_bytes, 1500u);
+    EXPECT_EQ(device.current_bytes, 0u);
+}
@@ -0,0 +1,143 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/trace_recorder.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+/// Count the occurrences of a string in another one
+std::size_t count(const std::string& str, const std::string& what) {
+
+    std::size_t result = 0u;
+    for (std::size_t pos = str.find(what); pos != std::string::npos;
+         pos = str.find(what, pos + what.size())) {
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(core_trace_recorder_test, allocations) {
+
+    // The recorder must outlive the objects that it is attached to.
+    vecmem::trace_recorder recorder;
+    vecmem::host_memory_resource upstream;
+    vecmem::instrumenting_memory_resource resource(upstream);
+    recorder.attach(resource, "host \"pinned\"");
+
+    // Allocate memory on the main thread and on a helper thread.
+    void* ptr = resource.allocate(1024u, 64u);
+    std::thread helper([&resource]() {
+        void* p = resource.allocate(16u);
+        resource.deallocate(p, 16u);
+    });
+    helper.join();
+    resource.deallocate(ptr, 1024u, 64u);
+    EXPECT_EQ(recorder.size(), 4u);
+
+    // Check the written timeline.
+    std::ostringstream out;
+    recorder.write(out);
+    const std::string json = out.str();
+    EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+    EXPECT_EQ(count(json, "\"name\":\"allocate\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"deallocate\""), 2u);
+    EXPECT_EQ(count(json, "\"ph\":\"X\""), 4u);
+    EXPECT_EQ(count(json, "\"cat\":\"memory\""), 4u);
+    EXPECT_EQ(count(json, "\"resource\":\"host \\\"pinned\\\"\""), 4u);
+    EXPECT_EQ(count(json, "\"size\":1024,\"alignment\":64"), 2u);
+    EXPECT_EQ(count(json, "\"size\":16,"), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"thread_name\""), 2u);
+    EXPECT_EQ(count(json, "\"tid\":1,"), 3u);
+    EXPECT_EQ(count(json, "\"tid\":2,"), 3u);
+
+    // Clear the recorded spans.
+    recorder.clear();
+    EXPECT_EQ(recorder.size(), 0u);
+}
+
+TEST(core_trace_recorder_test, copies) {
+
+    vecmem::trace_recorder recorder;
+    vecmem::host_memory_resource resource;
+    vecmem::copy copy;
+    recorder.attach(copy, "host copy");
+
+    // Perform a copy and a memset, waiting for both of them.
+    vecmem::vector<int> source(100, 1, &resource);
+    vecmem::data::vector_buffer<int> target(100, resource);
+    copy(vecmem::get_data(source), target, vecmem::copy::type::host_to_host)
+        ->wait();
+    copy.memset(target, 0)->wait();
+    EXPECT_EQ(recorder.size(), 6u);
+
+    // Check the written timeline.
+    std::ostringstream out;
+    recorder.write(out);
+    const std::string json = out.str();
+    EXPECT_EQ(count(json, "\"cat\":\"copy\""), 6u);
+    EXPECT_EQ(count(json, "\"copy\":\"host copy\""), 6u);
+    EXPECT_EQ(count(json, "\"name\":\"copy\""), 1u);
+    EXPECT_EQ(count(json, "\"name\":\"memset\""), 1u);
+    EXPECT_EQ(count(json, "\"name\":\"event\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"wait\""), 2u);
+    EXPECT_EQ(count(json, "\"size\":400,\"regions\":1,"
+                          "\"type\":\"host_to_host\""),
+              1u);
+
+    // Events that are not waited on explicitly, wait implicitly on their
+    // destruction. Which must be recorded as well.
+    recorder.clear();
+    {
+        auto event = copy.memset(target, 1);
+    }
+    EXPECT_EQ(recorder.size(), 3u);
+    std::ostringstream out2;
+    recorder.write(out2);
+    EXPECT_EQ(count(out2.str(), "\"name\":\"wait\""), 1u);
+}
+
+TEST(core_trace_recorder_test, file) {
+
+    const std::string filename =
+        ::testing::TempDir() + "core_trace_recorder_test.json";
+    {
+        vecmem::trace_recorder recorder(filename);
+        vecmem::host_memory_resource upstream;
+        vecmem::instrumenting_memory_resource resource(upstream);
+        recorder.attach(resource, "host");
+        resource.deallocate(resource.allocate(128u), 128u);
+    }
+
+    // The timeline must have been written on destruction.
+    std::ifstream file(filename);
+    ASSERT_TRUE(file.good());
+    const std::string json((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+    EXPECT_EQ(count(json, "\"ph\":\"X\""), 2u);
+    file.close();
+    std::remove(filename.c_str());
+}